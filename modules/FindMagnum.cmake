@@ -502,7 +502,12 @@ foreach(component ${Magnum_FIND_COMPONENTS})
     elseif(${component} STREQUAL Primitives)
         set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Cube.h)
 
-    # No special setup for SceneGraph library
+    # SceneGraph library, needs threads for parallel transformation
+    # computation
+    elseif(${component} STREQUAL SceneGraph)
+        find_package(Threads)
+        set(_MAGNUM_${_COMPONENT}_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+
     # No special setup for Shaders library
     # No special setup for Shapes library
     # No special setup for Text library
@@ -510,9 +515,14 @@ foreach(component ${Magnum_FIND_COMPONENTS})
     # TextureTools library
     elseif(${component} STREQUAL TextureTools)
         set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Atlas.h)
+
+    # ObjImporter plugin, needs threads for parallel mesh import
+    elseif(${component} STREQUAL ObjImporter)
+        find_package(Threads)
+        set(_MAGNUM_${_COMPONENT}_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
     endif()
 
-    # No special setup for plugins
+    # No special setup for other plugins
 
     # Try to find the includes
     if(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES)
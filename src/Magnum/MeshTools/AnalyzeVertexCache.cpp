@@ -0,0 +1,89 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AnalyzeVertexCache.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace MeshTools {
+
+VertexCacheStatistics analyzeVertexCache(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize, const VertexCacheType type) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::analyzeVertexCache(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(cacheSize != 0, "MeshTools::analyzeVertexCache(): cache size can't be zero", {});
+
+    /* Per-vertex used flag for counting unique vertices */
+    std::vector<bool> used(vertexCount);
+    UnsignedInt usedCount = 0;
+    UnsignedInt cacheMissCount = 0;
+
+    /* FIFO cache is simulated using global time and per-vertex timestamps,
+       the same as in tipsify() -- the vertex is in the cache if there were
+       less than cacheSize misses since it was put there */
+    if(type == VertexCacheType::Fifo) {
+        UnsignedInt time = cacheSize + 1;
+        std::vector<UnsignedInt> timestamp(vertexCount);
+        for(const UnsignedInt v: indices) {
+            CORRADE_ASSERT(v < vertexCount, "MeshTools::analyzeVertexCache(): index" << v << "out of bounds for" << vertexCount << "vertices", {});
+            if(!used[v]) {
+                used[v] = true;
+                ++usedCount;
+            }
+
+            if(time - timestamp[v] > cacheSize) {
+                timestamp[v] = time++;
+                ++cacheMissCount;
+            }
+        }
+
+    /* LRU cache is simulated directly, most recently used vertex first */
+    } else {
+        std::vector<UnsignedInt> cache;
+        cache.reserve(cacheSize);
+        for(const UnsignedInt v: indices) {
+            CORRADE_ASSERT(v < vertexCount, "MeshTools::analyzeVertexCache(): index" << v << "out of bounds for" << vertexCount << "vertices", {});
+            if(!used[v]) {
+                used[v] = true;
+                ++usedCount;
+            }
+
+            auto found = std::find(cache.begin(), cache.end(), v);
+            if(found == cache.end()) {
+                ++cacheMissCount;
+                if(cache.size() < cacheSize) cache.push_back(v);
+                found = cache.end() - 1;
+                *found = v;
+            }
+
+            std::rotate(cache.begin(), found, found + 1);
+        }
+    }
+
+    return {cacheMissCount,
+        indices.empty() ? 0.0f : Float(cacheMissCount)/(indices.size()/3),
+        usedCount ? Float(cacheMissCount)/usedCount : 0.0f};
+}
+
+}}
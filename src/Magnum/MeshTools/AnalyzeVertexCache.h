@@ -0,0 +1,105 @@
+#ifndef Magnum_MeshTools_AnalyzeVertexCache_h
+#define Magnum_MeshTools_AnalyzeVertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::VertexCacheStatistics, enum @ref Magnum::MeshTools::VertexCacheType, function @ref Magnum::MeshTools::analyzeVertexCache()
+ */
+
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Post-transform vertex cache type
+
+@see @ref analyzeVertexCache()
+*/
+enum class VertexCacheType: UnsignedByte {
+    /**
+     * First-in first-out cache. A vertex is pushed out of the cache after
+     * given count of cache misses, regardless of whether it was used in the
+     * meantime. This is how post-transform caches of most GPUs behave.
+     */
+    Fifo,
+
+    /**
+     * Least-recently-used cache. A used vertex is moved to the front of the
+     * cache, the vertex which wasn't used for the longest time is pushed out
+     * on cache miss.
+     */
+    Lru
+};
+
+/**
+@brief Post-transform vertex cache statistics
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /** @brief Count of cache misses, i.e. count of transformed vertices */
+    UnsignedInt cacheMissCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Count of cache misses per triangle. Ranges from `0.5` for ideal
+     * infinitely large mesh with infinitely large cache to `3.0` if no
+     * vertex is reused.
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transformed vertex ratio
+     *
+     * Count of cache misses per unique vertex used by the mesh. Equal to
+     * `1.0` if each vertex is transformed only once. Unlike @ref acmr it
+     * doesn't depend on the mesh topology.
+     */
+    Float atvr;
+};
+
+/**
+@brief Analyze post-transform vertex cache usage
+@param indices      Indices array
+@param vertexCount  Vertex count
+@param cacheSize    Post-transform vertex cache size
+@param type         Cache type
+
+Simulates the post-transform vertex cache when rendering the mesh and counts
+the cache misses. Useful for comparing output of @ref tipsify() and
+@ref forsyth() for particular mesh and cache size. The function requires the
+mesh to have triangle faces, thus index count must be divisible by 3, all
+indices must be smaller than @p vertexCount and @p cacheSize must not be zero.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize, VertexCacheType type = VertexCacheType::Fifo);
+
+}}
+
+#endif
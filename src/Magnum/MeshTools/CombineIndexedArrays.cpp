@@ -25,15 +25,99 @@
 
 #include "CombineIndexedArrays.h"
 
-#include <cstring>
-#include <unordered_map>
+#include <cstdint>
 #include <Corrade/Utility/Assert.h>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+/* Hash of the index combination is saved alongside index of the unique
+   combination, so the indices need to be compared only on full hash match
+   and the table can be grown without rehashing */
+struct Slot {
+    UnsignedInt hash;
+    UnsignedInt index;
+};
+
+constexpr UnsignedInt Empty = ~UnsignedInt{};
+
+/* Makes the index combinations unique using an open-addressed hash table with
+   linear probing. The `index(i, offset)` functor returns index at position `i`
+   of array `offset`, so the combinations can be read either from one
+   interleaved array or from separate arrays without interleaving them first.
+   Original combinations were 0, 1, 2, 3, ..., `combinedIndices` contains new
+   ones into the (shorter) interleaved array of unique combinations. */
+template<class Index> std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combine(const std::size_t count, const UnsignedInt stride, const Index& index) {
+    CORRADE_ASSERT(count < Empty, "MeshTools::combineIndexArrays(): too many indices", {});
+
+    /* The table is kept at most half full and grows with count of unique
+       combinations, not the total count */
+    std::vector<Slot> table(1024, Slot{0, Empty});
+    std::size_t mask = table.size() - 1;
+
+    std::vector<UnsignedInt> combinedIndices(count);
+    std::vector<UnsignedInt> newInterleavedArrays;
+    UnsignedInt uniqueCount = 0;
+    for(std::size_t i = 0; i != count; ++i) {
+        /* Cheap integer mixing, the upper bits are folded back so they affect
+           the table slot too */
+        std::uint64_t hash = stride;
+        for(UnsignedInt offset = 0; offset != stride; ++offset) {
+            hash = (hash ^ index(i, offset))*0x9e3779b97f4a7c15ull;
+            hash ^= hash >> 32;
+        }
+        const UnsignedInt hash32 = UnsignedInt(hash);
+
+        /* Find the combination in the table, stop at first empty slot. The
+           combinations are compared with the already written unique ones. */
+        std::size_t slot = hash32 & mask;
+        for(; table[slot].index != Empty; slot = (slot + 1) & mask) {
+            if(table[slot].hash != hash32) continue;
+
+            const UnsignedInt* const unique = newInterleavedArrays.data() + table[slot].index*stride;
+            UnsignedInt offset = 0;
+            while(offset != stride && unique[offset] == index(i, offset)) ++offset;
+            if(offset == stride) break;
+        }
+
+        /* Already there */
+        if(table[slot].index != Empty) {
+            combinedIndices[i] = table[slot].index;
+            continue;
+        }
+
+        /* New combination, copy it to new interleaved arrays */
+        for(UnsignedInt offset = 0; offset != stride; ++offset)
+            newInterleavedArrays.push_back(index(i, offset));
+        combinedIndices[i] = uniqueCount;
+        table[slot] = Slot{hash32, uniqueCount};
+        ++uniqueCount;
+
+        /* Grow the table if it's more than half full, the slots are
+           reinserted using the saved hashes */
+        if(std::size_t(uniqueCount)*2 > table.size()) {
+            std::vector<Slot> grown(table.size()*2, Slot{0, Empty});
+            mask = grown.size() - 1;
+            for(const Slot& s: table) {
+                if(s.index == Empty) continue;
+                std::size_t j = s.hash & mask;
+                while(grown[j].index != Empty) j = (j + 1) & mask;
+                grown[j] = s;
+            }
+            table = std::move(grown);
+        }
+    }
+
+    CORRADE_INTERNAL_ASSERT(newInterleavedArrays.size() == std::size_t(uniqueCount)*stride);
+
+    return {std::move(combinedIndices), std::move(newInterleavedArrays)};
+}
+
+}
+
 namespace Implementation {
 
 std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end) {
@@ -45,19 +129,14 @@ std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombi
         CORRADE_ASSERT(it->get().size() == inputSize, "MeshTools::combineIndexArrays(): the arrays don't have the same size", {});
     #endif
 
-    /* Interleave the arrays */
-    std::vector<UnsignedInt> interleavedArrays;
-    interleavedArrays.resize(inputSize*stride);
-    for(UnsignedInt offset = 0; offset != stride; ++offset) {
-        const auto& array = (begin+offset)->get();
-        for(UnsignedInt i = 0; i != inputSize; ++i)
-            interleavedArrays[offset + i*stride] = array[i];
-    }
-
-    /* Combine them */
-    std::vector<UnsignedInt> combinedIndices;
-    std::tie(combinedIndices, interleavedArrays) = MeshTools::combineIndexArrays(interleavedArrays, stride);
-    return {combinedIndices, interleavedArrays};
+    /* Combine them, reading directly from the original arrays instead of
+       interleaving them first */
+    std::vector<const UnsignedInt*> arrays;
+    arrays.reserve(stride);
+    for(auto it = begin; it != end; ++it) arrays.push_back(it->get().data());
+    return combine(inputSize, stride, [&arrays](std::size_t i, UnsignedInt offset) {
+        return arrays[offset][i];
+    });
 }
 
 std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* const begin, const std::reference_wrapper<std::vector<UnsignedInt>>* const end) {
@@ -85,72 +164,14 @@ std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::ve
 
 }
 
-namespace {
-
-class IndexHash {
-    public:
-        explicit IndexHash(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        std::size_t operator()(UnsignedInt key) const {
-            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(indices.data()+key*stride), sizeof(UnsignedInt)*stride).byteArray());
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
-
-class IndexEqual {
-    public:
-        explicit IndexEqual(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        bool operator()(UnsignedInt a, UnsignedInt b) const {
-            return std::memcmp(indices.data()+a*stride, indices.data()+b*stride, sizeof(UnsignedInt)*stride) == 0;
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
-
-}
-
 std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride) {
     CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArrays(): stride can't be zero", {});
     CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArrays(): array size is not divisible by stride", {});
 
-    /* Hash map with index combinations, containing just indices into
-       interleavedArrays vector, hashing and comparison is done using IndexHash
-       and IndexEqual functors. Reserving more buckets than necessary (i.e. as
-       if each combination was unique). */
-    std::unordered_map<UnsignedInt, UnsignedInt, IndexHash, IndexEqual> indexCombinations(
-        interleavedArrays.size()/stride,
-        IndexHash(interleavedArrays, stride),
-        IndexEqual(interleavedArrays, stride));
-
-    /* Make the index combinations unique. Original indices into original
-       `interleavedArrays` array were 0, 1, 2, 3, ..., `combinedIndices`
-       contains new ones into new (shorter) `newInterleavedArrays` array. */
-    std::vector<UnsignedInt> combinedIndices;
-    combinedIndices.reserve(interleavedArrays.size()/stride);
-    std::vector<UnsignedInt> newInterleavedArrays;
-    for(std::size_t oldIndex = 0, end = interleavedArrays.size()/stride; oldIndex != end; ++oldIndex) {
-        /* Try to insert new index combination to the map */
-        const auto result = indexCombinations.emplace(oldIndex, indexCombinations.size());
-
-        /* Add the (either new or already existing) index to resulting index array */
-        combinedIndices.push_back(result.first->second);
-
-        /* If this is new combination, copy it to new interleaved arrays */
-        if(result.second) newInterleavedArrays.insert(newInterleavedArrays.end(),
-            interleavedArrays.begin()+oldIndex*stride,
-            interleavedArrays.begin()+(oldIndex+1)*stride);
-    }
-
-    CORRADE_INTERNAL_ASSERT(combinedIndices.size() == interleavedArrays.size()/stride &&
-                            newInterleavedArrays.size() <= interleavedArrays.size());
-
-    return {std::move(combinedIndices), std::move(newInterleavedArrays)};
+    const UnsignedInt* const data = interleavedArrays.data();
+    return combine(interleavedArrays.size()/stride, stride, [data, stride](std::size_t i, UnsignedInt offset) {
+        return data[i*stride + offset];
+    });
 }
 
 }}
@@ -78,9 +78,10 @@ which can be then indexed with the combined index array:
 Again, first triangle in the mesh will have positions `a c f` and normals
 `B D E`.
 
-This function calls @ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt)
-internally. See also @ref combineIndexedArrays() which does the vertex data
-reordering automatically.
+The combinations are looked up directly in the original arrays, so unlike
+@ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt) there
+is no need to interleave them first. See also @ref combineIndexedArrays()
+which does the vertex data reordering automatically.
 */
 inline std::vector<UnsignedInt> combineIndexArrays(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& arrays) {
     return Implementation::combineIndexArrays(&arrays[0], &arrays[0] + arrays.size());
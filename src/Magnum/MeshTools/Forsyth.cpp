@@ -0,0 +1,183 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Forsyth.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Constants from the original paper, tuned for cache sizes around 32 */
+constexpr Float CacheDecayPower = 1.5f;
+constexpr Float LastTriangleScore = 0.75f;
+constexpr Float ValenceBoostScale = 2.0f;
+constexpr Float ValenceBoostPower = 0.5f;
+
+constexpr UnsignedInt NotFound = ~UnsignedInt{};
+
+/* Precomputed score tables, the valence boost is computed only for vertices
+   with many remaining triangles */
+class VertexScore {
+    public:
+        explicit VertexScore(std::size_t cacheSize);
+
+        Float operator()(std::size_t cachePosition, UnsignedInt liveTriangleCount) const {
+            /* No triangles remaining, the vertex isn't needed anymore */
+            if(!liveTriangleCount) return -1.0f;
+
+            Float score = cachePosition < _cacheScore.size() ? _cacheScore[cachePosition] : 0.0f;
+
+            /* Bonus for vertices with only a few remaining triangles, so they
+               are finished first */
+            score += liveTriangleCount < _valenceScore.size() ? _valenceScore[liveTriangleCount] :
+                ValenceBoostScale*std::pow(Float(liveTriangleCount), -ValenceBoostPower);
+
+            return score;
+        }
+
+    private:
+        std::vector<Float> _cacheScore, _valenceScore;
+};
+
+VertexScore::VertexScore(const std::size_t cacheSize): _cacheScore(cacheSize), _valenceScore(32) {
+    for(std::size_t i = 0; i != cacheSize; ++i) {
+        /* Vertices of the last triangle get a fixed score so the next
+           triangle doesn't prefer vertices of the triangle just emitted */
+        if(i < 3) _cacheScore[i] = LastTriangleScore;
+        else _cacheScore[i] = std::pow(1.0f - Float(i - 3)/(cacheSize - 3), CacheDecayPower);
+    }
+
+    for(std::size_t i = 1; i != _valenceScore.size(); ++i)
+        _valenceScore[i] = ValenceBoostScale*std::pow(Float(i), -ValenceBoostPower);
+}
+
+}
+
+void forsyth(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::forsyth(): index count is not divisible by 3", );
+    CORRADE_ASSERT(cacheSize > 3, "MeshTools::forsyth(): cache size must be larger than 3", );
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::Tipsify(indices, vertexCount).buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+    /* Initial vertex and triangle scores, no vertex is in the cache yet */
+    const VertexScore vertexScore{cacheSize};
+    const std::size_t triangleCount = indices.size()/3;
+    std::vector<Float> vertexScores(vertexCount);
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        vertexScores[i] = vertexScore(cacheSize, liveTriangleCount[i]);
+    std::vector<Float> triangleScores(triangleCount);
+    UnsignedInt bestTriangle = NotFound;
+    Float bestScore = 0.0f;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        triangleScores[i] = vertexScores[indices[i*3]] + vertexScores[indices[i*3 + 1]] + vertexScores[indices[i*3 + 2]];
+        if(triangleScores[i] > bestScore) {
+            bestTriangle = i;
+            bestScore = triangleScores[i];
+        }
+    }
+
+    /* Per-triangle emitted flag, simulated LRU cache with three additional
+       slots for vertices that are pushed out of it by the new triangle */
+    std::vector<bool> emitted(triangleCount);
+    std::vector<UnsignedInt> cache, newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+
+    /* Output index buffer, all triangles before the cursor are emitted */
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+    std::size_t cursor = 0;
+
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        /* On dead-end take the highest-scoring triangle that isn't emitted
+           yet. The scores of triangles outside of the cache are up-to-date,
+           as they were last updated when their vertices got pushed out. */
+        if(bestTriangle == NotFound) {
+            while(emitted[cursor]) ++cursor;
+            bestTriangle = cursor;
+            for(std::size_t t = cursor + 1; t != triangleCount; ++t) {
+                if(!emitted[t] && triangleScores[t] > triangleScores[bestTriangle])
+                    bestTriangle = t;
+            }
+        }
+
+        /* Emit the triangle and put its vertices to the front of the cache */
+        emitted[bestTriangle] = true;
+        newCache.clear();
+        for(std::size_t vi = 0; vi != 3; ++vi) {
+            const UnsignedInt v = indices[bestTriangle*3 + vi];
+            outputIndices.push_back(v);
+            --liveTriangleCount[v];
+
+            /* Degenerate triangles can have the same vertex more than once */
+            if(std::find(newCache.begin(), newCache.end(), v) == newCache.end())
+                newCache.push_back(v);
+        }
+        const std::size_t triangleVertexCount = newCache.size();
+        for(const UnsignedInt v: cache)
+            if(std::find(newCache.begin(), newCache.begin() + triangleVertexCount, v) == newCache.begin() + triangleVertexCount)
+                newCache.push_back(v);
+        std::swap(cache, newCache);
+
+        /* Update scores of all vertices in the cache, including the ones that
+           just got pushed out of it */
+        for(std::size_t ci = 0; ci != cache.size(); ++ci)
+            vertexScores[cache[ci]] = vertexScore(ci, liveTriangleCount[cache[ci]]);
+
+        /* Update scores of their remaining triangles and find the best one
+           for next iteration */
+        bestTriangle = NotFound;
+        bestScore = 0.0f;
+        for(const UnsignedInt v: cache) {
+            for(std::size_t ti = neighborOffset[v]; ti != neighborOffset[v + 1]; ++ti) {
+                const UnsignedInt t = neighbors[ti];
+                if(emitted[t]) continue;
+
+                triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+                if(triangleScores[t] > bestScore) {
+                    bestTriangle = t;
+                    bestScore = triangleScores[t];
+                }
+            }
+        }
+
+        /* Remove the vertices that got pushed out */
+        if(cache.size() > cacheSize) cache.resize(cacheSize);
+    }
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+}}
@@ -0,0 +1,65 @@
+#ifndef Magnum_MeshTools_Forsyth_h
+#define Magnum_MeshTools_Forsyth_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::forsyth()
+ */
+
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for post-transform vertex cache using Forsyth's algorithm
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Post-transform vertex cache size
+
+Similarly to @ref tipsify() rearranges the index array for better usage of
+post-transform vertex cache. The triangles are emitted greedily based on a
+score computed from position of their vertices in a simulated LRU cache and
+count of their remaining triangles, so vertices with only few remaining
+triangles are finished first. Algorithm used: *Tom Forsyth - Linear-Speed
+Vertex Cache Optimisation, 2006,
+https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*.
+
+Compared to @ref tipsify() it's considerably slower and whether it produces
+lower cache miss ratio depends on the mesh. On regular grids tipsify() is
+usually better, on meshes with irregular triangle order and small caches
+forsyth() may win. It doesn't optimize for overdraw. Use
+@ref analyzeVertexCache() to compare the results for particular mesh. The
+function requires the mesh to have triangle faces, thus index count must be
+divisible by 3, and @p cacheSize must be larger than 3.
+*/
+MAGNUM_MESHTOOLS_EXPORT void forsyth(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+}}
+
+#endif
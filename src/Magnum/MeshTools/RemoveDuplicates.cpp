@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RemoveDuplicates.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Hashes the data eight bytes at a time, the remaining bytes are zero-padded */
+UnsignedInt hashItem(const char* const data, const std::size_t size) {
+    constexpr std::uint64_t Multiplier = 0x9e3779b97f4a7c15ull;
+    std::uint64_t hash = size;
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word)*Multiplier;
+        hash ^= hash >> 32;
+    }
+    if(i != size) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data + i, size - i);
+        hash = (hash ^ word)*Multiplier;
+        hash ^= hash >> 32;
+    }
+
+    return UnsignedInt(hash);
+}
+
+/* Hash of the item is saved alongside its index so the items need to be
+   compared only on full hash match and the table can be grown without
+   rehashing the data */
+struct Slot {
+    UnsignedInt hash;
+    UnsignedInt index;
+};
+
+constexpr UnsignedInt Empty = ~UnsignedInt{};
+
+}
+
+std::pair<std::vector<UnsignedInt>, std::size_t> removeExactDuplicates(const Containers::ArrayView<char> data, const std::size_t stride) {
+    CORRADE_ASSERT(stride != 0, "MeshTools::removeExactDuplicates(): stride can't be zero", {});
+    CORRADE_ASSERT(data.size() % stride == 0, "MeshTools::removeExactDuplicates(): data size is not divisible by stride", {});
+    const std::size_t dataCount = data.size()/stride;
+    CORRADE_ASSERT(dataCount < Empty, "MeshTools::removeExactDuplicates(): too many items", {});
+
+    /* The table is kept at most half full and grows with count of unique
+       items, not the total count */
+    std::vector<Slot> table(1024, Slot{0, Empty});
+    std::size_t mask = table.size() - 1;
+
+    std::vector<UnsignedInt> indices(dataCount);
+    std::size_t uniqueCount = 0;
+    for(std::size_t i = 0; i != dataCount; ++i) {
+        const char* const item = data.data() + i*stride;
+        const UnsignedInt hash = hashItem(item, stride);
+
+        /* Find the item in the table, stop at first empty slot */
+        std::size_t slot = hash & mask;
+        for(; table[slot].index != Empty; slot = (slot + 1) & mask) {
+            if(table[slot].hash == hash && std::memcmp(data.data() + table[slot].index*stride, item, stride) == 0)
+                break;
+        }
+
+        /* Already there */
+        if(table[slot].index != Empty) {
+            indices[i] = table[slot].index;
+            continue;
+        }
+
+        /* New unique item, move it to new (earlier) position in the array */
+        if(uniqueCount != i)
+            std::memcpy(data.data() + uniqueCount*stride, item, stride);
+        indices[i] = UnsignedInt(uniqueCount);
+        table[slot] = Slot{hash, UnsignedInt(uniqueCount)};
+        ++uniqueCount;
+
+        /* Grow the table if it's more than half full, the slots are
+           reinserted using the saved hashes */
+        if(uniqueCount*2 > table.size()) {
+            std::vector<Slot> grown(table.size()*2, Slot{0, Empty});
+            mask = grown.size() - 1;
+            for(const Slot& s: table) {
+                if(s.index == Empty) continue;
+                std::size_t j = s.hash & mask;
+                while(grown[j].index != Empty) j = (j + 1) & mask;
+                grown[j] = s;
+            }
+            table = std::move(grown);
+        }
+    }
+
+    return {std::move(indices), uniqueCount};
+}
+
+}}
@@ -26,17 +26,20 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::removeDuplicates()
+ * @brief Function @ref Magnum::MeshTools::removeDuplicates(), @ref Magnum::MeshTools::removeNearDuplicates(), @ref Magnum::MeshTools::removeExactDuplicates()
  */
 
 #include <limits>
 #include <numeric>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -47,6 +50,14 @@ namespace Implementation {
                 return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(&data), sizeof(data)).byteArray());
             }
     };
+
+    /* Spatial hash of grid cell coordinates for the open-addressing table */
+    template<std::size_t size> inline std::size_t cellHash(const Math::Vector<size, std::size_t>& cell) {
+        std::size_t hash = 0;
+        for(std::size_t i = 0; i != size; ++i)
+            hash = (hash ^ cell[i])*std::size_t(11400714819323198485ull);
+        return hash ^ (hash >> (sizeof(std::size_t)*4));
+    }
 }
 
 /**
@@ -60,7 +71,8 @@ Removes duplicate data from the array by collapsing them into buckets of size
 @p epsilon. First vector in given bucket is used, other ones are thrown away,
 no interpolation is done. Note that this function is meant to be used for
 floating-point data (or generally with non-zero @p epsilon), for discrete data
-the usual sorting method is much more efficient.
+or data that need to be merged only if they are exactly the same use
+@ref removeExactDuplicates(), which is much more efficient.
 
 If you want to remove duplicate data from already indexed array, first remove
 duplicates as if the array wasn't indexed at all and then use @ref duplicate()
@@ -91,6 +103,10 @@ std::vector<UnsignedInt> indices = MeshTools::combineIndexedArrays(
     std::make_pair(std::cref(texCoordIndices), std::ref(texCoords))
 );
 @endcode
+
+For large data it's faster and needs less memory to use
+@ref removeNearDuplicates(), which does a single pass over the data instead
+of `Vector::Size + 1`.
 */
 template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
     /* Get bounds */
@@ -157,6 +173,176 @@ template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vec
     return resultIndices;
 }
 
+/**
+@brief Remove near duplicate vector data from given array in a single pass
+@param[in,out] data Input data array
+@param[out] epsilon Epsilon value, vertices nearer than this distance will be
+    melt together
+@return Index array and unique data
+
+Similar to @ref removeDuplicates(), but instead of collapsing the data into
+buckets in `Vector::Size + 1` passes it goes through the data only
+once. Each vector is put into a spatial hash with cells of size `4*epsilon`
+and compared only with already found unique vectors in the same cell and in
+the neighboring cells nearer than @p epsilon. The vector is then replaced with
+the first of them which is nearer than @p epsilon, if any. Unlike
+@ref removeDuplicates() the result thus doesn't depend on positions of bucket
+boundaries.
+
+The hash table is open-addressed with linear probing and contains only
+indices of the unique vectors, so the memory needed in addition to the
+resulting index array is at most four indices per unique vector. Note that this
+function is meant to be used for floating-point data (or generally with
+non-zero @p epsilon), for discrete data use @ref removeExactDuplicates().
+*/
+template<class Vector> std::vector<UnsignedInt> removeNearDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
+    if(data.empty()) return {};
+
+    /* Get bounds */
+    Vector min = data[0], max = data[0];
+    for(const auto& v: data) {
+        min = Math::min(v, min);
+        max = Math::max(v, max);
+    }
+
+    /* Make epsilon so large that std::size_t can index all cells inside the
+       bounds. */
+    epsilon = Math::max(epsilon, typename Vector::Type((max-min).max()/std::numeric_limits<std::size_t>::max()));
+    const typename Vector::Type cellSize = epsilon*4;
+    const typename Vector::Type epsilonSquared = epsilon*epsilon;
+
+    /* Table with indices of unique vectors. It's kept at most half full so
+       the probe sequences stay short and grows with the count of unique
+       vectors, not the total count, so it stays small and cache-friendly for
+       data with many duplicates. */
+    constexpr UnsignedInt Empty = ~UnsignedInt{};
+    std::vector<UnsignedInt> table(1024, Empty);
+    std::size_t mask = table.size() - 1;
+    auto insert = [&](const UnsignedInt index) {
+        const Math::Vector<Vector::Size, std::size_t> cell((data[index] - min)/cellSize);
+        std::size_t slot = Implementation::cellHash(cell) & mask;
+        while(table[slot] != Empty) slot = (slot + 1) & mask;
+        table[slot] = index;
+    };
+
+    std::vector<UnsignedInt> indices(data.size());
+    std::size_t uniqueCount = 0;
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        const Vector v = data[i];
+        const Vector relative = v - min;
+        const Math::Vector<Vector::Size, std::size_t> cell(relative/cellSize);
+
+        /* Neighbor cells need to be searched only in directions in which the
+           vector is nearer than epsilon to the cell boundary */
+        std::size_t neighbors = 0, lower = 0;
+        for(std::size_t j = 0; j != Vector::Size; ++j) {
+            const typename Vector::Type offset = relative[j] - typename Vector::Type(cell[j])*cellSize;
+            if(offset < epsilon) {
+                if(cell[j] == 0) continue;
+                neighbors |= 1 << j;
+                lower |= 1 << j;
+            } else if(cellSize - offset <= epsilon) neighbors |= 1 << j;
+        }
+
+        /* Go through the cell and the neighbors, find the first unique vector
+           near enough */
+        UnsignedInt found = Empty;
+        for(std::size_t neighbor = 0; neighbor != 1 << Vector::Size; ++neighbor) {
+            if(neighbor & ~neighbors) continue;
+
+            Math::Vector<Vector::Size, std::size_t> neighborCell = cell;
+            for(std::size_t j = 0; j != Vector::Size; ++j) {
+                if(!(neighbor & (1 << j))) continue;
+                if(lower & (1 << j)) --neighborCell[j];
+                else ++neighborCell[j];
+            }
+
+            /* The probe sequence can contain vectors from other cells as
+               well, those near enough are valid candidates too */
+            for(std::size_t slot = Implementation::cellHash(neighborCell) & mask; table[slot] != Empty; slot = (slot + 1) & mask) {
+                const UnsignedInt candidate = table[slot];
+                if(candidate < found && (data[candidate] - v).dot() < epsilonSquared)
+                    found = candidate;
+            }
+        }
+
+        /* New unique vector, move it to new (earlier) position in the array
+           and put it into the table */
+        if(found == Empty) {
+            found = UnsignedInt(uniqueCount);
+            data[uniqueCount++] = v;
+
+            /* Grow the table if it would get more than half full and
+               reinsert all unique vectors */
+            if(uniqueCount*2 > table.size()) {
+                table.assign(table.size()*2, Empty);
+                mask = table.size() - 1;
+                for(std::size_t j = 0; j != uniqueCount - 1; ++j)
+                    insert(UnsignedInt(j));
+            }
+
+            insert(found);
+        }
+
+        indices[i] = found;
+    }
+
+    data.resize(uniqueCount);
+    return indices;
+}
+
+/**
+@brief Remove exact duplicates from interleaved data
+@param[in,out] data     Interleaved data
+@param[in] stride       Size of one item in the data
+@return Index array and count of unique items
+
+Removes items which are bitwise equal to some previous item in the data. The
+unique items are moved to the beginning of @p data in order of their first
+occurrence, the rest of the data is left in unspecified state. The returned
+index array has the same meaning as with @ref removeDuplicates(), the items
+are compared and hashed byte-by-byte in an open-addressed hash table, which
+contains only the unique items and thus for data with many duplicates needs
+much less memory than the data itself. Expects that @p stride is not zero and
+size of @p data is divisible by it. Useful for example for deduplicating the
+output of @ref interleave():
+@code
+Containers::Array<char> vertexData = MeshTools::interleave(positions, normals, textureCoordinates);
+std::size_t stride = vertexData.size()/positions.size();
+
+std::vector<UnsignedInt> vertexIndices;
+std::size_t vertexCount;
+std::tie(vertexIndices, vertexCount) = MeshTools::removeExactDuplicates(vertexData, stride);
+
+indices = MeshTools::duplicate(indices, vertexIndices);
+@endcode
+
+As the comparison is bitwise, the data shouldn't contain any padding bytes
+with undefined contents. Floating-point values are also compared bitwise, so
+e.g. `0.0f` and `-0.0f` are treated as different values and `NaN`s with the
+same representation are merged together.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::size_t> removeExactDuplicates(Containers::ArrayView<char> data, std::size_t stride);
+
+/**
+@brief Remove exact duplicates from given array
+@param[in,out] data     Input data array
+@return Index array and unique data
+
+Similar to @ref removeDuplicates(), but the items are merged only if they are
+bitwise equal. Suitable for data of arbitrary trivially copyable type without
+padding, such as integer vectors, indices or already welded floating-point
+data. See @ref removeExactDuplicates(Containers::ArrayView<char>, std::size_t)
+for more information.
+*/
+template<class T> std::vector<UnsignedInt> removeExactDuplicates(std::vector<T>& data) {
+    std::vector<UnsignedInt> indices;
+    std::size_t uniqueCount;
+    std::tie(indices, uniqueCount) = removeExactDuplicates({reinterpret_cast<char*>(data.data()), data.size()*sizeof(T)}, sizeof(T));
+    data.resize(uniqueCount);
+    return indices;
+}
+
 }}
 
 #endif
@@ -0,0 +1,76 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ReorderVertices.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Magnum { namespace MeshTools {
+
+std::vector<UnsignedInt> reorderVertices(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    /* New index for each original vertex */
+    constexpr UnsignedInt Unused = ~UnsignedInt{};
+    std::vector<UnsignedInt> newIndices(vertexCount, Unused);
+
+    /* Original index for each new vertex, in order of first use */
+    std::vector<UnsignedInt> mapping;
+    mapping.reserve(vertexCount);
+    for(const UnsignedInt index: indices) {
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::reorderVertices(): index" << index << "out of bounds for" << vertexCount << "vertices", {});
+        if(newIndices[index] == Unused) {
+            newIndices[index] = mapping.size();
+            mapping.push_back(index);
+        }
+    }
+
+    /* Remap the indices only after all of them are checked, so they are left
+       untouched on failure */
+    for(UnsignedInt& index: indices) index = newIndices[index];
+
+    /* Put unused vertices at the end */
+    for(UnsignedInt i = 0; i != vertexCount; ++i)
+        if(newIndices[i] == Unused) mapping.push_back(i);
+
+    return mapping;
+}
+
+void reorderVertices(std::vector<UnsignedInt>& indices, const Containers::ArrayView<char> data, const std::size_t stride) {
+    CORRADE_ASSERT(stride != 0, "MeshTools::reorderVertices(): stride can't be zero", );
+    CORRADE_ASSERT(data.size() % stride == 0, "MeshTools::reorderVertices(): data size is not divisible by stride", );
+
+    const std::vector<UnsignedInt> mapping = reorderVertices(indices, data.size()/stride);
+
+    /* The indices are out of bounds, leave the data untouched */
+    if(mapping.size() != data.size()/stride) return;
+
+    /* Copy the vertices in new order to a temporary array and then back */
+    std::vector<char> reordered(data.size());
+    for(std::size_t i = 0; i != mapping.size(); ++i)
+        std::memcpy(reordered.data() + i*stride, data.data() + mapping[i]*stride, stride);
+    std::copy(reordered.begin(), reordered.end(), data.begin());
+}
+
+}}
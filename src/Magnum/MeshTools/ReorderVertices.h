@@ -0,0 +1,134 @@
+#ifndef Magnum_MeshTools_ReorderVertices_h
+#define Magnum_MeshTools_ReorderVertices_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::reorderVertices()
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Reorder vertices for better vertex fetch locality
+@param[in,out] indices  Index array to operate on
+@param[in] vertexCount  Vertex count
+@return Original vertex index for each new vertex
+
+Remaps the index array so the vertices are numbered in order in which they
+are first used by it. Vertices that are not referenced by the index array
+are put at the end in their original order. The vertex data can then be
+reordered using the returned array and @ref duplicate(), so the GPU fetches
+them mostly sequentially when drawing the mesh:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> mapping = MeshTools::reorderVertices(indices, positions.size());
+positions = MeshTools::duplicate(mapping, positions);
+@endcode
+
+The index order isn't changed, so it's best to use this function after
+index optimization using @ref tipsify() or @ref forsyth(). All indices must be
+smaller than @p vertexCount. See also @ref reorderVertices(std::vector<UnsignedInt>&, std::vector<T>&, std::vector<U>&...)
+and @ref reorderVertices(std::vector<UnsignedInt>&, Containers::ArrayView<char>, std::size_t),
+which reorder the vertex data automatically.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> reorderVertices(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+/**
+@brief Reorder interleaved vertex data for better vertex fetch locality
+@param[in,out] indices  Index array to operate on
+@param[in,out] data     Interleaved vertex data
+@param[in] stride       Size of one vertex in the data
+
+Remaps the index array and reorders vertices in the interleaved data in
+place, for example output of @ref interleave(). See
+@ref reorderVertices(std::vector<UnsignedInt>&, UnsignedInt) for more
+information. Expects that @p stride is not zero and size of @p data is
+divisible by it.
+*/
+MAGNUM_MESHTOOLS_EXPORT void reorderVertices(std::vector<UnsignedInt>& indices, Containers::ArrayView<char> data, std::size_t stride);
+
+namespace Implementation {
+
+/* Terminators for recursive calls */
+inline bool vertexArraysHaveSize(std::size_t) { return true; }
+inline void reorderVertexArrays(const std::vector<UnsignedInt>&) {}
+
+template<class T, class ...U> bool vertexArraysHaveSize(const std::size_t size, const std::vector<T>& first, const std::vector<U>&... next) {
+    return first.size() == size && vertexArraysHaveSize(size, next...);
+}
+
+template<class T, class ...U> void reorderVertexArrays(const std::vector<UnsignedInt>& mapping, std::vector<T>& first, std::vector<U>&... next) {
+    first = duplicate(mapping, first);
+    reorderVertexArrays(mapping, next...);
+}
+
+}
+
+/**
+@brief Reorder vertex attribute arrays for better vertex fetch locality
+@param[in,out] indices  Index array to operate on
+@param[in,out] first    First attribute array
+@param[in,out] next     Next attribute arrays
+
+Remaps the index array and reorders all attribute arrays accordingly. All
+attribute arrays are expected to have the same size. Example:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector3> normals;
+
+MeshTools::tipsify(indices, positions.size(), 24);
+MeshTools::reorderVertices(indices, positions, normals);
+@endcode
+
+See @ref reorderVertices(std::vector<UnsignedInt>&, UnsignedInt) for more
+information.
+*/
+template<class T, class ...U> void reorderVertices(std::vector<UnsignedInt>& indices, std::vector<T>& first, std::vector<U>&... next) {
+    CORRADE_ASSERT(Implementation::vertexArraysHaveSize(first.size(), next...),
+        "MeshTools::reorderVertices(): the attribute arrays don't have the same size", );
+
+    const std::vector<UnsignedInt> mapping = reorderVertices(indices, first.size());
+
+    /* The indices are out of bounds, leave the arrays untouched */
+    if(mapping.size() != first.size()) return;
+
+    Implementation::reorderVertexArrays(mapping, first, next...);
+}
+
+}}
+
+#endif
@@ -0,0 +1,113 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/AnalyzeVertexCache.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct AnalyzeVertexCacheTest: TestSuite::Tester {
+    explicit AnalyzeVertexCacheTest();
+
+    void fifo();
+    void lru();
+    void empty();
+    void wrongIndexCount();
+    void zeroCacheSize();
+    void indexOutOfBounds();
+};
+
+AnalyzeVertexCacheTest::AnalyzeVertexCacheTest() {
+    addTests({&AnalyzeVertexCacheTest::fifo,
+              &AnalyzeVertexCacheTest::lru,
+              &AnalyzeVertexCacheTest::empty,
+              &AnalyzeVertexCacheTest::wrongIndexCount,
+              &AnalyzeVertexCacheTest::zeroCacheSize,
+              &AnalyzeVertexCacheTest::indexOutOfBounds});
+}
+
+namespace {
+    /* Vertex 0 is used again after one miss, vertex 1 after four misses */
+    const std::vector<UnsignedInt> Indices{
+        0, 1, 2,
+        0, 3, 4,
+        0, 1, 5
+    };
+}
+
+void AnalyzeVertexCacheTest::fifo() {
+    /* Vertex 0 is pushed out by the 3 and 4 misses even though it was used
+       in the meantime */
+    const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache(Indices, 6, 3, VertexCacheType::Fifo);
+    CORRADE_COMPARE(statistics.cacheMissCount, 8);
+    CORRADE_COMPARE(statistics.acmr, 8.0f/3.0f);
+    CORRADE_COMPARE(statistics.atvr, 8.0f/6.0f);
+}
+
+void AnalyzeVertexCacheTest::lru() {
+    /* Using vertex 0 again moves it to the front, so it stays in the cache */
+    const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache(Indices, 6, 3, VertexCacheType::Lru);
+    CORRADE_COMPARE(statistics.cacheMissCount, 7);
+    CORRADE_COMPARE(statistics.acmr, 7.0f/3.0f);
+    CORRADE_COMPARE(statistics.atvr, 7.0f/6.0f);
+}
+
+void AnalyzeVertexCacheTest::empty() {
+    const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache({}, 0, 16);
+    CORRADE_COMPARE(statistics.cacheMissCount, 0);
+    CORRADE_COMPARE(statistics.acmr, 0.0f);
+    CORRADE_COMPARE(statistics.atvr, 0.0f);
+}
+
+void AnalyzeVertexCacheTest::wrongIndexCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache({0, 1}, 2, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::analyzeVertexCache(): index count is not divisible by 3\n");
+}
+
+void AnalyzeVertexCacheTest::zeroCacheSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Indices, 6, 0);
+    CORRADE_COMPARE(out.str(), "MeshTools::analyzeVertexCache(): cache size can't be zero\n");
+}
+
+void AnalyzeVertexCacheTest::indexOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Indices, 5, 16, VertexCacheType::Fifo);
+    MeshTools::analyzeVertexCache(Indices, 5, 16, VertexCacheType::Lru);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::analyzeVertexCache(): index 5 out of bounds for 5 vertices\n"
+        "MeshTools::analyzeVertexCache(): index 5 out of bounds for 5 vertices\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::AnalyzeVertexCacheTest)
@@ -0,0 +1,153 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <unordered_map>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/CombineIndexedArrays.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+/* Compares combineIndexArrays() with the previous implementation based on
+   std::unordered_map on index arrays of a large OBJ-like mesh */
+struct CombineIndexedArraysBenchmark: TestSuite::Tester {
+    explicit CombineIndexedArraysBenchmark();
+
+    void grid();
+};
+
+CombineIndexedArraysBenchmark::CombineIndexedArraysBenchmark() {
+    addTests({&CombineIndexedArraysBenchmark::grid});
+}
+
+namespace {
+
+/* The previous implementation, interleaving the arrays first and using
+   MurmurHash2 of the whole combination in std::unordered_map */
+class IndexHash {
+    public:
+        explicit IndexHash(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
+
+        std::size_t operator()(UnsignedInt key) const {
+            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(indices.data()+key*stride), sizeof(UnsignedInt)*stride).byteArray());
+        }
+
+    private:
+        const std::vector<UnsignedInt>& indices;
+        UnsignedInt stride;
+};
+
+class IndexEqual {
+    public:
+        explicit IndexEqual(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
+
+        bool operator()(UnsignedInt a, UnsignedInt b) const {
+            return std::memcmp(indices.data()+a*stride, indices.data()+b*stride, sizeof(UnsignedInt)*stride) == 0;
+        }
+
+    private:
+        const std::vector<UnsignedInt>& indices;
+        UnsignedInt stride;
+};
+
+std::vector<UnsignedInt> combineIndexArraysUnorderedMap(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& arrays) {
+    const UnsignedInt stride = arrays.size();
+    const std::size_t inputSize = arrays[0].get().size();
+    std::vector<UnsignedInt> interleavedArrays(inputSize*stride);
+    for(UnsignedInt offset = 0; offset != stride; ++offset)
+        for(std::size_t i = 0; i != inputSize; ++i)
+            interleavedArrays[offset + i*stride] = arrays[offset].get()[i];
+
+    std::unordered_map<UnsignedInt, UnsignedInt, IndexHash, IndexEqual> indexCombinations(
+        inputSize,
+        IndexHash(interleavedArrays, stride),
+        IndexEqual(interleavedArrays, stride));
+
+    std::vector<UnsignedInt> combinedIndices;
+    combinedIndices.reserve(inputSize);
+    std::vector<UnsignedInt> newInterleavedArrays;
+    for(std::size_t oldIndex = 0; oldIndex != inputSize; ++oldIndex) {
+        const auto result = indexCombinations.emplace(oldIndex, indexCombinations.size());
+        combinedIndices.push_back(result.first->second);
+        if(result.second) newInterleavedArrays.insert(newInterleavedArrays.end(),
+            interleavedArrays.begin()+oldIndex*stride,
+            interleavedArrays.begin()+(oldIndex+1)*stride);
+    }
+
+    const std::size_t outputSize = newInterleavedArrays.size()/stride;
+    for(UnsignedInt offset = 0; offset != stride; ++offset) {
+        std::vector<UnsignedInt>& array = arrays[offset].get();
+        array.resize(outputSize);
+        for(std::size_t i = 0; i != outputSize; ++i)
+            array[i] = newInterleavedArrays[offset + i*stride];
+    }
+
+    return combinedIndices;
+}
+
+}
+
+void CombineIndexedArraysBenchmark::grid() {
+    /* Grid of 1000x1000 quads as exported to OBJ, positions and texture
+       coordinates shared by neighboring faces, one normal per face */
+    constexpr UnsignedInt Size = 1000;
+    std::vector<UnsignedInt> positions, normals, textureCoordinates;
+    for(UnsignedInt y = 0; y != Size; ++y) for(UnsignedInt x = 0; x != Size; ++x) {
+        const UnsignedInt corners[]{
+            y*(Size + 1) + x, y*(Size + 1) + x + 1,
+            (y + 1)*(Size + 1) + x + 1, (y + 1)*(Size + 1) + x};
+        for(UnsignedInt i: {0, 1, 2, 0, 2, 3}) {
+            positions.push_back(corners[i]);
+            normals.push_back(y*Size + x);
+            textureCoordinates.push_back(corners[i]);
+        }
+    }
+
+    std::vector<UnsignedInt> positionsBefore = positions, normalsBefore = normals, textureCoordinatesBefore = textureCoordinates;
+    std::vector<UnsignedInt> before;
+    Magnum::Test::benchmark("std::unordered_map:", [&]() {
+        before = combineIndexArraysUnorderedMap({positionsBefore, normalsBefore, textureCoordinatesBefore});
+    });
+
+    std::vector<UnsignedInt> after;
+    Magnum::Test::benchmark("combineIndexArrays():", [&]() {
+        after = MeshTools::combineIndexArrays({positions, normals, textureCoordinates});
+    });
+
+    /* Each face has four unique vertices */
+    CORRADE_COMPARE(positions.size(), 4*Size*Size);
+    CORRADE_VERIFY(after == before);
+    CORRADE_VERIFY(positions == positionsBefore);
+    CORRADE_VERIFY(normals == normalsBefore);
+    CORRADE_VERIFY(textureCoordinates == textureCoordinatesBefore);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CombineIndexedArraysBenchmark)
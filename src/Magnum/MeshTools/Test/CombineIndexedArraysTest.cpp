@@ -36,13 +36,19 @@ struct CombineIndexedArraysTest: TestSuite::Tester {
     explicit CombineIndexedArraysTest();
 
     void wrongIndexCount();
+    void wrongStride();
     void indexArrays();
+    void indexArraysLarge();
+    void interleavedIndexArrays();
     void indexedArrays();
 };
 
 CombineIndexedArraysTest::CombineIndexedArraysTest() {
     addTests({&CombineIndexedArraysTest::wrongIndexCount,
+              &CombineIndexedArraysTest::wrongStride,
               &CombineIndexedArraysTest::indexArrays,
+              &CombineIndexedArraysTest::indexArraysLarge,
+              &CombineIndexedArraysTest::interleavedIndexArrays,
               &CombineIndexedArraysTest::indexedArrays});
 }
 
@@ -56,6 +62,17 @@ void CombineIndexedArraysTest::wrongIndexCount() {
     CORRADE_COMPARE(ss.str(), "MeshTools::combineIndexArrays(): the arrays don't have the same size\n");
 }
 
+void CombineIndexedArraysTest::wrongStride() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    MeshTools::combineIndexArrays(std::vector<UnsignedInt>{0, 1, 0}, 0);
+    MeshTools::combineIndexArrays(std::vector<UnsignedInt>{0, 1, 0}, 2);
+
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::combineIndexArrays(): stride can't be zero\n"
+        "MeshTools::combineIndexArrays(): array size is not divisible by stride\n");
+}
+
 void CombineIndexedArraysTest::indexArrays() {
     std::vector<UnsignedInt> a{0, 1, 0};
     std::vector<UnsignedInt> b{3, 4, 3};
@@ -68,6 +85,36 @@ void CombineIndexedArraysTest::indexArrays() {
     CORRADE_COMPARE(c, (std::vector<UnsignedInt>{6, 7}));
 }
 
+void CombineIndexedArraysTest::indexArraysLarge() {
+    /* More unique combinations than the initial hash table size */
+    std::vector<UnsignedInt> a, b;
+    for(UnsignedInt i = 0; i != 10000; ++i) {
+        a.push_back(i % 3000);
+        b.push_back((i % 3000)/2);
+    }
+
+    std::vector<UnsignedInt> result = MeshTools::combineIndexArrays({a, b});
+    CORRADE_COMPARE(result.size(), 10000);
+    CORRADE_COMPARE(a.size(), 3000);
+    CORRADE_COMPARE(b.size(), 3000);
+    for(UnsignedInt i = 0; i != result.size(); ++i)
+        CORRADE_COMPARE(result[i], i % 3000);
+    for(UnsignedInt i = 0; i != a.size(); ++i) {
+        CORRADE_COMPARE(a[i], i);
+        CORRADE_COMPARE(b[i], i/2);
+    }
+}
+
+void CombineIndexedArraysTest::interleavedIndexArrays() {
+    /* Example from the documentation */
+    std::vector<UnsignedInt> result, interleaved;
+    std::tie(result, interleaved) = MeshTools::combineIndexArrays(
+        std::vector<UnsignedInt>{0, 1, 2, 3, 5, 4, 0, 1, 0, 4, 1, 6, 3, 1, 2, 3, 2, 1}, 2);
+
+    CORRADE_COMPARE(result, (std::vector<UnsignedInt>{0, 1, 2, 0, 3, 4, 5, 1, 6}));
+    CORRADE_COMPARE(interleaved, (std::vector<UnsignedInt>{0, 1, 2, 3, 5, 4, 0, 4, 1, 6, 3, 1, 2, 1}));
+}
+
 void CombineIndexedArraysTest::indexedArrays() {
     std::vector<UnsignedInt> a{0, 1, 0};
     std::vector<UnsignedInt> b{3, 4, 3};
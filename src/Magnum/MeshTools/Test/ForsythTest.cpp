@@ -0,0 +1,176 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/AnalyzeVertexCache.h"
+#include "Magnum/MeshTools/Forsyth.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct ForsythTest: TestSuite::Tester {
+    explicit ForsythTest();
+
+    void forsyth();
+    void grid();
+    void wrongIndexCount();
+    void cacheTooSmall();
+};
+
+/* The same mesh as in TipsifyTest
+
+ 0 ----- 1 ----- 2 ----- 3
+  \ 0  /  \ 7  /  \ 2  /  \
+   \  / 11 \  / 13 \  / 12 \
+    4 ----- 5 ----- 6 ----- 7
+   /  \ 3  /  \ 8  /  \ 5  /
+  / 14 \  / 9  \  / 15 \  /
+ 8 ----- 9 ---- 10 ---- 11          18 ---- 17
+  \ 4  /  \ 1  /  \ 17 /  \           \ 18  /
+   \  / 16 \  / 10 \  / 6  \           \  /
+    12 ---- 13 ---- 14 ---- 15          16
+
+*/
+
+namespace {
+    const std::vector<UnsignedInt> Indices{
+        4, 1, 0,
+        10, 9, 13,
+        6, 3, 2,
+        9, 5, 4,
+        12, 9, 8,
+        11, 7, 6,
+
+        14, 15, 11,
+        2, 1, 5,
+        10, 6, 5,
+        10, 5, 9,
+        13, 14, 10,
+        1, 4, 5,
+
+        7, 3, 6,
+        6, 2, 5,
+        9, 4, 8,
+        6, 10, 11,
+        13, 9, 12,
+        14, 11, 10,
+
+        16, 17, 18
+    };
+
+    constexpr std::size_t VertexCount = 19;
+}
+
+ForsythTest::ForsythTest() {
+    addTests({&ForsythTest::forsyth,
+              &ForsythTest::grid,
+              &ForsythTest::wrongIndexCount,
+              &ForsythTest::cacheTooSmall});
+}
+
+void ForsythTest::forsyth() {
+    std::vector<UnsignedInt> indices = Indices;
+    MeshTools::forsyth(indices, VertexCount, 4);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        16, 17, 18, /* all vertices have just one triangle */
+        4, 1, 0,
+        1, 4, 5,
+        2, 1, 5,
+        9, 5, 4,
+        9, 4, 8,
+        12, 9, 8,
+        13, 9, 12,
+        10, 9, 13,
+        10, 5, 9,
+        13, 14, 10,
+        14, 15, 11,
+        14, 11, 10,
+        6, 10, 11,
+        11, 7, 6,
+        10, 6, 5,
+        6, 2, 5,
+        6, 3, 2,
+        7, 3, 6
+    }));
+
+    CORRADE_COMPARE(MeshTools::analyzeVertexCache(Indices, VertexCount, 4).cacheMissCount, 52);
+    CORRADE_COMPARE(MeshTools::analyzeVertexCache(indices, VertexCount, 4).cacheMissCount, 26);
+}
+
+void ForsythTest::grid() {
+    /* 32x32 grid of quads with triangles in randomly looking order */
+    constexpr UnsignedInt Size = 32;
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt i = 0; i != Size*Size; ++i) {
+        const UnsignedInt quad = (i*367) % (Size*Size);
+        const UnsignedInt corner = (quad/Size)*(Size + 1) + quad % Size;
+        indices.insert(indices.end(), {corner, corner + 1, corner + Size + 2,
+                                       corner, corner + Size + 2, corner + Size + 1});
+    }
+    constexpr UnsignedInt VertexCount = (Size + 1)*(Size + 1);
+
+    std::vector<UnsignedInt> optimized = indices;
+    MeshTools::forsyth(optimized, VertexCount, 32);
+
+    /* The triangles are only reordered */
+    std::vector<std::vector<UnsignedInt>> triangles, optimizedTriangles;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        triangles.push_back({indices.begin() + i, indices.begin() + i + 3});
+        optimizedTriangles.push_back({optimized.begin() + i, optimized.begin() + i + 3});
+    }
+    std::sort(triangles.begin(), triangles.end());
+    std::sort(optimizedTriangles.begin(), optimizedTriangles.end());
+    CORRADE_VERIFY(triangles == optimizedTriangles);
+
+    /* Originally only the two triangles of each quad share vertices in the
+       cache, ideal ACMR for a grid is slightly above 0.5 */
+    CORRADE_COMPARE(MeshTools::analyzeVertexCache(indices, VertexCount, 32).acmr, 2.0f);
+    const Float acmr = MeshTools::analyzeVertexCache(optimized, VertexCount, 32).acmr;
+    CORRADE_VERIFY(acmr < 0.75f);
+}
+
+void ForsythTest::wrongIndexCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::forsyth(indices, 2, 32);
+    CORRADE_COMPARE(out.str(), "MeshTools::forsyth(): index count is not divisible by 3\n");
+}
+
+void ForsythTest::cacheTooSmall() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    std::vector<UnsignedInt> indices = Indices;
+    MeshTools::forsyth(indices, VertexCount, 3);
+    CORRADE_COMPARE(out.str(), "MeshTools::forsyth(): cache size must be larger than 3\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ForsythTest)
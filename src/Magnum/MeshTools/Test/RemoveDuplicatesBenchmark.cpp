@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <random>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Subdivide.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+/* Compares the multi-pass removeDuplicates() with the single-pass
+   removeNearDuplicates() and removeExactDuplicates() on large data */
+struct RemoveDuplicatesBenchmark: TestSuite::Tester {
+    explicit RemoveDuplicatesBenchmark();
+
+    void subdividedSphere();
+    void pointCloud();
+    void exactSubdividedSphere();
+};
+
+RemoveDuplicatesBenchmark::RemoveDuplicatesBenchmark() {
+    addTests({&RemoveDuplicatesBenchmark::subdividedSphere,
+              &RemoveDuplicatesBenchmark::pointCloud,
+              &RemoveDuplicatesBenchmark::exactSubdividedSphere});
+}
+
+namespace {
+
+Vector3 interpolator(const Vector3& a, const Vector3& b) {
+    return (a+b).normalized();
+}
+
+/* Octahedron subdivided 8 times without removing the duplicates in between,
+   with every face using its own vertices. Each vertex is there six times on
+   average. */
+std::vector<Vector3> sphereVertices() {
+    std::vector<UnsignedInt> indices{
+        0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4,
+        2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5};
+    std::vector<Vector3> positions{
+        Vector3::xAxis(), -Vector3::xAxis(),
+        Vector3::yAxis(), -Vector3::yAxis(),
+        Vector3::zAxis(), -Vector3::zAxis()};
+    for(Int i = 0; i != 8; ++i)
+        MeshTools::subdivide(indices, positions, interpolator);
+
+    return MeshTools::duplicate(indices, positions);
+}
+
+void measureRemoveDuplicates(const std::vector<Vector3>& data, const Float epsilon, std::vector<Vector3>& multiPass, std::vector<Vector3>& singlePass) {
+    multiPass = data;
+    Magnum::Test::benchmark("removeDuplicates():", [&]() {
+        MeshTools::removeDuplicates(multiPass, epsilon);
+    });
+
+    singlePass = data;
+    Magnum::Test::benchmark("removeNearDuplicates():", [&]() {
+        MeshTools::removeNearDuplicates(singlePass, epsilon);
+    });
+}
+
+}
+
+void RemoveDuplicatesBenchmark::subdividedSphere() {
+    const std::vector<Vector3> positions = sphereVertices();
+
+    std::vector<Vector3> multiPass, singlePass;
+    measureRemoveDuplicates(positions, 1.0e-5f, multiPass, singlePass);
+
+    /* Each vertex has a different position */
+    CORRADE_COMPARE(multiPass.size(), positions.size()/6 + 2);
+    CORRADE_COMPARE(singlePass.size(), positions.size()/6 + 2);
+}
+
+void RemoveDuplicatesBenchmark::pointCloud() {
+    /* Scan-like point cloud with each point measured three times with a
+       small error, in random order */
+    std::mt19937 generator;
+    std::uniform_real_distribution<Float> noise{-1.0e-4f, 1.0e-4f};
+    std::vector<Vector3> points;
+    points.reserve(3*160*160*40);
+    for(Int i = 0; i != 3; ++i)
+        for(Int x = 0; x != 160; ++x)
+            for(Int y = 0; y != 160; ++y)
+                for(Int z = 0; z != 40; ++z)
+                    points.push_back(Vector3(x, y, z)*0.01f + Vector3{noise(generator), noise(generator), noise(generator)});
+    std::shuffle(points.begin(), points.end(), generator);
+
+    std::vector<Vector3> multiPass, singlePass;
+    measureRemoveDuplicates(points, 1.0e-3f, multiPass, singlePass);
+
+    CORRADE_COMPARE(singlePass.size(), points.size()/3);
+}
+
+void RemoveDuplicatesBenchmark::exactSubdividedSphere() {
+    /* Duplicates in the sphere are bitwise equal, as is usual for imported
+       data */
+    const std::vector<Vector3> positions = sphereVertices();
+
+    std::vector<Vector3> exact = positions;
+    Magnum::Test::benchmark("removeExactDuplicates():", [&]() {
+        MeshTools::removeExactDuplicates(exact);
+    });
+
+    /* Interleaved with normals, which are the same as positions on a unit
+       sphere */
+    Containers::Array<char> interleaved = MeshTools::interleave(positions, positions);
+    std::size_t interleavedCount;
+    Magnum::Test::benchmark("removeExactDuplicates(), interleaved:", [&]() {
+        interleavedCount = MeshTools::removeExactDuplicates(interleaved, 2*sizeof(Vector3)).second;
+    });
+
+    CORRADE_COMPARE(exact.size(), positions.size()/6 + 2);
+    CORRADE_COMPARE(interleavedCount, positions.size()/6 + 2);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesBenchmark)
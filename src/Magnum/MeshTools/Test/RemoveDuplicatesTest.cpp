@@ -23,9 +23,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cmath>
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -34,10 +37,26 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     explicit RemoveDuplicatesTest();
 
     void removeDuplicates();
+    void removeNearDuplicates();
+    void removeNearDuplicatesBucketBoundary();
+    void removeNearDuplicatesEmpty();
+
+    void removeExactDuplicates();
+    void removeExactDuplicatesInterleaved();
+    void removeExactDuplicatesLarge();
+    void removeExactDuplicatesInvalidStride();
 };
 
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
-    addTests({&RemoveDuplicatesTest::removeDuplicates});
+    addTests({&RemoveDuplicatesTest::removeDuplicates,
+              &RemoveDuplicatesTest::removeNearDuplicates,
+              &RemoveDuplicatesTest::removeNearDuplicatesBucketBoundary,
+              &RemoveDuplicatesTest::removeNearDuplicatesEmpty,
+
+              &RemoveDuplicatesTest::removeExactDuplicates,
+              &RemoveDuplicatesTest::removeExactDuplicatesInterleaved,
+              &RemoveDuplicatesTest::removeExactDuplicatesLarge,
+              &RemoveDuplicatesTest::removeExactDuplicatesInvalidStride});
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -59,6 +78,115 @@ void RemoveDuplicatesTest::removeDuplicates() {
     }));
 }
 
+void RemoveDuplicatesTest::removeNearDuplicates() {
+    /* The same as above */
+    std::vector<Vector2i> data{
+        {1, 0},
+        {2, 1},
+        {0, 4},
+        {1, 5}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeNearDuplicates(data, 2);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 0, 1, 1}));
+    CORRADE_COMPARE(data, (std::vector<Vector2i>{
+        {1, 0},
+        {0, 4}
+    }));
+}
+
+void RemoveDuplicatesTest::removeNearDuplicatesBucketBoundary() {
+    /* Vectors near each other but on different sides of cell boundaries are
+       merged, the first one is kept. Vectors further than epsilon are kept. */
+    std::vector<Vector3> data{
+        {0.0f, 0.0f, 0.0f},
+        {0.199f, 0.0f, 0.0f},
+        {0.2001f, 0.2001f, 0.0f},
+        {0.1995f, 0.1995f, 0.0005f},
+        {0.0f, 0.0f, 0.0f},
+        {0.0f, 0.1f, 0.5f}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeNearDuplicates(data, 0.01f);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2, 2, 0, 3}));
+    CORRADE_COMPARE(data, (std::vector<Vector3>{
+        {0.0f, 0.0f, 0.0f},
+        {0.199f, 0.0f, 0.0f},
+        {0.2001f, 0.2001f, 0.0f},
+        {0.0f, 0.1f, 0.5f}
+    }));
+}
+
+void RemoveDuplicatesTest::removeNearDuplicatesEmpty() {
+    std::vector<Vector3> data;
+    CORRADE_VERIFY(MeshTools::removeNearDuplicates(data).empty());
+    CORRADE_VERIFY(data.empty());
+}
+
+void RemoveDuplicatesTest::removeExactDuplicates() {
+    /* Only exactly equal vectors are merged, positive and negative zero is
+       different */
+    std::vector<Vector3> data{
+        {1.0f, 0.0f, 2.0f},
+        {1.0f, 0.0f, 2.0f},
+        {1.0f, 0.0f, 2.000001f},
+        {1.0f, -0.0f, 2.0f},
+        {1.0f, 0.0f, 2.000001f},
+        {1.0f, 0.0f, 2.0f}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeExactDuplicates(data);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 0, 1, 2, 1, 0}));
+    CORRADE_COMPARE(data.size(), 3);
+    CORRADE_COMPARE(data[1], (Vector3{1.0f, 0.0f, 2.000001f}));
+    CORRADE_VERIFY(std::signbit(data[2].y()));
+}
+
+void RemoveDuplicatesTest::removeExactDuplicatesInterleaved() {
+    /* Stride not divisible by eight to test hashing of the remaining bytes */
+    char data[]{
+        'a', 'b', 'c',
+        'a', 'b', 'd',
+        'a', 'b', 'c',
+        'x', 'y', 'z',
+        'a', 'b', 'd'
+    };
+
+    std::vector<UnsignedInt> indices;
+    std::size_t count;
+    std::tie(indices, count) = MeshTools::removeExactDuplicates(data, 3);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 2, 1}));
+    CORRADE_COMPARE(count, 3);
+    CORRADE_COMPARE(std::string(data, 9), "abcabdxyz");
+}
+
+void RemoveDuplicatesTest::removeExactDuplicatesLarge() {
+    /* More unique items than the initial table size to test its growing */
+    std::vector<Vector2i> data;
+    for(Int i = 0; i != 10000; ++i)
+        data.push_back({i % 3000, (i % 3000)*7});
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeExactDuplicates(data);
+    CORRADE_COMPARE(indices.size(), 10000);
+    CORRADE_COMPARE(data.size(), 3000);
+    for(UnsignedInt i = 0; i != indices.size(); ++i)
+        CORRADE_COMPARE(indices[i], i % 3000);
+    for(Int i = 0; i != 3000; ++i)
+        CORRADE_COMPARE(data[i], (Vector2i{i, i*7}));
+}
+
+void RemoveDuplicatesTest::removeExactDuplicatesInvalidStride() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[6]{};
+    MeshTools::removeExactDuplicates(data, 0);
+    MeshTools::removeExactDuplicates(data, 4);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::removeExactDuplicates(): stride can't be zero\n"
+        "MeshTools::removeExactDuplicates(): data size is not divisible by stride\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/MeshTools/ReorderVertices.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct ReorderVerticesTest: TestSuite::Tester {
+    explicit ReorderVerticesTest();
+
+    void reorderVertices();
+    void indexOutOfBounds();
+    void attributeArrays();
+    void attributeArraysWrongSize();
+    void interleaved();
+    void interleavedWrongStride();
+    void interleavedIndexOutOfBounds();
+};
+
+ReorderVerticesTest::ReorderVerticesTest() {
+    addTests({&ReorderVerticesTest::reorderVertices,
+              &ReorderVerticesTest::indexOutOfBounds,
+              &ReorderVerticesTest::attributeArrays,
+              &ReorderVerticesTest::attributeArraysWrongSize,
+              &ReorderVerticesTest::interleaved,
+              &ReorderVerticesTest::interleavedWrongStride,
+              &ReorderVerticesTest::interleavedIndexOutOfBounds});
+}
+
+namespace {
+    /* Vertex 2 is used last, vertex 4 isn't used at all */
+    const std::vector<UnsignedInt> Indices{
+        3, 1, 3,
+        0, 1, 2
+    };
+}
+
+void ReorderVerticesTest::reorderVertices() {
+    std::vector<UnsignedInt> indices = Indices;
+    const std::vector<UnsignedInt> mapping = MeshTools::reorderVertices(indices, 5);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 0,
+        2, 1, 3
+    }));
+    CORRADE_COMPARE(mapping, (std::vector<UnsignedInt>{3, 1, 0, 2, 4}));
+}
+
+void ReorderVerticesTest::indexOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices = Indices;
+    MeshTools::reorderVertices(indices, 3);
+    CORRADE_COMPARE(out.str(), "MeshTools::reorderVertices(): index 3 out of bounds for 3 vertices\n");
+    CORRADE_COMPARE(indices, Indices);
+}
+
+void ReorderVerticesTest::attributeArrays() {
+    std::vector<UnsignedInt> indices = Indices;
+    std::vector<Vector2i> positions{{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}};
+    std::vector<Int> ids{0, 10, 20, 30, 40};
+    MeshTools::reorderVertices(indices, positions, ids);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 0,
+        2, 1, 3
+    }));
+    CORRADE_COMPARE(positions, (std::vector<Vector2i>{{3, 3}, {1, 1}, {0, 0}, {2, 2}, {4, 4}}));
+    CORRADE_COMPARE(ids, (std::vector<Int>{30, 10, 0, 20, 40}));
+}
+
+void ReorderVerticesTest::attributeArraysWrongSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices = Indices;
+    std::vector<Vector2i> positions{{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}};
+    std::vector<Int> ids{0, 10, 20, 30};
+    MeshTools::reorderVertices(indices, positions, ids);
+    CORRADE_COMPARE(out.str(), "MeshTools::reorderVertices(): the attribute arrays don't have the same size\n");
+
+    /* Nothing is touched if any of the arrays has wrong size */
+    CORRADE_COMPARE(indices, Indices);
+    CORRADE_COMPARE(positions, (std::vector<Vector2i>{{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}}));
+}
+
+void ReorderVerticesTest::interleaved() {
+    std::vector<UnsignedInt> indices = Indices;
+    char data[]{'a', 'A', 'b', 'B', 'c', 'C', 'd', 'D', 'e', 'E'};
+    MeshTools::reorderVertices(indices, data, 2);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 0,
+        2, 1, 3
+    }));
+    CORRADE_COMPARE(std::string(data, 10), "dDbBaAcCeE");
+}
+
+void ReorderVerticesTest::interleavedWrongStride() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices = Indices;
+    char data[10]{};
+    MeshTools::reorderVertices(indices, data, 0);
+    MeshTools::reorderVertices(indices, data, 3);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::reorderVertices(): stride can't be zero\n"
+        "MeshTools::reorderVertices(): data size is not divisible by stride\n");
+}
+
+void ReorderVerticesTest::interleavedIndexOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices = Indices;
+    char data[]{'a', 'A', 'b', 'B', 'c', 'C'};
+    MeshTools::reorderVertices(indices, data, 2);
+    CORRADE_COMPARE(out.str(), "MeshTools::reorderVertices(): index 3 out of bounds for 3 vertices\n");
+
+    /* Neither the indices nor the data are touched */
+    CORRADE_COMPARE(indices, Indices);
+    CORRADE_COMPARE(std::string(data, 6), "aAbBcC");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ReorderVerticesTest)
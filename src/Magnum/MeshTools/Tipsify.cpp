@@ -25,8 +25,6 @@
 
 #include "Tipsify.h"
 
-#include <stack>
-
 namespace Magnum { namespace MeshTools { namespace Implementation {
 
 void Tipsify::operator()(std::size_t cacheSize) {
@@ -39,8 +37,14 @@ void Tipsify::operator()(std::size_t cacheSize) {
     std::vector<UnsignedInt> timestamp(vertexCount);
     std::vector<bool> emitted(indices.size()/3);
 
-    /* Dead-end vertex stack */
-    std::stack<UnsignedInt> deadEndStack;
+    /* Dead-end vertex stack. Each vertex is pushed once for every triangle
+       it's in, so reserving for all indices avoids any reallocation. */
+    std::vector<UnsignedInt> deadEndStack;
+    deadEndStack.reserve(indices.size());
+
+    /* Array with candidates for next fanning vertex (in 1-ring around
+       fanning vertex), reused for all iterations */
+    std::vector<UnsignedInt> candidates;
 
     /* Output index buffer */
     std::vector<UnsignedInt> outputIndices;
@@ -50,12 +54,12 @@ void Tipsify::operator()(std::size_t cacheSize) {
     UnsignedInt fanningVertex = 0;
     UnsignedInt i = 0;
     while(fanningVertex != 0xFFFFFFFFu) {
-        /* Array with candidates for next fanning vertex (in 1-ring around
-           fanning vertex) */
-        std::vector<UnsignedInt> candidates;
+        candidates.clear();
 
         /* For all neighbors of fanning vertex */
-        for(UnsignedInt ti = neighborPosition[fanningVertex], t = neighbors[ti]; ti != neighborPosition[fanningVertex+1]; t = neighbors[++ti]) {
+        for(UnsignedInt ti = neighborPosition[fanningVertex]; ti != neighborPosition[fanningVertex+1]; ++ti) {
+            const UnsignedInt t = neighbors[ti];
+
             /* Continue if already emitted */
             if(emitted[t]) continue;
             emitted[t] = true;
@@ -68,7 +72,7 @@ void Tipsify::operator()(std::size_t cacheSize) {
 
                 /* Add to dead end stack and candidates array */
                 /** @todo Limit size of dead end stack to cache size */
-                deadEndStack.push(v);
+                deadEndStack.push_back(v);
                 candidates.push_back(v);
 
                 /* Decrease live triangle count */
@@ -105,8 +109,8 @@ void Tipsify::operator()(std::size_t cacheSize) {
         if(fanningVertex == 0xFFFFFFFFu) {
             /* Find vertex with live triangles in dead-end stack */
             while(!deadEndStack.empty()) {
-                unsigned int d = deadEndStack.top();
-                deadEndStack.pop();
+                const UnsignedInt d = deadEndStack.back();
+                deadEndStack.pop_back();
 
                 if(!liveTriangleCount[d]) continue;
                 fanningVertex = d;
@@ -123,13 +123,18 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
-## Using multiple animable groups to improve performance
+## Performance characteristics
 
-@ref AnimableGroup is optimized for case when no animation is running -- it
-just puts itself to rest and waits until some animation changes its state to
-@ref AnimationState::Running again. If you put animations which are not
-pernamently running into separate group, they will not be traversed every time
-the @ref AnimableGroup::step() gets called, saving precious frame time.
+@ref AnimableGroup keeps running animations in a compact list and state
+changes done via @ref setState() are put into a queue processed at the
+beginning of next @ref AnimableGroup::step(). Stopped and paused animations
+thus don't cost anything in @ref AnimableGroup::step(), which makes it
+possible to have large number of mostly idle animations in a single group ---
+the cost of each step is proportional only to the number of running
+animations and state changes since the last step.
+
+Running animations are stepped in unspecified order, which can differ from
+order in which the animables were added to the group.
 
 ## Explicit template specializations
 
@@ -321,6 +326,13 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
         bool _repeated;
         UnsignedShort _repeatCount;
         UnsignedShort repeats;
+
+        /* Group whose active list or event queue references this animable.
+           Usually the same as animables(), can differ if the animable was
+           moved to another group using base FeatureGroup API. */
+        AnimableGroup<dimensions, T>* listedGroup;
+        std::size_t activeIndex;
+        bool queued;
 };
 
 /**
@@ -29,6 +29,8 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Animable.h and @ref AnimableGroup.h
  */
 
+#include <algorithm>
+
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
@@ -36,9 +38,11 @@
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(Constants::inf()), pauseTime(-Constants::inf()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0) {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(Constants::inf()), pauseTime(-Constants::inf()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0), listedGroup(nullptr), activeIndex(~std::size_t{}), queued(false) {}
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {
+    if(listedGroup) listedGroup->unlink(*this);
+}
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dimensions, T>::setState(AnimationState state) {
     if(currentState == state) return *this;
@@ -47,9 +51,10 @@ template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dime
     if(previousState == AnimationState::Stopped && state == AnimationState::Paused)
         return *this;
 
-    /* Wake up the group in case no animations are running */
-    animables()->wakeUp = true;
+    /* Let the group process the change in next step */
     currentState = state;
+    if(AnimableGroup<dimensions, T>* const group = animables())
+        group->enqueue(*this);
     return *this;
 }
 
@@ -61,61 +66,196 @@ template<UnsignedInt dimensions, class T> const AnimableGroup<dimensions, T>* An
     return static_cast<const AnimableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>::group());
 }
 
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>::AnimableGroup(): _stepping(false), _holeCount(0) {}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>::~AnimableGroup() {
+    /* Animables outliving the group shouldn't reference it anymore */
+    for(Animable<dimensions, T>* const animable: _active) {
+        if(!animable) continue;
+        animable->listedGroup = nullptr;
+        animable->activeIndex = ~std::size_t{};
+    }
+    for(Animable<dimensions, T>* const animable: _events) {
+        animable->listedGroup = nullptr;
+        animable->queued = false;
+    }
+}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::add(Animable<dimensions, T>& animable) {
+    FeatureGroup<dimensions, Animable<dimensions, T>, T>::add(animable);
+
+    /* Take over running state and pending state changes from the previous
+       group */
+    if(animable.currentState != animable.previousState) enqueue(animable);
+    else adopt(animable);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::remove(Animable<dimensions, T>& animable) {
+    FeatureGroup<dimensions, Animable<dimensions, T>, T>::remove(animable);
+    if(animable.listedGroup == this) unlink(animable);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::activate(Animable<dimensions, T>& animable) {
+    if(animable.activeIndex != ~std::size_t{}) return;
+    animable.activeIndex = _active.size();
+    animable.listedGroup = this;
+    _active.push_back(&animable);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::deactivate(Animable<dimensions, T>& animable) {
+    CORRADE_INTERNAL_ASSERT(animable.activeIndex < _active.size() && _active[animable.activeIndex] == &animable);
+
+    /* Animations are being stepped, leave a hole that's removed afterwards */
+    if(_stepping) {
+        _active[animable.activeIndex] = nullptr;
+        animable.activeIndex = ~std::size_t{};
+        ++_holeCount;
+        return;
+    }
+
+    /* Move the last animable into the hole */
+    Animable<dimensions, T>* const last = _active.back();
+    _active[animable.activeIndex] = last;
+    last->activeIndex = animable.activeIndex;
+    _active.pop_back();
+    animable.activeIndex = ~std::size_t{};
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::release(Animable<dimensions, T>& animable) {
+    if(animable.activeIndex == ~std::size_t{} && !animable.queued)
+        animable.listedGroup = nullptr;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::adopt(Animable<dimensions, T>& animable) {
+    if(animable.listedGroup == this) return;
+
+    bool queued = false;
+    if(animable.listedGroup) {
+        queued = animable.queued;
+        animable.listedGroup->unlink(animable);
+    }
+
+    if(animable.previousState == AnimationState::Running) activate(animable);
+    if(queued) enqueue(animable);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::enqueue(Animable<dimensions, T>& animable) {
+    adopt(animable);
+    if(animable.queued) return;
+
+    animable.queued = true;
+    animable.listedGroup = this;
+    _events.push_back(&animable);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::unlink(Animable<dimensions, T>& animable) {
+    if(animable.activeIndex != ~std::size_t{}) deactivate(animable);
+    if(animable.queued) {
+        _events.erase(std::find(_events.begin(), _events.end(), &animable));
+        animable.queued = false;
+    }
+
+    /* The animable might be destroyed while processing the events */
+    std::replace(_processedEvents.begin(), _processedEvents.end(), &animable, static_cast<Animable<dimensions, T>*>(nullptr));
+    animable.listedGroup = nullptr;
+}
+
 template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
-    if(!_runningCount && !wakeUp) return;
-    wakeUp = false;
-
-    for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
-        Animable<dimensions, T>& animable = (*this)[i];
-
-        /* The animation was stopped recently, just decrease count of running
-           animations if the animation was running before */
-        if(animable.previousState != AnimationState::Stopped && animable.currentState == AnimationState::Stopped) {
-            if(animable.previousState == AnimationState::Running)
-                --_runningCount;
-            animable.previousState = AnimationState::Stopped;
-            animable.animationStopped();
-            continue;
+    if(_active.empty() && _events.empty()) return;
 
-        /* The animation was paused recently, set pause time to previous frame time */
-        } else if(animable.previousState == AnimationState::Running && animable.currentState == AnimationState::Paused) {
-            animable.previousState = AnimationState::Paused;
-            animable.pauseTime = time;
-            --_runningCount;
-            animable.animationPaused();
+    /* Process state changes since the last step. The queue is swapped out
+       first, so changes done from the callbacks go to the next step. */
+    std::swap(_events, _processedEvents);
+    for(Animable<dimensions, T>* const animable: _processedEvents)
+        animable->queued = false;
+    for(std::size_t i = 0; i != _processedEvents.size(); ++i) {
+        Animable<dimensions, T>* const animable = _processedEvents[i];
+        if(!animable) continue;
+
+        /* The animable was moved to another group, hand the change over */
+        if(animable->animables() != this) {
+            if(AnimableGroup<dimensions, T>* const group = animable->animables())
+                group->enqueue(*animable);
+            else unlink(*animable);
             continue;
+        }
 
-        /* Skip the rest for not running animations */
-        } else if(animable.currentState != AnimationState::Running) {
-            CORRADE_INTERNAL_ASSERT(animable.previousState == animable.currentState);
+        /* The state was changed back in the meantime, nothing to do */
+        if(animable->previousState == animable->currentState) {
+            release(*animable);
             continue;
+        }
+
+        /* The animation was stopped recently, remove it from the active list
+           if the animation was running before */
+        if(animable->currentState == AnimationState::Stopped) {
+            if(animable->previousState == AnimationState::Running)
+                deactivate(*animable);
+            animable->previousState = AnimationState::Stopped;
+            release(*animable);
+            animable->animationStopped();
+
+        /* The animation was paused recently, set pause time to previous frame time */
+        } else if(animable->currentState == AnimationState::Paused) {
+            CORRADE_INTERNAL_ASSERT(animable->previousState == AnimationState::Running);
+            animable->previousState = AnimationState::Paused;
+            animable->pauseTime = time;
+            deactivate(*animable);
+            release(*animable);
+            animable->animationPaused();
 
         /* The animation was started recently, set start time to previous frame
            time, reset repeat count */
-        } else if(animable.previousState == AnimationState::Stopped) {
-            animable.previousState = AnimationState::Running;
-            animable.startTime = time;
-            animable.repeats = 0;
-            ++_runningCount;
-            animable.animationStarted();
+        } else if(animable->previousState == AnimationState::Stopped) {
+            animable->previousState = AnimationState::Running;
+            animable->startTime = time;
+            animable->repeats = 0;
+            activate(*animable);
+            animable->animationStarted();
 
         /* The animation was resumed recently, add pause duration to start time */
-        } else if(animable.previousState == AnimationState::Paused) {
-            animable.previousState = AnimationState::Running;
-            animable.startTime += time - animable.pauseTime;
-            ++_runningCount;
-            animable.animationResumed();
+        } else {
+            CORRADE_INTERNAL_ASSERT(animable->previousState == AnimationState::Paused);
+            animable->previousState = AnimationState::Running;
+            animable->startTime += time - animable->pauseTime;
+            activate(*animable);
+            animable->animationResumed();
         }
+    }
+    _processedEvents.clear();
+
+    /* Step all running animations. Animables stopped, moved away or
+       destroyed in the meantime (also from the callbacks) leave a hole, so
+       nothing is skipped. Animables activated in the meantime are appended
+       and stepped as well. */
+    _stepping = true;
+    for(std::size_t i = 0; i < _active.size(); ++i) {
+        if(!_active[i]) continue;
 
+        Animable<dimensions, T>& animable = *_active[i];
         CORRADE_INTERNAL_ASSERT(animable.previousState == AnimationState::Running);
 
+        /* The animable was moved to another group, hand it over */
+        if(animable.animables() != this) {
+            if(AnimableGroup<dimensions, T>* const group = animable.animables())
+                group->adopt(animable);
+            else unlink(animable);
+            continue;
+        }
+
+        /* State change is pending, it will be processed in the next step */
+        if(animable.currentState != AnimationState::Running) continue;
+
         /* Animation time exceeded duration */
         if(animable._duration != 0.0f && time-animable.startTime > animable._duration) {
             /* Not repeated or repeat count exceeded, stop */
             if(!animable._repeated || animable.repeats+1 == animable._repeatCount) {
                 animable.previousState = AnimationState::Stopped;
                 animable.currentState = AnimationState::Stopped;
-                --_runningCount;
+                deactivate(animable);
+                release(animable);
                 animable.animationStopped();
                 continue;
             }
@@ -132,8 +272,21 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             "SceneGraph::AnimableGroup::step(): negative delta passed", );
         animable.animationStep(time - animable.startTime, delta);
     }
+    _stepping = false;
+
+    /* Remove the holes, keeping the order */
+    if(_holeCount) {
+        std::size_t count = 0;
+        for(Animable<dimensions, T>* const animable: _active) {
+            if(!animable) continue;
+            animable->activeIndex = count;
+            _active[count++] = animable;
+        }
+        _active.resize(count);
+        _holeCount = 0;
+    }
 
-    CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
+    CORRADE_INTERNAL_ASSERT((_active.size() <= AnimableGroup<dimensions, T>::size()));
 }
 
 }}
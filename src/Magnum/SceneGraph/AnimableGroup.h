@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::AnimableGroup, alias @ref Magnum::SceneGraph::BasicAnimableGroup2D, @ref Magnum::SceneGraph::BasicAnimableGroup3D, typedef @ref Magnum::SceneGraph::AnimableGroup2D, @ref Magnum::SceneGraph::AnimableGroup3D
  */
 
+#include <vector>
+
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -48,28 +50,66 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
         /**
          * @brief Constructor
          */
-        explicit AnimableGroup(): _runningCount(0), wakeUp(false) {}
+        explicit AnimableGroup();
+
+        ~AnimableGroup();
 
         /**
          * @brief Count of running animations
          *
          * @see @ref step()
          */
-        std::size_t runningCount() const { return _runningCount; }
+        std::size_t runningCount() const { return _active.size() - _holeCount; }
+
+        /**
+         * @brief Add animable to the group
+         * @return Reference to self (for method chaining)
+         *
+         * If the animable is part of another group, it is removed from it,
+         * including its pending state changes and running state.
+         * @see @ref FeatureGroup::add()
+         */
+        AnimableGroup<dimensions, T>& add(Animable<dimensions, T>& animable);
+
+        /**
+         * @brief Remove animable from the group
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref FeatureGroup::remove()
+         */
+        AnimableGroup<dimensions, T>& remove(Animable<dimensions, T>& animable);
 
         /**
          * @brief Perform animation step
          * @param time      Absolute time (e.g. @ref Timeline::previousFrameTime())
          * @param delta     Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
          *
-         * If there are no running animations the function does nothing.
+         * First processes state changes queued since the previous step,
+         * calling @ref Animable::animationStarted() "animationStarted()" and
+         * other state callbacks, then performs animation step of all running
+         * animations. State changes done from the callbacks are processed in
+         * the next step. If there are no running animations and no state
+         * changes, the function does nothing.
          * @see @ref runningCount()
          */
         void step(Float time, Float delta);
 
     private:
-        std::size_t _runningCount;
-        bool wakeUp;
+        void MAGNUM_SCENEGRAPH_LOCAL activate(Animable<dimensions, T>& animable);
+        void MAGNUM_SCENEGRAPH_LOCAL deactivate(Animable<dimensions, T>& animable);
+        void MAGNUM_SCENEGRAPH_LOCAL release(Animable<dimensions, T>& animable);
+        void MAGNUM_SCENEGRAPH_LOCAL adopt(Animable<dimensions, T>& animable);
+        void MAGNUM_SCENEGRAPH_LOCAL enqueue(Animable<dimensions, T>& animable);
+        void MAGNUM_SCENEGRAPH_LOCAL unlink(Animable<dimensions, T>& animable);
+
+        std::vector<Animable<dimensions, T>*> _active, _events, _processedEvents;
+
+        /* While running animations are stepped, deactivated animables leave
+           a null hole in _active instead of being swapped with the last one,
+           so the iteration doesn't skip anything. The holes are removed at
+           the end of step(). */
+        bool _stepping;
+        std::size_t _holeCount;
 };
 
 /**
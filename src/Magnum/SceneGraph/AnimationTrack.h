@@ -0,0 +1,180 @@
+#ifndef Magnum_SceneGraph_AnimationTrack_h
+#define Magnum_SceneGraph_AnimationTrack_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::AnimationTrack, enum @ref Magnum::SceneGraph::AnimationInterpolation
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Animation interpolation
+
+@see @ref AnimationTrack
+*/
+enum class AnimationInterpolation: UnsignedByte {
+    /** Value of the previous keyframe is used until the next keyframe */
+    Constant,
+
+    /**
+     * Linear interpolation. Quaternions are interpolated using
+     * @ref Math::lerp(const Quaternion<T>&, const Quaternion<T>&, T),
+     * dual quaternions using normalized linear blending.
+     */
+    Linear,
+
+    /**
+     * Spherical interpolation. Quaternions are interpolated using
+     * @ref Math::slerp(), dual quaternions using @ref Math::sclerp(),
+     * vectors are interpolated linearly.
+     */
+    Spherical,
+
+    /**
+     * Cubic Hermite spline going through all keyframes with tangents
+     * calculated from neighbor keyframes (Catmull-Rom spline adapted for
+     * non-uniform keyframe times). Quaternions and dual quaternions are
+     * normalized after interpolation.
+     */
+    Cubic
+};
+
+/**
+@brief Animation track
+
+Data-driven alternative to @ref Animable --- a list of keyframe times and
+values which is evaluated at given time using chosen
+@ref AnimationInterpolation. To evaluate many tracks at once, add them to
+@ref AnimationTrackPlayer.
+@code
+SceneGraph::AnimationTrack<Quaternion> rotation{
+    {0.0f, 1.0f, 2.5f},
+    {Quaternion{}, Quaternion::rotation(90.0_degf, Vector3::yAxis()),
+     Quaternion::rotation(180.0_degf, Vector3::yAxis())},
+    SceneGraph::AnimationInterpolation::Spherical};
+
+object.setTransformation(Matrix4::from(rotation.at(1.75f).toMatrix(), {}));
+@endcode
+
+Outside of the keyframe range the value of first or last keyframe is
+returned. Quaternion and dual quaternion keyframes are expected to be
+normalized.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref AnimationTrack.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref AnimationTrack "AnimationTrack<Vector3>",
+    @ref AnimationTrackPlayer "AnimationTrackPlayer<Vector3>"
+-   @ref AnimationTrack "AnimationTrack<Quaternion>",
+    @ref AnimationTrackPlayer "AnimationTrackPlayer<Quaternion>"
+-   @ref AnimationTrack "AnimationTrack<DualQuaternion>",
+    @ref AnimationTrackPlayer "AnimationTrackPlayer<DualQuaternion>"
+
+@see @ref scenegraph, @ref AnimationTrackPlayer
+*/
+template<class T> class AnimationTrack {
+    public:
+        /** @brief Value type */
+        typedef T Type;
+
+        /**
+         * @brief Constructor
+         * @param times         Keyframe times, in ascending order
+         * @param values        Keyframe values
+         * @param interpolation Interpolation
+         *
+         * Expects that there is at least one keyframe and the same count of
+         * times and values.
+         */
+        explicit AnimationTrack(std::vector<Float> times, std::vector<T> values, AnimationInterpolation interpolation = AnimationInterpolation::Linear);
+
+        /** @brief Keyframe times */
+        const std::vector<Float>& times() const { return _times; }
+
+        /** @brief Keyframe values */
+        const std::vector<T>& values() const { return _values; }
+
+        /** @brief Interpolation */
+        AnimationInterpolation interpolation() const { return _interpolation; }
+
+        /** @brief Time of first keyframe */
+        Float startTime() const { return _times.front(); }
+
+        /** @brief Time of last keyframe */
+        Float endTime() const { return _times.back(); }
+
+        /** @brief Duration of the track */
+        Float duration() const { return _times.back() - _times.front(); }
+
+        /**
+         * @brief Value at given time
+         *
+         * Finds the keyframes using binary search. If the track is
+         * evaluated repeatedly with slowly changing time, use
+         * @ref at(Float, UnsignedInt&) const instead.
+         */
+        T at(Float time) const;
+
+        /**
+         * @brief Value at given time using cached keyframe cursor
+         * @param time      Time
+         * @param cursor    Keyframe cursor, updated to index of the keyframe
+         *      preceding @p time
+         *
+         * The keyframe search starts at @p cursor, so if the time advances
+         * only by a few keyframes since the last call, the lookup is done in
+         * constant time. Initialize the cursor to `0`.
+         */
+        T at(Float time, UnsignedInt& cursor) const;
+
+    private:
+        std::vector<Float> _times;
+        std::vector<T> _values;
+        AnimationInterpolation _interpolation;
+};
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT AnimationTrack<Vector3>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT AnimationTrack<Quaternion>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT AnimationTrack<DualQuaternion>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,216 @@
+#ifndef Magnum_SceneGraph_AnimationTrack_hpp
+#define Magnum_SceneGraph_AnimationTrack_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref AnimationTrack.h and @ref AnimationTrackPlayer.h
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/AnimationTrack.h"
+#include "Magnum/SceneGraph/AnimationTrackPlayer.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Index of the last keyframe not after given time, searching from the
+   cursor. If the time goes backwards or jumps too far ahead, binary search
+   is used instead of the linear scan. */
+inline UnsignedInt animationKeyframe(const std::vector<Float>& times, const Float time, UnsignedInt cursor) {
+    const UnsignedInt last = UnsignedInt(times.size() - 1);
+    if(cursor > last) cursor = 0;
+
+    if(time < times[cursor] || (cursor + 4 < last && times[cursor + 4] <= time)) {
+        const std::size_t next = std::upper_bound(times.begin(), times.end(), time) - times.begin();
+        return next ? UnsignedInt(next - 1) : 0;
+    }
+
+    while(cursor != last && times[cursor + 1] <= time) ++cursor;
+    return cursor;
+}
+
+/* Interpolation factor between given keyframe and the next one, clamped to
+   [0, 1] */
+inline Float animationFactor(const std::vector<Float>& times, const Float time, const UnsignedInt keyframe) {
+    if(keyframe + 1 == times.size()) return 0.0f;
+
+    const Float duration = times[keyframe + 1] - times[keyframe];
+    if(duration <= 0.0f) return 1.0f;
+    return Math::clamp((time - times[keyframe])/duration, 0.0f, 1.0f);
+}
+
+/* Linear interpolation, dual quaternions use normalized linear blending with
+   shortest path */
+template<class T> inline T animationLerp(const T& a, const T& b, const Float t) {
+    return T(Math::lerp(a, b, t));
+}
+template<class T> inline Math::DualQuaternion<T> animationLerp(const Math::DualQuaternion<T>& a, const Math::DualQuaternion<T>& b, const Float t) {
+    const Math::DualQuaternion<T> bAligned = Math::dot(a.real(), b.real()) < T(0) ? -b : b;
+    return (a*(T(1) - T(t)) + bAligned*T(t)).normalized();
+}
+
+/* Spherical interpolation, vectors are interpolated linearly */
+template<class T> inline T animationSlerp(const T& a, const T& b, const Float t) {
+    return T(Math::lerp(a, b, t));
+}
+template<class T> inline Math::Quaternion<T> animationSlerp(const Math::Quaternion<T>& a, const Math::Quaternion<T>& b, const Float t) {
+    return Math::slerp(a, b, T(t));
+}
+template<class T> inline Math::DualQuaternion<T> animationSlerp(const Math::DualQuaternion<T>& a, const Math::DualQuaternion<T>& b, const Float t) {
+    return Math::sclerp(a, b, T(t));
+}
+
+/* Rotations need to be on the same hemisphere as the reference for the
+   spline to take the shortest path and normalized afterwards */
+template<class T> inline T animationAligned(const T& value, const T&) {
+    return value;
+}
+template<class T> inline Math::Quaternion<T> animationAligned(const Math::Quaternion<T>& value, const Math::Quaternion<T>& reference) {
+    return Math::dot(value, reference) < T(0) ? -value : value;
+}
+template<class T> inline Math::DualQuaternion<T> animationAligned(const Math::DualQuaternion<T>& value, const Math::DualQuaternion<T>& reference) {
+    return Math::dot(value.real(), reference.real()) < T(0) ? -value : value;
+}
+template<class T> inline T animationNormalized(const T& value) {
+    return value;
+}
+template<class T> inline Math::Quaternion<T> animationNormalized(const Math::Quaternion<T>& value) {
+    return value.normalized();
+}
+template<class T> inline Math::DualQuaternion<T> animationNormalized(const Math::DualQuaternion<T>& value) {
+    return value.normalized();
+}
+
+/* Cubic Hermite spline with Catmull-Rom tangents scaled for non-uniform
+   keyframe times */
+template<class T> T animationSpline(const std::vector<Float>& times, const std::vector<T>& values, const UnsignedInt keyframe, const Float t) {
+    const UnsignedInt last = UnsignedInt(values.size() - 1);
+    const T& p1 = values[keyframe];
+    const T p2 = animationAligned(values[keyframe + 1], p1);
+    const Float duration = times[keyframe + 1] - times[keyframe];
+
+    T m1 = p2 - p1;
+    if(keyframe != 0) {
+        const T p0 = animationAligned(values[keyframe - 1], p1);
+        m1 = (p2 - p0)*(duration/(times[keyframe + 1] - times[keyframe - 1]));
+    }
+    T m2 = p2 - p1;
+    if(keyframe + 1 != last) {
+        const T p3 = animationAligned(values[keyframe + 2], p1);
+        m2 = (p3 - p1)*(duration/(times[keyframe + 2] - times[keyframe]));
+    }
+
+    const Float t2 = t*t;
+    const Float t3 = t2*t;
+    return animationNormalized(T(p1*(2.0f*t3 - 3.0f*t2 + 1.0f) + m1*(t3 - 2.0f*t2 + t) + p2*(3.0f*t2 - 2.0f*t3) + m2*(t3 - t2)));
+}
+
+template<class T> T animationInterpolate(const AnimationTrack<T>& track, const UnsignedInt keyframe, const Float t) {
+    const std::vector<T>& values = track.values();
+    if(keyframe + 1 == values.size()) return values[keyframe];
+
+    switch(track.interpolation()) {
+        case AnimationInterpolation::Constant:
+            return values[t < 1.0f ? keyframe : keyframe + 1];
+        case AnimationInterpolation::Linear:
+            return animationLerp(values[keyframe], values[keyframe + 1], t);
+        case AnimationInterpolation::Spherical:
+            return animationSlerp(values[keyframe], values[keyframe + 1], t);
+        case AnimationInterpolation::Cubic:
+            return animationSpline(track.times(), values, keyframe, t);
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+template<class T> AnimationTrack<T>::AnimationTrack(std::vector<Float> times, std::vector<T> values, const AnimationInterpolation interpolation): _times{std::move(times)}, _values{std::move(values)}, _interpolation{interpolation} {
+    CORRADE_ASSERT(!_times.empty() && _times.size() == _values.size(),
+        "SceneGraph::AnimationTrack: expected the same non-zero count of times and values but got" << _times.size() << "and" << _values.size(), );
+    CORRADE_ASSERT(std::is_sorted(_times.begin(), _times.end()),
+        "SceneGraph::AnimationTrack: keyframe times are not sorted", );
+}
+
+template<class T> T AnimationTrack<T>::at(const Float time) const {
+    const std::size_t next = std::upper_bound(_times.begin(), _times.end(), time) - _times.begin();
+    const UnsignedInt keyframe = next ? UnsignedInt(next - 1) : 0;
+    return Implementation::animationInterpolate(*this, keyframe, Implementation::animationFactor(_times, time, keyframe));
+}
+
+template<class T> T AnimationTrack<T>::at(const Float time, UnsignedInt& cursor) const {
+    cursor = Implementation::animationKeyframe(_times, time, cursor);
+    return Implementation::animationInterpolate(*this, cursor, Implementation::animationFactor(_times, time, cursor));
+}
+
+template<class T> AnimationTrackPlayer<T>::AnimationTrackPlayer() = default;
+
+template<class T> std::size_t AnimationTrackPlayer<T>::add(const AnimationTrack<T>& track, const Float startTime, const bool repeated) {
+    _tracks.push_back(&track);
+    _startTimes.push_back(startTime);
+    _repeated.push_back(repeated);
+    _cursors.push_back(0);
+    _factors.push_back(0.0f);
+    _values.push_back(track.values().front());
+    return _tracks.size() - 1;
+}
+
+template<class T> void AnimationTrackPlayer<T>::clear() {
+    _tracks.clear();
+    _startTimes.clear();
+    _repeated.clear();
+    _cursors.clear();
+    _factors.clear();
+    _values.clear();
+}
+
+template<class T> void AnimationTrackPlayer<T>::advance(const Float time) {
+    /* Find keyframes and interpolation factors for all tracks */
+    for(std::size_t i = 0; i != _tracks.size(); ++i) {
+        const AnimationTrack<T>& track = *_tracks[i];
+        Float trackTime = time - _startTimes[i];
+        if(_repeated[i] && track.duration() > 0.0f) {
+            trackTime = std::fmod(trackTime, track.duration());
+            if(trackTime < 0.0f) trackTime += track.duration();
+        }
+        trackTime += track.startTime();
+
+        _cursors[i] = Implementation::animationKeyframe(track.times(), trackTime, _cursors[i]);
+        _factors[i] = Implementation::animationFactor(track.times(), trackTime, _cursors[i]);
+    }
+
+    /* Interpolate the values */
+    for(std::size_t i = 0; i != _tracks.size(); ++i)
+        _values[i] = Implementation::animationInterpolate(*_tracks[i], _cursors[i], _factors[i]);
+}
+
+}}
+
+#endif
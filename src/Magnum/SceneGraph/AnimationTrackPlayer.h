@@ -0,0 +1,124 @@
+#ifndef Magnum_SceneGraph_AnimationTrackPlayer_h
+#define Magnum_SceneGraph_AnimationTrackPlayer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::AnimationTrackPlayer
+ */
+
+#include "Magnum/SceneGraph/AnimationTrack.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Animation track player
+
+Evaluates many @ref AnimationTrack instances of the same type at once.
+Compared to calling @ref AnimationTrack::at() on each track separately, the
+player keeps a keyframe cursor for each track, so the keyframe lookup is done
+in constant time if the time advances only a bit between frames, and the
+results are put into a single contiguous array.
+@code
+SceneGraph::AnimationTrackPlayer<Quaternion> player;
+std::vector<Object3D*> objects;
+for(Object3D* object: characters) {
+    player.add(walkRotation, startTimeFor(object), true);
+    objects.push_back(object);
+}
+
+void MyApplication::drawEvent() {
+    player.advance(timeline.previousFrameTime());
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        objects[i]->setTransformation(Matrix4::from(player.values()[i].toMatrix(), {}));
+
+    // ...
+}
+@endcode
+
+The tracks are referenced, not copied, so they have to stay in scope for the
+whole player lifetime.
+
+@see @ref scenegraph, @ref Animable
+*/
+template<class T> class AnimationTrackPlayer {
+    public:
+        /** @brief Value type */
+        typedef T Type;
+
+        /** @brief Constructor */
+        explicit AnimationTrackPlayer();
+
+        /** @brief Count of tracks in the player */
+        std::size_t size() const { return _tracks.size(); }
+
+        /**
+         * @brief Add a track
+         * @param track     Track
+         * @param startTime Absolute time at which the track starts
+         * @param repeated  Whether the track is repeated after it ends
+         * @return Index of the track in @ref values()
+         *
+         * The track time is calculated as the absolute time passed to
+         * @ref advance() minus @p startTime plus @ref AnimationTrack::startTime().
+         */
+        std::size_t add(const AnimationTrack<T>& track, Float startTime = 0.0f, bool repeated = false);
+
+        /** @brief Remove all tracks */
+        void clear();
+
+        /**
+         * @brief Evaluate all tracks at given time
+         *
+         * Results are available through @ref values().
+         */
+        void advance(Float time);
+
+        /**
+         * @brief Evaluated values
+         *
+         * Values of all tracks evaluated in last @ref advance() call, in
+         * order they were added to the player.
+         */
+        const std::vector<T>& values() const { return _values; }
+
+    private:
+        std::vector<const AnimationTrack<T>*> _tracks;
+        std::vector<Float> _startTimes;
+        std::vector<UnsignedByte> _repeated;
+        std::vector<UnsignedInt> _cursors;
+        std::vector<Float> _factors;
+        std::vector<T> _values;
+};
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT AnimationTrackPlayer<Vector3>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT AnimationTrackPlayer<Quaternion>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT AnimationTrackPlayer<DualQuaternion>;
+#endif
+
+}}
+
+#endif
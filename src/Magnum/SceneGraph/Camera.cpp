@@ -0,0 +1,75 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Camera.h"
+
+#include <cstring>
+
+namespace Magnum { namespace SceneGraph { namespace Implementation {
+
+std::uint64_t drawableSortKey(const DrawOrder order, const UnsignedInt sortKey, const Float depth) {
+    /* Map the float bits to unsigned integer preserving the order: flip all
+       bits of negative values, flip just the sign bit of positive values. */
+    UnsignedInt depthBits;
+    std::memcpy(&depthBits, &depth, sizeof(Float));
+    depthBits = depthBits & 0x80000000u ? ~depthBits : depthBits|0x80000000u;
+
+    if(order == DrawOrder::BackToFront)
+        return std::uint64_t(~depthBits) << 32|sortKey;
+    return std::uint64_t(sortKey) << 32|depthBits;
+}
+
+void sortDrawables(std::vector<std::pair<std::uint64_t, UnsignedInt>>& data, std::vector<std::pair<std::uint64_t, UnsignedInt>>& scratch) {
+    if(data.size() < 2) return;
+
+    /* Histograms of all eight bytes in one pass */
+    std::size_t counts[8][256]{};
+    for(const std::pair<std::uint64_t, UnsignedInt>& i: data)
+        for(std::size_t byte = 0; byte != 8; ++byte)
+            ++counts[byte][(i.first >> byte*8) & 0xff];
+
+    /* Stable counting sort by each byte, from the lowest. Bytes that are the
+       same for all keys don't change the order, so they are skipped. */
+    scratch.resize(data.size());
+    for(std::size_t byte = 0; byte != 8; ++byte) {
+        std::size_t* const count = counts[byte];
+        if(count[(data.front().first >> byte*8) & 0xff] == data.size())
+            continue;
+
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != 256; ++i) {
+            const std::size_t c = count[i];
+            count[i] = offset;
+            offset += c;
+        }
+
+        for(const std::pair<std::uint64_t, UnsignedInt>& i: data)
+            scratch[count[(i.first >> byte*8) & 0xff]++] = i;
+
+        std::swap(data, scratch);
+    }
+}
+
+}}}
@@ -29,6 +29,10 @@
  * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -52,8 +56,48 @@ enum class AspectRatioPolicy: UnsignedByte {
     Clip            /**< Clip on smaller side of view */
 };
 
+/**
+@brief Drawable order
+
+@see @ref Camera::setDrawOrder(), @ref Drawable::setSortKey()
+*/
+enum class DrawOrder: UnsignedByte {
+    /** Drawables are drawn in order they were added to the group (default) */
+    Insertion,
+
+    /**
+     * Drawables are sorted by @ref Drawable::sortKey() first and then from
+     * the nearest to the farthest, suitable for opaque objects.
+     */
+    FrontToBack,
+
+    /**
+     * Drawables are sorted from the farthest to the nearest first and then by
+     * @ref Drawable::sortKey(), suitable for transparent objects.
+     */
+    BackToFront
+};
+
 namespace Implementation {
     template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport);
+
+    template<UnsignedInt dimensions, class T> void frustumCull(const MatrixTypeFor<dimensions, T>& projectionMatrix, const std::vector<MatrixTypeFor<dimensions, T>>& transformations, const DrawableGroup<dimensions, T>& group, std::vector<T>& data, std::vector<UnsignedByte>& visible);
+
+    /* Combined key of drawable sort key and depth for given order */
+    MAGNUM_SCENEGRAPH_EXPORT std::uint64_t drawableSortKey(DrawOrder order, UnsignedInt sortKey, Float depth);
+
+    /* Stable LSD radix sort of key/index pairs, the scratch is used as
+       temporary storage and both vectors might get swapped */
+    MAGNUM_SCENEGRAPH_EXPORT void sortDrawables(std::vector<std::pair<std::uint64_t, UnsignedInt>>& data, std::vector<std::pair<std::uint64_t, UnsignedInt>>& scratch);
+
+    /* Scratch memory reused between draws */
+    template<class T> struct DrawState {
+        std::vector<T> cullingData;
+        std::vector<UnsignedByte> visible;
+        std::vector<std::pair<std::uint64_t, UnsignedInt>> sortData, sortScratch;
+    };
+
+    template<UnsignedInt dimensions, class T> void draw(Camera<dimensions, T>& camera, DrawableGroup<dimensions, T>& group, const std::vector<MatrixTypeFor<dimensions, T>>& transformations, DrawState<T>& state);
 }
 
 /**
@@ -232,10 +276,56 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         virtual void setViewport(const Vector2i& size);
 
+        /**
+         * @brief Whether frustum culling is enabled
+         *
+         * @see @ref setFrustumCullingEnabled()
+         */
+        bool isFrustumCullingEnabled() const { return _frustumCullingEnabled; }
+
+        /**
+         * @brief Enable or disable frustum culling
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, @ref draw() skips drawables which have bounding volume
+         * set and it lies entirely outside of the frustum given by
+         * @ref projectionMatrix(). Disabled by default.
+         * @see @ref Drawable::setBoundingSphere(),
+         *      @ref Drawable::setBoundingBox()
+         */
+        Camera<dimensions, T>& setFrustumCullingEnabled(bool enabled) {
+            _frustumCullingEnabled = enabled;
+            return *this;
+        }
+
+        /** @brief Draw order */
+        DrawOrder drawOrder() const { return _drawOrder; }
+
+        /**
+         * @brief Set draw order
+         * @return Reference to self (for method chaining)
+         *
+         * If set to anything else than @ref DrawOrder::Insertion, @ref draw()
+         * sorts the drawables using @ref Drawable::sortKey() and their depth
+         * before drawing them. The depth is distance of object origin from
+         * the camera along the view direction, in 2D scenes it's zero and
+         * the drawables are sorted only by their sort key. Default is
+         * @ref DrawOrder::Insertion.
+         */
+        Camera<dimensions, T>& setDrawOrder(DrawOrder order) {
+            _drawOrder = order;
+            return *this;
+        }
+
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. If frustum culling is enabled, the
+         * bounding volumes of all drawables in the group are tested against
+         * the frustum in one batch first and drawables outside of it are
+         * skipped. The drawables are then sorted according to
+         * @ref drawOrder().
+         * @see @ref setFrustumCullingEnabled()
          */
         virtual void draw(DrawableGroup<dimensions, T>& group);
 
@@ -254,6 +344,10 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+
+        bool _frustumCullingEnabled;
+        DrawOrder _drawOrder;
+        Implementation::DrawState<T> _drawState;
 };
 
 /**
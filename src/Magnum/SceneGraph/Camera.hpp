@@ -29,6 +29,9 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <cmath>
+
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
@@ -53,9 +56,115 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Vector2(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+/* Drawables are processed as a structure of arrays one frustum plane at a
+   time, so the inner loop has no branches and is easy to vectorize. Bounding
+   box and bounding sphere are handled by the same formula, the extent of the
+   volume along the plane normal is the sphere radius scaled by largest object
+   scale plus projections of the transformed box half-axes. */
+template<UnsignedInt dimensions, class T> void frustumCull(const MatrixTypeFor<dimensions, T>& projectionMatrix, const std::vector<MatrixTypeFor<dimensions, T>>& transformations, const DrawableGroup<dimensions, T>& group, std::vector<T>& data, std::vector<UnsignedByte>& visible) {
+    const std::size_t count = transformations.size();
+
+    /* Centers, half-axes and radii, each component in a separate array */
+    data.resize(count*(dimensions + dimensions*dimensions + 1));
+    T* const centers = data.data();
+    T* const axes = centers + dimensions*count;
+    T* const radii = axes + dimensions*dimensions*count;
+
+    for(std::size_t i = 0; i != count; ++i) {
+        const Drawable<dimensions, T>& drawable = group[i];
+
+        /* Drawables without bounding volume have infinite extent, so they
+           are never culled */
+        if(!drawable.hasBoundingVolume()) {
+            for(std::size_t j = 0; j != dimensions; ++j)
+                centers[j*count + i] = T(0);
+            for(std::size_t j = 0; j != dimensions*dimensions; ++j)
+                axes[j*count + i] = T(0);
+            radii[i] = Math::Constants<T>::inf();
+            continue;
+        }
+
+        const MatrixTypeFor<dimensions, T>& transformation = transformations[i];
+        const VectorTypeFor<dimensions, T> center = transformation.transformPoint(drawable.boundingVolumeCenter());
+        const VectorTypeFor<dimensions, T> halfSize = drawable.boundingVolumeHalfSize();
+        T maxScaleSquared{};
+        for(std::size_t a = 0; a != dimensions; ++a) {
+            T scaleSquared{};
+            for(std::size_t b = 0; b != dimensions; ++b) {
+                const T value = transformation[a][b];
+                axes[(a*dimensions + b)*count + i] = value*halfSize[a];
+                scaleSquared += value*value;
+            }
+            maxScaleSquared = Math::max(maxScaleSquared, scaleSquared);
+        }
+        for(std::size_t b = 0; b != dimensions; ++b)
+            centers[b*count + i] = center[b];
+        radii[i] = drawable.boundingVolumeRadius()*std::sqrt(maxScaleSquared);
+    }
+
+    /* Frustum planes in camera space are sums and differences of the last
+       projection matrix row with the other rows */
+    const Math::Vector<dimensions + 1, T> w = projectionMatrix.row(dimensions);
+    for(std::size_t p = 0; p != 2*dimensions; ++p) {
+        Math::Vector<dimensions + 1, T> plane = p % 2 ? w - projectionMatrix.row(p/2) : w + projectionMatrix.row(p/2);
+        T normalLengthSquared{};
+        for(std::size_t b = 0; b != dimensions; ++b)
+            normalLengthSquared += plane[b]*plane[b];
+
+        /* Degenerate plane (e.g. infinite far plane), skip it */
+        if(normalLengthSquared == T(0)) continue;
+        plane /= std::sqrt(normalLengthSquared);
+
+        for(std::size_t i = 0; i != count; ++i) {
+            T distance = plane[dimensions];
+            for(std::size_t b = 0; b != dimensions; ++b)
+                distance += plane[b]*centers[b*count + i];
+
+            T extent = radii[i];
+            for(std::size_t a = 0; a != dimensions; ++a) {
+                T projected{};
+                for(std::size_t b = 0; b != dimensions; ++b)
+                    projected += plane[b]*axes[(a*dimensions + b)*count + i];
+                extent += std::abs(projected);
+            }
+
+            visible[i] &= UnsignedByte(distance >= -extent);
+        }
+    }
+}
+
+/* Culls, sorts and draws the drawables. Shared between Camera::draw() and
+   FlatScene::draw(). Only drawables marked in state.visible by the caller
+   are considered. */
+template<UnsignedInt dimensions, class T> void draw(Camera<dimensions, T>& camera, DrawableGroup<dimensions, T>& group, const std::vector<MatrixTypeFor<dimensions, T>>& transformations, DrawState<T>& state) {
+    /* Cull drawables outside of the frustum */
+    if(camera.isFrustumCullingEnabled())
+        frustumCull<dimensions, T>(camera.projectionMatrix(), transformations, group, state.cullingData, state.visible);
+
+    /* Draw in insertion order */
+    if(camera.drawOrder() == DrawOrder::Insertion) {
+        for(std::size_t i = 0; i != transformations.size(); ++i)
+            if(state.visible[i]) group[i].draw(transformations[i], camera);
+        return;
+    }
+
+    /* Sort visible drawables by the key, depth is the negated Z coordinate
+       of the object origin in camera space */
+    state.sortData.clear();
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        if(!state.visible[i]) continue;
+        const Float depth = dimensions == 3 ? -Float(transformations[i][dimensions][dimensions - 1]) : 0.0f;
+        state.sortData.emplace_back(drawableSortKey(camera.drawOrder(), group[i].sortKey(), depth), UnsignedInt(i));
+    }
+    sortDrawables(state.sortData, state.sortScratch);
+
+    for(const std::pair<std::uint64_t, UnsignedInt>& i: state.sortData)
+        group[i.second].draw(transformations[i.second], camera);
+}
+
 }
 
-template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _frustumCullingEnabled(false), _drawOrder(DrawOrder::Insertion) {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -98,8 +207,8 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(Drawa
         scene->transformationMatrices(objects, _cameraMatrix);
 
     /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i].draw(transformations[i], *this);
+    _drawState.visible.assign(group.size(), 1);
+    Implementation::draw(*this, group, transformations, _drawState);
 }
 
 }}
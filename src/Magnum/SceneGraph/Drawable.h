@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -155,6 +157,46 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+## Frustum culling
+
+If the drawable has a bounding volume set using @ref setBoundingSphere() or
+@ref setBoundingBox() and frustum culling is enabled on the camera using
+@ref Camera::setFrustumCullingEnabled(), the drawable is not drawn if its
+bounding volume lies entirely outside of the camera frustum. The bounding
+volume is in object local coordinates, so it needs to be updated only when the
+drawn geometry changes, not when the object moves:
+@code
+(new RedCube(&scene, &drawables))
+    ->setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+
+camera.setFrustumCullingEnabled(true);
+@endcode
+
+Drawables without bounding volume are never culled.
+
+## Sorted drawing
+
+Instead of splitting the drawables into many groups, you can let the camera
+sort them to minimize state changes and overdraw. Each drawable has a
+@ref sortKey(), which should encode the state it needs --- for example shader
+in the highest bits, then material and mesh --- and the camera sorts the
+drawables by it when @ref Camera::setDrawOrder() is set. For opaque objects
+@ref DrawOrder::FrontToBack groups drawables by the state first and then draws
+the nearest first, transparent objects need to be drawn from the farthest one
+using @ref DrawOrder::BackToFront:
+@code
+(new RedCube(&scene, &opaqueDrawables))
+    ->setSortKey(shaderId << 24 | materialId << 12 | meshId);
+
+camera.setDrawOrder(SceneGraph::DrawOrder::FrontToBack)
+    .draw(opaqueDrawables);
+camera.setDrawOrder(SceneGraph::DrawOrder::BackToFront)
+    .draw(transparentDrawables);
+@endcode
+
+The sorting is done using radix sort, so it's linear in the number of
+drawables.
+
 ## Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -194,6 +236,99 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
             return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::group();
         }
 
+        /**
+         * @brief Whether the drawable has a bounding volume
+         *
+         * @see @ref setBoundingSphere(), @ref setBoundingBox()
+         */
+        bool hasBoundingVolume() const { return _boundingRadius >= T(0); }
+
+        /**
+         * @brief Center of the bounding volume
+         *
+         * In object local coordinates.
+         * @see @ref hasBoundingVolume()
+         */
+        VectorTypeFor<dimensions, T> boundingVolumeCenter() const { return _boundingCenter; }
+
+        /**
+         * @brief Half size of the bounding box
+         *
+         * Zero if the bounding volume is a sphere.
+         * @see @ref hasBoundingVolume()
+         */
+        VectorTypeFor<dimensions, T> boundingVolumeHalfSize() const { return _boundingHalfSize; }
+
+        /**
+         * @brief Radius of the bounding sphere
+         *
+         * Zero if the bounding volume is a box, negative if the drawable has
+         * no bounding volume.
+         * @see @ref hasBoundingVolume()
+         */
+        T boundingVolumeRadius() const { return _boundingRadius; }
+
+        /**
+         * @brief Set bounding sphere
+         * @return Reference to self (for method chaining)
+         *
+         * The sphere is in object local coordinates and replaces any
+         * previously set bounding volume. Used for frustum culling in
+         * @ref Camera::draw().
+         * @see @ref setBoundingBox(), @ref resetBoundingVolume()
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius) {
+            _boundingCenter = center;
+            _boundingHalfSize = {};
+            _boundingRadius = radius;
+            return *this;
+        }
+
+        /**
+         * @brief Set bounding box
+         * @return Reference to self (for method chaining)
+         *
+         * The box is in object local coordinates and replaces any previously
+         * set bounding volume. Used for frustum culling in
+         * @ref Camera::draw().
+         * @see @ref setBoundingSphere(), @ref resetBoundingVolume()
+         */
+        Drawable<dimensions, T>& setBoundingBox(const RangeTypeFor<dimensions, T>& box) {
+            _boundingCenter = box.center();
+            _boundingHalfSize = box.size()/T(2);
+            _boundingRadius = T(0);
+            return *this;
+        }
+
+        /**
+         * @brief Reset bounding volume
+         * @return Reference to self (for method chaining)
+         *
+         * The drawable is then never culled.
+         */
+        Drawable<dimensions, T>& resetBoundingVolume() {
+            _boundingCenter = {};
+            _boundingHalfSize = {};
+            _boundingRadius = T(-1);
+            return *this;
+        }
+
+        /** @brief Sort key */
+        UnsignedInt sortKey() const { return _sortKey; }
+
+        /**
+         * @brief Set sort key
+         * @return Reference to self (for method chaining)
+         *
+         * Used for sorting drawables with the same state together if
+         * @ref Camera::drawOrder() is not @ref DrawOrder::Insertion. Default
+         * is `0`.
+         */
+        Drawable<dimensions, T>& setSortKey(UnsignedInt key) {
+            _sortKey = key;
+            return *this;
+        }
+
         /**
          * @brief Draw the object using given camera
          * @param transformationMatrix  Object transformation relative to camera
@@ -203,6 +338,11 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+    private:
+        VectorTypeFor<dimensions, T> _boundingCenter, _boundingHalfSize;
+        T _boundingRadius;
+        UnsignedInt _sortKey;
 };
 
 /**
@@ -0,0 +1,202 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatScene
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Flattened scene
+
+Alternative storage of the scene hierarchy for large scenes. Instead of
+chasing parent and children pointers across the heap, the objects are stored
+in contiguous arrays of local transformations, parent indices and absolute
+transformations, sorted so parent is always before its children. Absolute
+transformations of the whole scene are then computed in a single linear pass.
+
+The objects are still regular @ref Object instances and their
+transformations are set through the usual transformation API (e.g.
+@ref MatrixTransformation3D or @ref DualQuaternionTransformation), features
+such as @ref Drawable or @ref Camera are attached to them as usual. The
+flattened arrays are created from the scene using @ref rebuild() and the
+transformations are gathered from the objects in @ref update():
+@code
+Scene3D scene;
+// add objects, drawables and camera...
+
+SceneGraph::FlatScene<SceneGraph::MatrixTransformation3D> flat{scene};
+
+// each frame
+flat.update();
+flat.draw(camera, drawables);
+@endcode
+
+The hierarchy is not tracked automatically, @ref rebuild() needs to be called
+after any object is added, removed or reparented.
+@see @ref scenegraph, @ref Object::transformations()
+*/
+template<class Transformation> class FlatScene {
+    public:
+        /** @brief Underlying transformation type */
+        typedef typename Transformation::DataType DataType;
+
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<Transformation::Dimensions, typename Transformation::Type> MatrixType;
+
+        /** @brief Parent index of top-level objects */
+        enum: UnsignedInt { NoParent = 0xFFFFFFFFu };
+
+        /**
+         * @brief Constructor
+         *
+         * Calls @ref rebuild().
+         */
+        explicit FlatScene(Scene<Transformation>& scene);
+
+        /** @brief Copying is not allowed */
+        FlatScene(const FlatScene<Transformation>&) = delete;
+
+        ~FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene<Transformation>& operator=(const FlatScene<Transformation>&) = delete;
+
+        /** @brief Scene */
+        Scene<Transformation>& scene() { return _scene; }
+        const Scene<Transformation>& scene() const { return _scene; } /**< @overload */
+
+        /**
+         * @brief Rebuild the flattened hierarchy
+         *
+         * Collects all objects in the scene (except the scene itself) in
+         * breadth-first order. Needs to be called after the hierarchy
+         * changes, absolute transformations are not valid until next
+         * @ref update().
+         */
+        void rebuild();
+
+        /** @brief Count of objects */
+        std::size_t size() const { return _objects.size(); }
+
+        /**
+         * @brief Objects
+         *
+         * Sorted so parent is always before its children.
+         */
+        const std::vector<Object<Transformation>*>& objects() const { return _objects; }
+
+        /**
+         * @brief Parent indices
+         *
+         * Index of parent for each object in @ref objects(), @ref NoParent
+         * for direct children of the scene. The index is always lower than
+         * index of the object itself.
+         */
+        const std::vector<UnsignedInt>& parents() const { return _parents; }
+
+        /**
+         * @brief Local transformations
+         *
+         * Gathered from the objects in last @ref update().
+         */
+        const std::vector<DataType>& transformations() const { return _transformations; }
+
+        /**
+         * @brief Absolute transformations
+         *
+         * Transformations relative to the scene, computed in last
+         * @ref update().
+         */
+        const std::vector<DataType>& absoluteTransformations() const { return _absoluteTransformations; }
+
+        /**
+         * @brief Index of given object
+         *
+         * Expects that the object is part of the flattened hierarchy.
+         */
+        UnsignedInt index(const Object<Transformation>& object) const;
+
+        /**
+         * @brief Update the transformations
+         *
+         * Gathers local transformations of all objects and computes their
+         * absolute transformations in a single pass.
+         */
+        void update();
+
+        /**
+         * @brief Transformations of given objects relative to the scene
+         *
+         * Equivalent to @ref Object::transformations() called on the scene,
+         * but uses transformations computed in last @ref update().
+         */
+        std::vector<DataType> transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const DataType& initialTransformation = DataType()) const;
+
+        /**
+         * @brief Draw drawables using given camera
+         *
+         * Equivalent to @ref Camera::draw(), including frustum culling and
+         * draw order set on the camera, but uses transformations computed in last
+         * @ref update(). Drawables attached to objects that are not in the
+         * flattened hierarchy are skipped, call @ref rebuild() to include
+         * objects added after the hierarchy was flattened.
+         */
+        void draw(Camera<Transformation::Dimensions, typename Transformation::Type>& camera, DrawableGroup<Transformation::Dimensions, typename Transformation::Type>& group);
+
+    private:
+        Scene<Transformation>& _scene;
+        std::vector<Object<Transformation>*> _objects;
+        std::vector<UnsignedInt> _parents;
+        std::vector<DataType> _transformations;
+        std::vector<DataType> _absoluteTransformations;
+        std::unique_ptr<Implementation::ObjectIndexTable> _indices;
+        Implementation::DrawState<typename Transformation::Type> _drawState;
+};
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<BasicDualComplexTransformation<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<BasicDualQuaternionTransformation<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<BasicMatrixTransformation2D<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<BasicMatrixTransformation3D<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<BasicRigidMatrixTransformation2D<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<BasicRigidMatrixTransformation3D<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<TranslationTransformation<2, Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<TranslationTransformation<3, Float>>;
+#endif
+
+}}
+
+#endif
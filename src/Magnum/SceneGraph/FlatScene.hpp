@@ -0,0 +1,139 @@
+#ifndef Magnum_SceneGraph_FlatScene_hpp
+#define Magnum_SceneGraph_FlatScene_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatScene.h
+ */
+
+#include "Magnum/SceneGraph/Camera.hpp"
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/Object.hpp"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class Transformation> FlatScene<Transformation>::FlatScene(Scene<Transformation>& scene): _scene(scene) {
+    rebuild();
+}
+
+template<class Transformation> FlatScene<Transformation>::~FlatScene() = default;
+
+template<class Transformation> void FlatScene<Transformation>::rebuild() {
+    _objects.clear();
+    _parents.clear();
+
+    /* Breadth-first traversal, the object array itself is used as the queue */
+    for(Object<Transformation>* child = _scene.children().first(); child; child = child->nextSibling()) {
+        _objects.push_back(child);
+        _parents.push_back(NoParent);
+    }
+    for(std::size_t i = 0; i != _objects.size(); ++i) {
+        for(Object<Transformation>* child = _objects[i]->children().first(); child; child = child->nextSibling()) {
+            _objects.push_back(child);
+            _parents.push_back(UnsignedInt(i));
+        }
+    }
+
+    _transformations.resize(_objects.size());
+    _absoluteTransformations.resize(_objects.size());
+
+    _indices.reset(new Implementation::ObjectIndexTable{_objects.size()});
+    for(std::size_t i = 0; i != _objects.size(); ++i)
+        _indices->insert(_objects[i], UnsignedInt(i));
+}
+
+template<class Transformation> UnsignedInt FlatScene<Transformation>::index(const Object<Transformation>& object) const {
+    const UnsignedInt* const index = _indices->find(&object);
+    CORRADE_ASSERT(index, "SceneGraph::FlatScene::index(): object not found, the hierarchy needs to be rebuilt", {});
+    return *index;
+}
+
+template<class Transformation> void FlatScene<Transformation>::update() {
+    /* Gather local transformations first so the hierarchy pass touches only
+       the contiguous arrays */
+    for(std::size_t i = 0; i != _objects.size(); ++i)
+        _transformations[i] = _objects[i]->transformation();
+
+    /* Parents are always before children, so their absolute transformation
+       is already computed */
+    for(std::size_t i = 0; i != _objects.size(); ++i) {
+        const UnsignedInt parent = _parents[i];
+        _absoluteTransformations[i] = parent == NoParent ? _transformations[i] :
+            Implementation::Transformation<Transformation>::compose(_absoluteTransformations[parent], _transformations[i]);
+    }
+}
+
+template<class Transformation> std::vector<typename Transformation::DataType> FlatScene<Transformation>::transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const DataType& initialTransformation) const {
+    std::vector<DataType> transformations;
+    transformations.reserve(objects.size());
+    for(Object<Transformation>& object: objects) {
+        /* The scene itself is not in the arrays */
+        if(object.isScene()) {
+            transformations.push_back(initialTransformation);
+            continue;
+        }
+
+        transformations.push_back(Implementation::Transformation<Transformation>::compose(initialTransformation, _absoluteTransformations[index(object)]));
+    }
+
+    return transformations;
+}
+
+template<class Transformation> void FlatScene<Transformation>::draw(Camera<Transformation::Dimensions, typename Transformation::Type>& camera, DrawableGroup<Transformation::Dimensions, typename Transformation::Type>& group) {
+    const MatrixType cameraMatrix = camera.cameraMatrix();
+
+    /* Drawables attached to objects that are not in the flattened hierarchy
+       (added after it was built or belonging to a different scene) are
+       skipped */
+    std::vector<MatrixType> transformations;
+    transformations.reserve(group.size());
+    _drawState.visible.assign(group.size(), 1);
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        const Object<Transformation>& object = static_cast<Object<Transformation>&>(group[i].object());
+
+        /* The scene itself is not in the arrays */
+        if(&object == &_scene) {
+            transformations.push_back(cameraMatrix);
+            continue;
+        }
+
+        const UnsignedInt* const index = _indices->find(&object);
+        if(!index) {
+            _drawState.visible[i] = 0;
+            transformations.push_back(cameraMatrix);
+            continue;
+        }
+
+        transformations.push_back(cameraMatrix*Implementation::Transformation<Transformation>::toMatrix(_absoluteTransformations[*index]));
+    }
+
+    /* Perform the drawing */
+    Implementation::draw(camera, group, transformations, _drawState);
+}
+
+}}
+
+#endif
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Object
  */
 
+#include <cstdint>
+#include <memory>
 #include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -47,8 +49,57 @@ namespace Implementation {
     typedef Containers::EnumSet<ObjectFlag> ObjectFlags;
 
     CORRADE_ENUMSET_OPERATORS(ObjectFlags)
+
+    /* Parallel computation of transformations isn't worth it for less joints
+       per thread, the joints are distributed to threads in chunks */
+    enum: std::size_t {
+        MinJointsPerThread = 4096,
+        JointChunkSize = 1024
+    };
+
+    class ObjectIndexTable;
+
+    /* Global counter for generation-based dirty tracking. Returns next
+       generation or the current one. */
+    MAGNUM_SCENEGRAPH_EXPORT std::uint64_t nextObjectGeneration();
+    MAGNUM_SCENEGRAPH_EXPORT std::uint64_t objectGeneration();
+
+    /* Generation at which the object was last changed or reparented and at
+       which it was last cleaned. Allocated only for objects with
+       DirtyTracking::Generation, so the default mode doesn't pay for it. */
+    struct ObjectGenerations {
+        std::uint64_t changed, cleaned;
+    };
 }
 
+/**
+@brief Dirty tracking mode
+
+@see @ref Scene::setDirtyTracking(), @ref Object::dirtyTracking()
+*/
+enum class DirtyTracking: UnsignedByte {
+    /**
+     * @ref Object::setDirty() recursively marks all children and their
+     * features as dirty, @ref Object::setClean() cleans also all dirty
+     * parents. Default.
+     */
+    Recursive,
+
+    /**
+     * @ref Object::setDirty() only records a new generation for the object
+     * in constant time. @ref Object::isDirty() compares generations of the
+     * object and its parents with the generation at which the object was
+     * last cleaned and @ref Object::setClean() cleans only the requested
+     * objects. @ref AbstractFeature::markDirty() is called only on features
+     * of the object on which @ref Object::setDirty() was called, features of
+     * its children are not notified and have to check
+     * @ref AbstractObject::isDirty() of their object if they need to know
+     * about changes of the parents. The generations are stored in a separate
+     * allocation for every object in this mode.
+     */
+    Generation
+};
+
 /**
 @brief Object
 
@@ -299,7 +350,10 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @brief Transformations of given group of objects relative to this object
          *
          * All transformations can be premultiplied with @p initialTransformation,
-         * if specified.
+         * if specified. For large groups of objects the computation can be
+         * done on multiple threads, see @ref Scene::setTransformationThreadCount()
+         * for more information. The result is always the same regardless of
+         * thread count.
          * @see @ref transformationMatrices()
          */
         /* `objects` passed by copy intentionally (to allow move from
@@ -329,8 +383,28 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /* `objects` passed by copy intentionally (to avoid copy internally) */
         static void setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects);
 
-        /** @copydoc AbstractObject::isDirty() */
-        bool isDirty() const { return !!(flags & Flag::Dirty); }
+        /**
+         * @brief Dirty tracking mode
+         *
+         * Inherited from the parent object, set for the whole scene using
+         * @ref Scene::setDirtyTracking().
+         */
+        DirtyTracking dirtyTracking() const {
+            return _generations ? DirtyTracking::Generation : DirtyTracking::Recursive;
+        }
+
+        /**
+         * @brief Whether absolute transformation is dirty
+         *
+         * Constant-time in @ref DirtyTracking::Recursive mode, in
+         * @ref DirtyTracking::Generation mode goes up the hierarchy and
+         * checks whether the object or any of its parents was changed since
+         * the object was last cleaned.
+         * @see @ref AbstractObject::isDirty()
+         */
+        bool isDirty() const {
+            return _generations ? isDirtyGeneration() : !!(flags & Flag::Dirty);
+        }
 
         /** @copydoc AbstractObject::setDirty() */
         void setDirty();
@@ -357,6 +431,10 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
     #ifndef DOXYGEN_GENERATING_OUTPUT
     public:
         virtual bool isScene() const { return false; }
+
+    protected:
+        /* Switches the whole subtree to given dirty tracking mode */
+        void setDirtyTrackingInternal(DirtyTracking tracking);
     #endif
 
     private:
@@ -372,7 +450,9 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
 
-        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const;
+        enum: UnsignedInt { RootJoint = 0xFFFFFFFFu };
+
+        static UnsignedInt MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const Implementation::ObjectIndexTable& joints, Object<Transformation>& joint, typename Transformation::DataType& transformation);
 
         bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
@@ -381,10 +461,14 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation);
 
+        bool isDirtyGeneration() const;
+
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
         Flags flags;
+
+        /* Non-null only with DirtyTracking::Generation */
+        std::unique_ptr<Implementation::ObjectGenerations> _generations;
 };
 
 }}
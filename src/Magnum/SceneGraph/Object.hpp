@@ -30,7 +30,12 @@
  */
 
 #include <algorithm>
+#include <cstdint>
 #include <stack>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <atomic>
+#include <thread>
+#endif
 
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
@@ -38,12 +43,73 @@
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+
+/* Open-addressing table mapping objects to indices, used by
+   Object::transformations() to avoid storing the joint index in every object
+   and by FlatScene for object lookup. The capacity is fixed upfront, so the
+   table never rehashes and can be read from multiple threads once filled. */
+class ObjectIndexTable {
+    public:
+        explicit ObjectIndexTable(std::size_t capacity = 0) {
+            std::size_t size = 16;
+            while(size < capacity + capacity/2) size *= 2;
+            _entries.resize(size);
+            _mask = size - 1;
+        }
+
+        /* Inserts the object with given index, returns index of the
+           previously inserted occurence if it's already there */
+        UnsignedInt insert(const void* const object, const UnsignedInt index) {
+            for(std::size_t i = hash(object); ; i = (i + 1) & _mask) {
+                Entry& e = _entries[i];
+                if(!e.object) {
+                    e.object = object;
+                    e.index = index;
+                    return index;
+                }
+                if(e.object == object) return e.index;
+            }
+        }
+
+        /* Returns nullptr if the object is not in the table */
+        const UnsignedInt* find(const void* const object) const {
+            for(std::size_t i = hash(object); ; i = (i + 1) & _mask) {
+                const Entry& e = _entries[i];
+                if(!e.object) return nullptr;
+                if(e.object == object) return &e.index;
+            }
+        }
+
+        UnsignedInt operator[](const void* const object) const {
+            const UnsignedInt* const index = find(object);
+            CORRADE_INTERNAL_ASSERT(index);
+            return *index;
+        }
+
+    private:
+        struct Entry {
+            const void* object{};
+            UnsignedInt index{};
+        };
+
+        std::size_t hash(const void* const object) const {
+            /* Fibonacci hashing, taking the upper bits */
+            return std::size_t((std::uint64_t(reinterpret_cast<std::uintptr_t>(object))*0x9e3779b97f4a7c15ull) >> 32) & _mask;
+        }
+
+        std::vector<Entry> _entries;
+        std::size_t _mask;
+};
+
+}
+
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::AbstractObject() {}
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~AbstractObject() {}
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): flags(Flag::Dirty) {
     setParent(parent);
 }
 
@@ -85,8 +151,11 @@ template<class Transformation> Object<Transformation>& Object<Transformation>::s
     /* Remove the object from old parent children list */
     if(this->parent()) this->parent()->Containers::template LinkedList<Object<Transformation>>::cut(this);
 
-    /* Add the object to list of new parent */
-    if(parent) parent->Containers::LinkedList<Object<Transformation>>::insert(this);
+    /* Add the object to list of new parent, inherit its dirty tracking mode */
+    if(parent) {
+        parent->Containers::LinkedList<Object<Transformation>>::insert(this);
+        setDirtyTrackingInternal(parent->dirtyTracking());
+    }
 
     setDirty();
     return *this;
@@ -109,6 +178,16 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
 }
 
 template<class Transformation> void Object<Transformation>::setDirty() {
+    /* With generation tracking just record that the object changed and
+       notify its own features, children find that out when checking their
+       parents */
+    if(_generations) {
+        _generations->changed = Implementation::nextObjectGeneration();
+        for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: this->features())
+            feature.markDirty();
+        return;
+    }
+
     /* The transformation of this object (and all children) is already dirty,
        nothing to do */
     if(flags & Flag::Dirty) return;
@@ -126,6 +205,13 @@ template<class Transformation> void Object<Transformation>::setDirty() {
 }
 
 template<class Transformation> void Object<Transformation>::setClean() {
+    /* With generation tracking only this object is cleaned */
+    if(_generations) {
+        if(!isDirtyGeneration()) return;
+        setCleanInternal(absoluteTransformation());
+        return;
+    }
+
     /* The object (and all its parents) are already clean, nothing to do */
     if(!(flags & Flag::Dirty)) return;
 
@@ -190,29 +276,34 @@ divided into two groups:
    child in the subtree
  - "non-joints", i.e. paths between joints
 
-Then for all joints their transformation (relative to parent joint) is
-computed and recursively concatenated together. Resulting transformations for
-joints which were originally in `object` list is then returned.
+Then for all joints their transformation relative to parent joint is computed
+by going up the path to it. Every non-joint object lies on exactly one such
+path, so the paths are independent of each other and can be computed in
+parallel. The relative transformations are then concatenated together, going
+from the root down. Resulting transformations for joints which were originally
+in `object` list is then returned. The operations are done in the same order
+regardless of thread count, so the results are always the same.
 */
 template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
-
     /* Remember object count for later */
     std::size_t objectCount = objects.size();
 
-    /* Mark all original objects as joints and create initial list of joints
-       from them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
-        /* Multiple occurences of one object in the array, don't overwrite it
-           with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
+    /* Table mapping objects to joint indices. Every new joint is created by
+       merging two paths, so there's at most twice as many joints as the
+       original objects. */
+    Implementation::ObjectIndexTable joints{2*objectCount};
 
-        objects[i].get().counter = UnsignedShort(i);
+    /* Mark all original objects as joints and create initial list of joints
+       from them. For multiple occurences of one object in the array remember
+       index of the first occurence. */
+    std::vector<UnsignedInt> firstOccurences(objectCount);
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        firstOccurences[i] = joints.insert(&objects[i].get(), UnsignedInt(i));
         objects[i].get().flags |= Flag::Joint;
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
+    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(std::move(objects));
 
-    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT) || !defined(CORRADE_TARGET_EMSCRIPTEN)
     /* Scene object */
     const Scene<Transformation>* scene = this->scene();
     #endif
@@ -220,109 +311,152 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     /* Nearest common ancestor not yet implemented - assert this is done on scene */
     CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
 
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+    /* Mark all objects up the hierarchy as visited. Each object goes up until
+       it reaches an object that's either already visited or a joint, so the
+       resulting set of joints doesn't depend on processing order. */
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        Object<Transformation>* o = &jointObjects[i].get();
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
+        /* Already visited, continue to next (duplicate occurence) */
+        if(o->flags & Flag::Visited) continue;
 
-        Object<Transformation>* parent = it->get().parent();
+        for(;;) {
+            /* Mark the object as visited */
+            o->flags |= Flag::Visited;
 
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+            Object<Transformation>* parent = o->parent();
+
+            /* If this is root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
+                break;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            /* Parent is an joint or already visited - done */
+            if(parent->flags & (Flag::Visited|Flag::Joint)) {
+                /* If not already marked as joint, mark it as such and add it
+                   to list of joint objects */
+                if(!(parent->flags & Flag::Joint)) {
+                    joints.insert(parent, UnsignedInt(jointObjects.size()));
+                    parent->flags |= Flag::Joint;
+                    jointObjects.push_back(*parent);
+                }
+
+                break;
+            }
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+            /* Else go up the hierarchy */
+            o = parent;
+        }
     }
 
-    /* Array of absolute transformations in joints */
+    /* Array of joint transformations, first relative to parent joint, then
+       absolute, and array of parent joints */
     std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
+    std::vector<UnsignedInt> parentJoints(jointObjects.size());
+
+    /* Compute transformations relative to parent joints. Second and next
+       occurences of duplicate objects are skipped. */
+    const auto computeJoints = [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            if(i < objectCount && firstOccurences[i] != i) continue;
+            parentJoints[i] = computeJointTransformation(joints, jointObjects[i], jointTransformations[i]);
+        }
+    };
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    UnsignedInt threadCount = scene->transformationThreadCount();
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = UnsignedInt(std::min(std::size_t(threadCount), jointObjects.size()/Implementation::MinJointsPerThread));
+    if(threadCount > 1) {
+        /* Workers pick chunks of joints from a shared counter, the calling
+           thread is working too */
+        std::atomic<std::size_t> next{0};
+        const auto worker = [&]() {
+            for(;;) {
+                const std::size_t begin = next.fetch_add(Implementation::JointChunkSize);
+                if(begin >= jointObjects.size()) break;
+                computeJoints(begin, std::min(begin + Implementation::JointChunkSize, jointObjects.size()));
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for(UnsignedInt i = 1; i != threadCount; ++i)
+            threads.emplace_back(worker);
+        worker();
+        for(std::thread& thread: threads) thread.join();
+    } else
+    #endif
+    {
+        computeJoints(0, jointObjects.size());
+    }
+
+    /* Concatenate the transformations, going from the root down. Joints whose
+       parent joint transformation is not absolute yet are put on a stack and
+       processed after it. */
+    std::vector<bool> absolute(jointObjects.size());
+    std::vector<UnsignedInt> stack;
+    for(std::size_t i = 0; i != jointObjects.size(); ++i) {
+        if(i < objectCount && firstOccurences[i] != i) continue;
+
+        for(UnsignedInt joint = i; !absolute[joint]; joint = parentJoints[joint]) {
+            stack.push_back(joint);
+            if(parentJoints[joint] == RootJoint) break;
+        }
 
-    /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
-        computeJointTransformation(jointObjects, jointTransformations, i, initialTransformation);
+        while(!stack.empty()) {
+            const UnsignedInt joint = stack.back();
+            stack.pop_back();
+
+            jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(
+                parentJoints[joint] == RootJoint ? initialTransformation : jointTransformations[parentJoints[joint]],
+                jointTransformations[joint]);
+            absolute[joint] = true;
+        }
+    }
 
     /* Copy transformation for second or next occurences from first occurence
        of duplicate object */
     for(std::size_t i = 0; i != objectCount; ++i) {
-        if(jointObjects[i].get().counter != i)
-            jointTransformations[i] = jointTransformations[jointObjects[i].get().counter];
+        if(firstOccurences[i] != i)
+            jointTransformations[i] = jointTransformations[firstOccurences[i]];
     }
 
-    /* All visited marks are now cleaned, clean joint marks and counters */
-    for(auto i: jointObjects) {
-        /* All not-already cleaned objects (...duplicate occurences) should
-           have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
-        i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
-    }
+    /* Visited marks of non-joints are now cleaned, clean joint and visited
+       marks of joints */
+    for(auto i: jointObjects)
+        i.get().flags &= ~(Flag::Joint|Flag::Visited);
 
     /* Shrink the array to contain only transformations of requested objects and return */
     jointTransformations.resize(objectCount);
     return jointTransformations;
 }
 
-template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const {
-    std::reference_wrapper<Object<Transformation>> o = jointObjects[joint];
-
-    /* Transformation already computed ("unvisited" by this function before
-       either due to recursion or duplicate object occurences), done */
-    if(!(o.get().flags & Flag::Visited)) return jointTransformations[joint];
-
+template<class Transformation> UnsignedInt Object<Transformation>::computeJointTransformation(const Implementation::ObjectIndexTable& joints, Object<Transformation>& joint, typename Transformation::DataType& transformation) {
     /* Initialize transformation */
-    jointTransformations[joint] = o.get().transformation();
+    transformation = joint.transformation();
 
-    /* Go up until next joint or root */
+    /* Go up until next joint or root. Non-joint objects on the path are not
+       on a path of any other joint, so their visited mark can be cleaned
+       here. Joint marks are only read, as other paths might end at them. */
+    Object<Transformation>* o = &joint;
     for(;;) {
-        /* Clean visited mark */
-        CORRADE_INTERNAL_ASSERT(o.get().flags & Flag::Visited);
-        o.get().flags &= ~Flag::Visited;
+        Object<Transformation>* parent = o->parent();
 
-        Object<Transformation>* parent = o.get().parent();
-
-        /* Root object, compose transformation with initial, done */
+        /* Root object, done */
         if(!parent) {
-            CORRADE_INTERNAL_ASSERT(o.get().isScene());
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(initialTransformation, jointTransformations[joint]));
+            CORRADE_INTERNAL_ASSERT(o->isScene());
+            return RootJoint;
+        }
 
-        /* Joint object, compose transformation with the joint, done */
-        } else if(parent->flags & Flag::Joint) {
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(computeJointTransformation(jointObjects, jointTransformations, parent->counter, initialTransformation), jointTransformations[joint]));
+        /* Joint object, done */
+        if(parent->flags & Flag::Joint) return joints[parent];
 
-        /* Else compose transformation with parent, go up the hierarchy */
-        } else {
-            jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(parent->transformation(), jointTransformations[joint]);
-            o = *parent;
-        }
+        /* Else compose transformation with parent, clean visited mark and go
+           up the hierarchy */
+        transformation = Implementation::Transformation<Transformation>::compose(parent->transformation(), transformation);
+        CORRADE_INTERNAL_ASSERT(parent->flags & Flag::Visited);
+        parent->flags &= ~Flag::Visited;
+        o = parent;
     }
 }
 
@@ -344,9 +478,11 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
     if(objects.empty()) return;
 
     /* Add non-clean parents to the list. Mark each added object as visited, so
-       they aren't added more than once */
+       they aren't added more than once. With generation tracking only the
+       requested objects are cleaned. */
     for(std::size_t end = objects.size(), i = 0; i != end; ++i) {
         Object<Transformation>& o = objects[i];
+        if(o._generations) continue;
         o.flags |= Flag::Visited;
 
         Object<Transformation>* parent = o.parent();
@@ -366,7 +502,9 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
 
     /* Go through all objects and clean them */
     for(std::size_t i = 0; i != objects.size(); ++i) {
-        /* The object might be duplicated in the list, don't clean it more than once */
+        /* The object might be duplicated in the list, don't clean it more than
+           once. With generation tracking a parent might also be cleaned in
+           the meantime, so the flag has to be checked. */
         if(!objects[i].get().isDirty()) continue;
 
         objects[i].get().setCleanInternal(transformations[i]);
@@ -407,6 +545,42 @@ template<class Transformation> void Object<Transformation>::setCleanInternal(con
 
     /* Mark object as clean */
     flags &= ~Flag::Dirty;
+    if(_generations) _generations->cleaned = Implementation::objectGeneration();
+}
+
+template<class Transformation> bool Object<Transformation>::isDirtyGeneration() const {
+    /* Dirty if the object or any of its parents changed after it was last
+       cleaned */
+    for(const Object<Transformation>* p = this; p; p = p->parent())
+        if(p->_generations->changed > _generations->cleaned) return true;
+
+    return false;
+}
+
+template<class Transformation> void Object<Transformation>::setDirtyTrackingInternal(const DirtyTracking tracking) {
+    /* The whole subtree always uses the same mode, nothing to do */
+    if(dirtyTracking() == tracking) return;
+
+    /* Switch the mode and mark everything as dirty */
+    std::vector<Object<Transformation>*> objects{this};
+    while(!objects.empty()) {
+        Object<Transformation>* const o = objects.back();
+        objects.pop_back();
+
+        if(tracking == DirtyTracking::Generation) {
+            o->flags &= ~Flag::Dirty;
+            o->_generations.reset(new Implementation::ObjectGenerations{Implementation::nextObjectGeneration(), 0});
+        } else {
+            o->flags |= Flag::Dirty;
+            o->_generations.reset();
+        }
+
+        for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: o->features())
+            feature.markDirty();
+
+        for(Object<Transformation>& child: o->children())
+            objects.push_back(&child);
+    }
 }
 
 }}
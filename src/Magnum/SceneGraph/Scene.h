@@ -41,10 +41,50 @@ See @ref scenegraph for introduction.
 */
 template<class Transformation> class Scene: public Object<Transformation> {
     public:
-        explicit Scene() = default;
+        explicit Scene(): _transformationThreadCount{1} {}
+
+        /**
+         * @brief Thread count for computing transformations
+         *
+         * @see @ref setTransformationThreadCount()
+         */
+        UnsignedInt transformationThreadCount() const { return _transformationThreadCount; }
+
+        /**
+         * @brief Set thread count for computing transformations
+         * @return Reference to self (for method chaining)
+         *
+         * If set to value larger than `1`, @ref Object::transformations()
+         * called on this scene (and thus also @ref Camera::draw()) splits the
+         * computation for large sets of objects across given count of
+         * threads. Independent parts of the hierarchy are processed in
+         * parallel, the results are the same as with single thread. If set to
+         * `0`, the count is detected from hardware concurrency. Default is
+         * `1`, i.e. no threading. Ignored on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        Scene<Transformation>& setTransformationThreadCount(UnsignedInt count) {
+            _transformationThreadCount = count;
+            return *this;
+        }
+
+        /**
+         * @brief Set dirty tracking mode
+         * @return Reference to self (for method chaining)
+         *
+         * Applies to all objects in the scene, objects added later inherit
+         * the mode from their parent. All objects are marked as dirty after
+         * the mode is changed. Default is @ref DirtyTracking::Recursive.
+         * @see @ref dirtyTracking()
+         */
+        Scene<Transformation>& setDirtyTracking(DirtyTracking tracking) {
+            this->setDirtyTrackingInternal(tracking);
+            return *this;
+        }
 
     private:
         bool isScene() const override final { return true; }
+
+        UnsignedInt _transformationThreadCount;
 };
 
 }}
@@ -24,6 +24,7 @@
 */
 
 #include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/Animable.h"
@@ -41,6 +42,12 @@ struct AnimableTest: TestSuite::Tester {
     void repeat();
     void stop();
     void pause();
+    void idle();
+    void stateChangedBack();
+    void moveToAnotherGroup();
+    void destroyed();
+    void destroyedDuringStep();
+    void groupDestroyed();
 
     void debug();
 };
@@ -54,6 +61,12 @@ AnimableTest::AnimableTest() {
               &AnimableTest::repeat,
               &AnimableTest::stop,
               &AnimableTest::pause,
+              &AnimableTest::idle,
+              &AnimableTest::stateChangedBack,
+              &AnimableTest::moveToAnotherGroup,
+              &AnimableTest::destroyed,
+              &AnimableTest::destroyedDuringStep,
+              &AnimableTest::groupDestroyed,
 
               &AnimableTest::debug});
 }
@@ -351,6 +364,191 @@ void AnimableTest::pause() {
     CORRADE_COMPARE(animable.time, 2.0f);
 }
 
+class CountingAnimable: public SceneGraph::Animable3D {
+    public:
+        CountingAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group), steps(0), time(-1.0f) {}
+
+        Int steps;
+        Float time;
+
+    protected:
+        void animationStep(Float t, Float) override {
+            ++steps;
+            time = t;
+        }
+};
+
+void AnimableTest::idle() {
+    Object3D object;
+    AnimableGroup3D group;
+    std::vector<CountingAnimable*> animables;
+    for(std::size_t i = 0; i != 1000; ++i)
+        animables.push_back(new CountingAnimable(object, &group));
+
+    /* Start every hundredth animation */
+    for(std::size_t i = 0; i < animables.size(); i += 100)
+        animables[i]->setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 10);
+
+    /* Only the running animations were stepped */
+    for(std::size_t i = 0; i != animables.size(); ++i) {
+        CORRADE_COMPARE(animables[i]->steps, i % 100 ? 0 : 2);
+    }
+
+    /* Pause some of them, the rest is still running */
+    animables[0]->setState(AnimationState::Paused);
+    animables[500]->setState(AnimationState::Stopped);
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 8);
+    CORRADE_COMPARE(animables[0]->steps, 2);
+    CORRADE_COMPARE(animables[500]->steps, 2);
+    CORRADE_COMPARE(animables[900]->steps, 3);
+    CORRADE_COMPARE(animables[900]->time, 1.0f);
+}
+
+void AnimableTest::stateChangedBack() {
+    Object3D object;
+    AnimableGroup3D group;
+    OneShotAnimable animable(object, &group);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(animable.stateChanges, "started;");
+
+    /* Stopping and starting again before the step does nothing */
+    animable.setState(AnimationState::Stopped)
+        .setState(AnimationState::Running);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(animable.stateChanges, "started;");
+    CORRADE_COMPARE(animable.time, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 1);
+}
+
+void AnimableTest::moveToAnotherGroup() {
+    Object3D object;
+    AnimableGroup3D a, b;
+    CountingAnimable animable(object, &a);
+    animable.setState(AnimationState::Running);
+    a.step(1.0f, 0.5f);
+    a.step(1.5f, 0.5f);
+    CORRADE_COMPARE(a.runningCount(), 1);
+
+    /* Running state is moved over to the new group */
+    b.add(animable);
+    CORRADE_COMPARE(a.runningCount(), 0);
+    CORRADE_COMPARE(b.runningCount(), 1);
+    a.step(2.0f, 0.5f);
+    CORRADE_COMPARE(animable.steps, 2);
+    b.step(2.0f, 0.5f);
+    CORRADE_COMPARE(animable.steps, 3);
+    CORRADE_COMPARE(animable.time, 1.0f);
+
+    /* Pending state change is moved over too */
+    animable.setState(AnimationState::Paused);
+    a.add(animable);
+    CORRADE_COMPARE(b.runningCount(), 0);
+    CORRADE_COMPARE(a.runningCount(), 1);
+    a.step(2.5f, 0.5f);
+    CORRADE_COMPARE(a.runningCount(), 0);
+    CORRADE_COMPARE(animable.steps, 3);
+
+    /* Removed animable is not animated anymore */
+    animable.setState(AnimationState::Running);
+    a.step(3.0f, 0.5f);
+    CORRADE_COMPARE(animable.steps, 4);
+    a.remove(animable);
+    CORRADE_COMPARE(a.runningCount(), 0);
+    a.step(3.5f, 0.5f);
+    CORRADE_COMPARE(animable.steps, 4);
+}
+
+void AnimableTest::destroyed() {
+    Object3D object;
+    AnimableGroup3D group;
+
+    /* Destroyed with state change pending */
+    auto a = new CountingAnimable(object, &group);
+    a->setState(AnimationState::Running);
+    delete a;
+
+    /* Destroyed while running */
+    auto b = new CountingAnimable(object, &group);
+    auto c = new CountingAnimable(object, &group);
+    b->setState(AnimationState::Running);
+    c->setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    delete b;
+    CORRADE_COMPARE(group.runningCount(), 1);
+
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(c->steps, 2);
+}
+
+void AnimableTest::destroyedDuringStep() {
+    class DestroyingAnimable: public SceneGraph::Animable3D {
+        public:
+            DestroyingAnimable(AbstractObject3D& object, AnimableGroup3D* group): SceneGraph::Animable3D(object, group), victim(nullptr) {}
+
+            Animable3D* victim;
+
+        protected:
+            void animationStep(Float, Float) override {
+                Animable3D* const animable = victim;
+                victim = nullptr;
+                delete animable;
+            }
+    };
+
+    Object3D object;
+    AnimableGroup3D group;
+    auto a = new CountingAnimable(object, &group);
+    auto destroying = new DestroyingAnimable(object, &group);
+    auto b = new CountingAnimable(object, &group);
+    auto c = new CountingAnimable(object, &group);
+    a->setState(AnimationState::Running);
+    destroying->setState(AnimationState::Running);
+    b->setState(AnimationState::Running);
+    c->setState(AnimationState::Running);
+
+    /* Destroying an animable that was already stepped shouldn't cause any
+       other to be skipped */
+    destroying->victim = a;
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 3);
+    CORRADE_COMPARE(b->steps, 1);
+    CORRADE_COMPARE(c->steps, 1);
+
+    /* Neither should destroying itself */
+    destroying->victim = destroying;
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    CORRADE_COMPARE(b->steps, 2);
+    CORRADE_COMPARE(c->steps, 2);
+
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(b->steps, 3);
+    CORRADE_COMPARE(c->steps, 3);
+}
+
+void AnimableTest::groupDestroyed() {
+    Object3D object;
+    CountingAnimable animable(object);
+
+    {
+        AnimableGroup3D group;
+        group.add(animable);
+        animable.setState(AnimationState::Running);
+    }
+
+    /* The animable shouldn't reference the destroyed group anymore */
+    CORRADE_VERIFY(!animable.animables());
+    AnimableGroup3D group;
+    group.add(animable);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(animable.steps, 1);
+}
+
 void AnimableTest::debug() {
     std::ostringstream o;
     Debug(&o) << AnimationState::Running;
@@ -0,0 +1,310 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AnimationTrack.h"
+#include "Magnum/SceneGraph/AnimationTrackPlayer.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct AnimationTrackTest: TestSuite::Tester {
+    explicit AnimationTrackTest();
+
+    void construct();
+    void constructEmpty();
+    void constructDifferentSize();
+    void constructNotSorted();
+
+    void constant();
+    void linear();
+    void linearQuaternion();
+    void linearDualQuaternion();
+    void spherical();
+    void sphericalDualQuaternion();
+    void cubic();
+    void cubicQuaternion();
+    void outOfRange();
+    void singleKeyframe();
+    void cursor();
+
+    void player();
+    void playerRepeated();
+    void playerClear();
+};
+
+AnimationTrackTest::AnimationTrackTest() {
+    addTests({&AnimationTrackTest::construct,
+              &AnimationTrackTest::constructEmpty,
+              &AnimationTrackTest::constructDifferentSize,
+              &AnimationTrackTest::constructNotSorted,
+
+              &AnimationTrackTest::constant,
+              &AnimationTrackTest::linear,
+              &AnimationTrackTest::linearQuaternion,
+              &AnimationTrackTest::linearDualQuaternion,
+              &AnimationTrackTest::spherical,
+              &AnimationTrackTest::sphericalDualQuaternion,
+              &AnimationTrackTest::cubic,
+              &AnimationTrackTest::cubicQuaternion,
+              &AnimationTrackTest::outOfRange,
+              &AnimationTrackTest::singleKeyframe,
+              &AnimationTrackTest::cursor,
+
+              &AnimationTrackTest::player,
+              &AnimationTrackTest::playerRepeated,
+              &AnimationTrackTest::playerClear});
+}
+
+void AnimationTrackTest::construct() {
+    AnimationTrack<Vector3> track{{1.0f, 2.0f, 4.0f}, {Vector3{}, Vector3::xAxis(), Vector3::yAxis()}, AnimationInterpolation::Cubic};
+    CORRADE_COMPARE(track.times(), (std::vector<Float>{1.0f, 2.0f, 4.0f}));
+    CORRADE_COMPARE(track.values().size(), 3);
+    CORRADE_VERIFY(track.interpolation() == AnimationInterpolation::Cubic);
+    CORRADE_COMPARE(track.startTime(), 1.0f);
+    CORRADE_COMPARE(track.endTime(), 4.0f);
+    CORRADE_COMPARE(track.duration(), 3.0f);
+}
+
+void AnimationTrackTest::constructEmpty() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    AnimationTrack<Vector3> track{{}, {}};
+    CORRADE_COMPARE(out.str(), "SceneGraph::AnimationTrack: expected the same non-zero count of times and values but got 0 and 0\n");
+}
+
+void AnimationTrackTest::constructDifferentSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    AnimationTrack<Vector3> track{{0.0f, 1.0f}, {Vector3{}}};
+    CORRADE_COMPARE(out.str(), "SceneGraph::AnimationTrack: expected the same non-zero count of times and values but got 2 and 1\n");
+}
+
+void AnimationTrackTest::constructNotSorted() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    AnimationTrack<Vector3> track{{1.0f, 0.0f}, {Vector3{}, Vector3{}}};
+    CORRADE_COMPARE(out.str(), "SceneGraph::AnimationTrack: keyframe times are not sorted\n");
+}
+
+void AnimationTrackTest::constant() {
+    AnimationTrack<Vector3> track{{0.0f, 1.0f, 3.0f}, {Vector3{1.0f}, Vector3{2.0f}, Vector3{4.0f}}, AnimationInterpolation::Constant};
+    CORRADE_COMPARE(track.at(0.0f), Vector3{1.0f});
+    CORRADE_COMPARE(track.at(0.99f), Vector3{1.0f});
+    CORRADE_COMPARE(track.at(1.0f), Vector3{2.0f});
+    CORRADE_COMPARE(track.at(2.5f), Vector3{2.0f});
+    CORRADE_COMPARE(track.at(3.0f), Vector3{4.0f});
+}
+
+void AnimationTrackTest::linear() {
+    AnimationTrack<Vector3> track{{0.0f, 1.0f, 3.0f}, {Vector3{1.0f}, Vector3{2.0f}, Vector3{4.0f}}};
+    CORRADE_COMPARE(track.at(0.5f), Vector3{1.5f});
+    CORRADE_COMPARE(track.at(1.0f), Vector3{2.0f});
+    CORRADE_COMPARE(track.at(2.5f), Vector3{3.5f});
+}
+
+void AnimationTrackTest::linearQuaternion() {
+    const Quaternion a = Quaternion::rotation(15.0_degf, Vector3::xAxis());
+    const Quaternion b = Quaternion::rotation(23.0_degf, Vector3::xAxis());
+    AnimationTrack<Quaternion> track{{0.0f, 2.0f}, {a, b}};
+    CORRADE_COMPARE(track.at(0.7f), Math::lerp(a, b, 0.35f));
+}
+
+void AnimationTrackTest::linearDualQuaternion() {
+    const DualQuaternion a = DualQuaternion::translation({1.0f, 0.0f, 0.0f});
+    const DualQuaternion b = DualQuaternion::translation({3.0f, 0.0f, 0.0f})*DualQuaternion::rotation(90.0_degf, Vector3::zAxis());
+    AnimationTrack<DualQuaternion> track{{0.0f, 1.0f}, {a, b}};
+
+    const DualQuaternion half = track.at(0.5f);
+    CORRADE_VERIFY(half.isNormalized());
+    CORRADE_COMPARE(half.rotation(), Quaternion::rotation(45.0_degf, Vector3::zAxis()));
+
+    /* Opposite hemisphere takes the shortest path as well */
+    AnimationTrack<DualQuaternion> negated{{0.0f, 1.0f}, {a, -b}};
+    CORRADE_COMPARE(negated.at(0.5f), half);
+}
+
+void AnimationTrackTest::spherical() {
+    const Quaternion a = Quaternion::rotation(15.0_degf, Vector3::xAxis());
+    const Quaternion b = Quaternion::rotation(115.0_degf, Vector3::xAxis());
+    AnimationTrack<Quaternion> track{{0.0f, 1.0f}, {a, b}, AnimationInterpolation::Spherical};
+    CORRADE_COMPARE(track.at(0.25f), Quaternion::rotation(40.0_degf, Vector3::xAxis()));
+
+    /* Vectors are interpolated linearly */
+    AnimationTrack<Vector3> vectors{{0.0f, 1.0f}, {Vector3{1.0f}, Vector3{2.0f}}, AnimationInterpolation::Spherical};
+    CORRADE_COMPARE(vectors.at(0.25f), Vector3{1.25f});
+}
+
+void AnimationTrackTest::sphericalDualQuaternion() {
+    const DualQuaternion a = DualQuaternion::rotation(15.0_degf, Vector3::zAxis());
+    const DualQuaternion b = DualQuaternion::rotation(115.0_degf, Vector3::zAxis());
+    AnimationTrack<DualQuaternion> track{{0.0f, 1.0f}, {a, b}, AnimationInterpolation::Spherical};
+    CORRADE_COMPARE(track.at(0.25f), Math::sclerp(a, b, 0.25f));
+}
+
+void AnimationTrackTest::cubic() {
+    /* Points on a line with non-uniform spacing stay on the line and the
+       keyframes are hit exactly */
+    AnimationTrack<Vector3> track{{0.0f, 1.0f, 3.0f, 4.0f}, {Vector3{0.0f}, Vector3{1.0f}, Vector3{3.0f}, Vector3{4.0f}}, AnimationInterpolation::Cubic};
+    CORRADE_COMPARE(track.at(1.0f), Vector3{1.0f});
+    CORRADE_COMPARE(track.at(3.0f), Vector3{3.0f});
+    CORRADE_COMPARE(track.at(2.0f), Vector3{2.0f});
+    CORRADE_COMPARE(track.at(0.5f), Vector3{0.5f});
+    CORRADE_COMPARE(track.at(3.5f), Vector3{3.5f});
+
+    /* Curve goes smoothly through the middle keyframe */
+    AnimationTrack<Vector3> curve{{0.0f, 1.0f, 2.0f}, {Vector3{0.0f}, Vector3::yAxis(), Vector3{}}, AnimationInterpolation::Cubic};
+    CORRADE_COMPARE(curve.at(0.5f), Vector3::yAxis(0.625f));
+    CORRADE_COMPARE(curve.at(1.5f), Vector3::yAxis(0.625f));
+}
+
+void AnimationTrackTest::cubicQuaternion() {
+    const Quaternion a = Quaternion::rotation(0.0_degf, Vector3::xAxis());
+    const Quaternion b = Quaternion::rotation(30.0_degf, Vector3::xAxis());
+    const Quaternion c = Quaternion::rotation(60.0_degf, Vector3::xAxis());
+    AnimationTrack<Quaternion> track{{0.0f, 1.0f, 2.0f}, {-a, b, -c}, AnimationInterpolation::Cubic};
+
+    /* Keyframes on the opposite hemisphere are flipped, the result is
+       normalized and close to the spherical interpolation */
+    const Quaternion result = track.at(1.5f);
+    CORRADE_VERIFY(result.isNormalized());
+    CORRADE_VERIFY(Math::dot(result, Quaternion::rotation(45.0_degf, Vector3::xAxis())) > 0.9999f);
+}
+
+void AnimationTrackTest::outOfRange() {
+    AnimationTrack<Vector3> track{{1.0f, 2.0f}, {Vector3{1.0f}, Vector3{2.0f}}, AnimationInterpolation::Cubic};
+    CORRADE_COMPARE(track.at(-5.0f), Vector3{1.0f});
+    CORRADE_COMPARE(track.at(7.0f), Vector3{2.0f});
+
+    UnsignedInt cursor = 0;
+    CORRADE_COMPARE(track.at(-5.0f, cursor), Vector3{1.0f});
+    CORRADE_COMPARE(cursor, 0);
+    CORRADE_COMPARE(track.at(7.0f, cursor), Vector3{2.0f});
+    CORRADE_COMPARE(cursor, 1);
+}
+
+void AnimationTrackTest::singleKeyframe() {
+    AnimationTrack<Quaternion> track{{1.0f}, {Quaternion::rotation(15.0_degf, Vector3::xAxis())}, AnimationInterpolation::Spherical};
+    CORRADE_COMPARE(track.duration(), 0.0f);
+    CORRADE_COMPARE(track.at(0.0f), Quaternion::rotation(15.0_degf, Vector3::xAxis()));
+    CORRADE_COMPARE(track.at(3.0f), Quaternion::rotation(15.0_degf, Vector3::xAxis()));
+}
+
+void AnimationTrackTest::cursor() {
+    std::vector<Float> times;
+    std::vector<Vector3> values;
+    for(Int i = 0; i != 20; ++i) {
+        times.push_back(Float(i));
+        values.push_back(Vector3{Float(i)*2.0f});
+    }
+    AnimationTrack<Vector3> track{times, values};
+
+    /* Advancing a bit at a time */
+    UnsignedInt cursor = 0;
+    CORRADE_COMPARE(track.at(0.5f, cursor), Vector3{1.0f});
+    CORRADE_COMPARE(cursor, 0);
+    CORRADE_COMPARE(track.at(1.5f, cursor), Vector3{3.0f});
+    CORRADE_COMPARE(cursor, 1);
+    CORRADE_COMPARE(track.at(3.25f, cursor), Vector3{6.5f});
+    CORRADE_COMPARE(cursor, 3);
+
+    /* Jumping forward */
+    CORRADE_COMPARE(track.at(15.5f, cursor), Vector3{31.0f});
+    CORRADE_COMPARE(cursor, 15);
+
+    /* Seeking backwards */
+    CORRADE_COMPARE(track.at(2.5f, cursor), Vector3{5.0f});
+    CORRADE_COMPARE(cursor, 2);
+
+    /* Invalid cursor is reset */
+    cursor = 1000;
+    CORRADE_COMPARE(track.at(7.5f, cursor), Vector3{15.0f});
+    CORRADE_COMPARE(cursor, 7);
+}
+
+void AnimationTrackTest::player() {
+    AnimationTrack<Vector3> a{{0.0f, 2.0f}, {Vector3{0.0f}, Vector3{2.0f}}};
+    AnimationTrack<Vector3> b{{1.0f, 2.0f, 3.0f}, {Vector3{1.0f}, Vector3{2.0f}, Vector3{5.0f}}};
+
+    AnimationTrackPlayer<Vector3> player;
+    CORRADE_COMPARE(player.add(a), 0);
+    CORRADE_COMPARE(player.add(b, 10.0f), 1);
+    CORRADE_COMPARE(player.size(), 2);
+
+    /* Values are initialized to first keyframe */
+    CORRADE_COMPARE(player.values(), (std::vector<Vector3>{Vector3{0.0f}, Vector3{1.0f}}));
+
+    player.advance(1.0f);
+    CORRADE_COMPARE(player.values(), (std::vector<Vector3>{Vector3{1.0f}, Vector3{1.0f}}));
+
+    /* Start time of the track is relative to player start time */
+    player.advance(11.5f);
+    CORRADE_COMPARE(player.values(), (std::vector<Vector3>{Vector3{2.0f}, Vector3{3.5f}}));
+
+    /* Going back in time */
+    player.advance(10.5f);
+    CORRADE_COMPARE(player.values(), (std::vector<Vector3>{Vector3{2.0f}, Vector3{1.5f}}));
+
+    /* Should give the same as evaluating the track directly */
+    CORRADE_COMPARE(player.values()[1], b.at(1.5f));
+}
+
+void AnimationTrackTest::playerRepeated() {
+    AnimationTrack<Vector3> track{{1.0f, 3.0f}, {Vector3{0.0f}, Vector3{4.0f}}};
+
+    AnimationTrackPlayer<Vector3> player;
+    player.add(track, 0.0f, true);
+    player.add(track, 0.0f, false);
+
+    player.advance(0.5f);
+    CORRADE_COMPARE(player.values(), (std::vector<Vector3>{Vector3{1.0f}, Vector3{1.0f}}));
+
+    player.advance(5.5f);
+    CORRADE_COMPARE(player.values(), (std::vector<Vector3>{Vector3{3.0f}, Vector3{4.0f}}));
+
+    /* Negative time wraps as well */
+    player.advance(-0.5f);
+    CORRADE_COMPARE(player.values(), (std::vector<Vector3>{Vector3{3.0f}, Vector3{0.0f}}));
+}
+
+void AnimationTrackTest::playerClear() {
+    AnimationTrack<Quaternion> track{{0.0f, 1.0f}, {Quaternion{}, Quaternion::rotation(90.0_degf, Vector3::yAxis())}};
+
+    AnimationTrackPlayer<Quaternion> player;
+    player.add(track);
+    player.add(track, 0.5f);
+    player.advance(0.5f);
+    CORRADE_COMPARE(player.values()[1], Quaternion{});
+
+    player.clear();
+    CORRADE_COMPARE(player.size(), 0);
+    CORRADE_VERIFY(player.values().empty());
+    player.advance(1.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::AnimationTrackTest)
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <random>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/Camera.hpp" /* only for aspectRatioFix(), so it doesn't have to be exported */
@@ -46,6 +48,10 @@ struct CameraTest: TestSuite::Tester {
     void projectionSizePerspective();
     void projectionSizeViewport();
     void draw();
+    void drawFrustumCulling();
+    void drawableSortKey();
+    void sortDrawables();
+    void drawOrder();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
@@ -61,7 +67,11 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
-              &CameraTest::draw});
+              &CameraTest::draw,
+              &CameraTest::drawFrustumCulling,
+              &CameraTest::drawableSortKey,
+              &CameraTest::sortDrawables,
+              &CameraTest::drawOrder});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -210,6 +220,192 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+void CameraTest::drawFrustumCulling() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, bool& drawn): SceneGraph::Drawable3D(object, group), drawn(drawn) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {
+                drawn = true;
+            }
+
+        private:
+            bool& drawn;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* Inside */
+    Object3D inside(&scene);
+    inside.translate({0.0f, 0.0f, -10.0f});
+    bool insideDrawn = false;
+    (new Drawable(inside, &group, insideDrawn))
+        ->setBoundingSphere({}, 1.0f);
+
+    /* Intersecting the right plane */
+    Object3D intersecting(&scene);
+    intersecting.translate({10.5f, 0.0f, -10.0f});
+    bool intersectingDrawn = false;
+    (new Drawable(intersecting, &group, intersectingDrawn))
+        ->setBoundingSphere({}, 1.0f);
+
+    /* Intersecting the right plane only because of the scaling */
+    Object3D scaled(&scene);
+    scaled.scale(Vector3(10.0f))
+        .translate({14.0f, 0.0f, -10.0f});
+    bool scaledDrawn = false;
+    (new Drawable(scaled, &group, scaledDrawn))
+        ->setBoundingSphere({}, 1.0f);
+
+    /* Outside on the right */
+    Object3D outside(&scene);
+    outside.translate({50.0f, 0.0f, -10.0f});
+    bool outsideDrawn = false;
+    (new Drawable(outside, &group, outsideDrawn))
+        ->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera */
+    Object3D behind(&scene);
+    behind.translate({0.0f, 0.0f, 10.0f});
+    bool behindDrawn = false;
+    (new Drawable(behind, &group, behindDrawn))
+        ->setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+
+    /* Outside, but without bounding volume */
+    Object3D unbounded(&scene);
+    unbounded.translate({50.0f, 0.0f, -10.0f});
+    bool unboundedDrawn = false;
+    new Drawable(unbounded, &group, unboundedDrawn);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+    CORRADE_VERIFY(!camera.isFrustumCullingEnabled());
+
+    camera.setFrustumCullingEnabled(true);
+    CORRADE_VERIFY(camera.isFrustumCullingEnabled());
+    camera.draw(group);
+    CORRADE_VERIFY(insideDrawn);
+    CORRADE_VERIFY(intersectingDrawn);
+    CORRADE_VERIFY(scaledDrawn);
+    CORRADE_VERIFY(!outsideDrawn);
+    CORRADE_VERIFY(!behindDrawn);
+    CORRADE_VERIFY(unboundedDrawn);
+
+    /* Everything is drawn with culling disabled */
+    camera.setFrustumCullingEnabled(false)
+        .draw(group);
+    CORRADE_VERIFY(outsideDrawn);
+    CORRADE_VERIFY(behindDrawn);
+}
+
+void CameraTest::drawableSortKey() {
+    using Implementation::drawableSortKey;
+
+    /* Grouped by state first, then nearest first, negative depth works too */
+    CORRADE_VERIFY(drawableSortKey(DrawOrder::FrontToBack, 1, -2.0f) < drawableSortKey(DrawOrder::FrontToBack, 1, -0.5f));
+    CORRADE_VERIFY(drawableSortKey(DrawOrder::FrontToBack, 1, -0.5f) < drawableSortKey(DrawOrder::FrontToBack, 1, 0.0f));
+    CORRADE_VERIFY(drawableSortKey(DrawOrder::FrontToBack, 1, 0.0f) < drawableSortKey(DrawOrder::FrontToBack, 1, 5.0f));
+    CORRADE_VERIFY(drawableSortKey(DrawOrder::FrontToBack, 1, 5.0f) < drawableSortKey(DrawOrder::FrontToBack, 1, 10.0f));
+    CORRADE_VERIFY(drawableSortKey(DrawOrder::FrontToBack, 1, 10.0f) < drawableSortKey(DrawOrder::FrontToBack, 2, -3.0f));
+
+    /* Farthest first, then grouped by state */
+    CORRADE_VERIFY(drawableSortKey(DrawOrder::BackToFront, 2, 10.0f) < drawableSortKey(DrawOrder::BackToFront, 1, 5.0f));
+    CORRADE_VERIFY(drawableSortKey(DrawOrder::BackToFront, 1, 5.0f) < drawableSortKey(DrawOrder::BackToFront, 2, 5.0f));
+    CORRADE_VERIFY(drawableSortKey(DrawOrder::BackToFront, 2, 5.0f) < drawableSortKey(DrawOrder::BackToFront, 0, -1.0f));
+}
+
+void CameraTest::sortDrawables() {
+    std::mt19937 random;
+    std::uniform_int_distribution<UnsignedInt> state{0, 15};
+    std::uniform_real_distribution<Float> depth{-100.0f, 100.0f};
+
+    /* Few distinct states and depths to verify that the sort is stable */
+    std::vector<std::pair<std::uint64_t, UnsignedInt>> data, scratch;
+    for(UnsignedInt i = 0; i != 10000; ++i)
+        data.emplace_back(Implementation::drawableSortKey(DrawOrder::FrontToBack, state(random), Float(Int(depth(random))/10)), i);
+
+    std::vector<std::pair<std::uint64_t, UnsignedInt>> expected = data;
+    std::stable_sort(expected.begin(), expected.end(), [](const std::pair<std::uint64_t, UnsignedInt>& a, const std::pair<std::uint64_t, UnsignedInt>& b) {
+        return a.first < b.first;
+    });
+
+    Implementation::sortDrawables(data, scratch);
+    CORRADE_VERIFY(data == expected);
+
+    /* Keys that are all the same don't change the order */
+    for(std::pair<std::uint64_t, UnsignedInt>& i: data) i.first = 0x1234;
+    expected = data;
+    Implementation::sortDrawables(data, scratch);
+    CORRADE_VERIFY(data == expected);
+}
+
+void CameraTest::drawOrder() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, std::vector<Int>& order, Int id): SceneGraph::Drawable3D(object, group), order(order), id(id) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {
+                order.push_back(id);
+            }
+
+        private:
+            std::vector<Int>& order;
+            Int id;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+    std::vector<Int> order;
+
+    Object3D a(&scene);
+    a.translate({0.0f, 0.0f, -5.0f});
+    (new Drawable(a, &group, order, 0))->setSortKey(2);
+
+    Object3D b(&scene);
+    b.translate({0.0f, 0.0f, -10.0f});
+    (new Drawable(b, &group, order, 1))->setSortKey(1);
+
+    Object3D c(&scene);
+    c.translate({0.0f, 0.0f, -2.0f});
+    (new Drawable(c, &group, order, 2))->setSortKey(2);
+
+    Object3D d(&scene);
+    d.translate({0.0f, 0.0f, -20.0f});
+    (new Drawable(d, &group, order, 3))->setSortKey(2);
+
+    /* Camera is not at origin, the depth is relative to it */
+    Object3D cameraObject(&scene);
+    cameraObject.translate({0.0f, 0.0f, 3.0f});
+    Camera3D camera(cameraObject);
+    CORRADE_VERIFY(camera.drawOrder() == DrawOrder::Insertion);
+
+    camera.draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{0, 1, 2, 3}));
+
+    order.clear();
+    camera.setDrawOrder(DrawOrder::FrontToBack)
+        .draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{1, 2, 0, 3}));
+
+    order.clear();
+    camera.setDrawOrder(DrawOrder::BackToFront)
+        .draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{3, 1, 0, 2}));
+
+    /* Culled drawables are not sorted nor drawn */
+    b.translate({100.0f, 0.0f, 0.0f});
+    group[1].setBoundingSphere({}, 1.0f);
+    order.clear();
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setFrustumCullingEnabled(true);
+    camera.draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{3, 0, 2}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
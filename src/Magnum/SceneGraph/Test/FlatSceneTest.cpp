@@ -0,0 +1,240 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void rebuild();
+    void update();
+    void updateDualQuaternion();
+    void indexNotFound();
+    void transformations();
+    void draw();
+    void drawNotFound();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+typedef SceneGraph::FlatScene<SceneGraph::MatrixTransformation3D> FlatScene3D;
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::rebuild,
+              &FlatSceneTest::update,
+              &FlatSceneTest::updateDualQuaternion,
+              &FlatSceneTest::indexNotFound,
+              &FlatSceneTest::transformations,
+              &FlatSceneTest::draw,
+              &FlatSceneTest::drawNotFound});
+}
+
+void FlatSceneTest::rebuild() {
+    Scene3D scene;
+    Object3D* a = new Object3D{&scene};
+    Object3D* b = new Object3D{a};
+    Object3D* c = new Object3D{&scene};
+    Object3D* d = new Object3D{b};
+
+    FlatScene3D flat{scene};
+    CORRADE_COMPARE(flat.size(), std::size_t(4));
+    CORRADE_COMPARE(flat.objects(), (std::vector<Object3D*>{a, c, b, d}));
+    CORRADE_COMPARE(flat.parents(), (std::vector<UnsignedInt>{FlatScene3D::NoParent, FlatScene3D::NoParent, 0, 2}));
+    CORRADE_COMPARE(flat.index(*d), 3);
+
+    /* Reparenting needs a rebuild */
+    d->setParent(c);
+    Object3D* e = new Object3D{d};
+    flat.rebuild();
+    CORRADE_COMPARE(flat.size(), std::size_t(5));
+    CORRADE_COMPARE(flat.objects(), (std::vector<Object3D*>{a, c, b, d, e}));
+    CORRADE_COMPARE(flat.parents(), (std::vector<UnsignedInt>{FlatScene3D::NoParent, FlatScene3D::NoParent, 0, 1, 3}));
+    CORRADE_COMPARE(flat.index(*e), 4);
+}
+
+void FlatSceneTest::update() {
+    Scene3D scene;
+    Object3D* a = new Object3D{&scene};
+    a->rotateZ(Deg(30.0f));
+    Object3D* b = new Object3D{a};
+    b->translate(Vector3::xAxis(2.0f));
+    Object3D* c = new Object3D{b};
+    c->scale(Vector3(0.5f));
+    Object3D* d = new Object3D{&scene};
+    d->translate(Vector3::yAxis(-1.0f));
+
+    FlatScene3D flat{scene};
+    flat.update();
+    for(Object3D* o: {a, b, c, d}) {
+        CORRADE_COMPARE(flat.transformations()[flat.index(*o)], o->transformation());
+        CORRADE_COMPARE(flat.absoluteTransformations()[flat.index(*o)], o->absoluteTransformation());
+    }
+
+    /* Transformation changes are picked up without rebuild */
+    a->translate(Vector3::zAxis(3.0f));
+    flat.update();
+    CORRADE_COMPARE(flat.absoluteTransformations()[flat.index(*c)], c->absoluteTransformation());
+}
+
+void FlatSceneTest::updateDualQuaternion() {
+    typedef SceneGraph::Object<SceneGraph::DualQuaternionTransformation> Object3D;
+    typedef SceneGraph::Scene<SceneGraph::DualQuaternionTransformation> Scene3D;
+
+    Scene3D scene;
+    Object3D* a = new Object3D{&scene};
+    a->rotateY(Deg(45.0f));
+    Object3D* b = new Object3D{a};
+    b->translate(Vector3::xAxis(2.0f));
+
+    FlatScene<SceneGraph::DualQuaternionTransformation> flat{scene};
+    flat.update();
+    CORRADE_COMPARE(flat.absoluteTransformations()[flat.index(*b)], b->absoluteTransformation());
+}
+
+void FlatSceneTest::indexNotFound() {
+    Scene3D scene;
+    Object3D a{&scene};
+    FlatScene3D flat{scene};
+
+    Object3D b{&scene};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    flat.index(b);
+    CORRADE_COMPARE(out.str(), "SceneGraph::FlatScene::index(): object not found, the hierarchy needs to be rebuilt\n");
+}
+
+void FlatSceneTest::transformations() {
+    Scene3D scene;
+    Object3D first(&scene);
+    first.rotateZ(Deg(30.0f));
+    Object3D second(&first);
+    second.scale(Vector3(0.5f));
+    Object3D third(&first);
+    third.translate(Vector3::xAxis(5.0f));
+
+    FlatScene3D flat{scene};
+    flat.update();
+
+    const Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    CORRADE_COMPARE(flat.transformations({second, third, scene, second}, initial),
+        scene.transformations({second, third, scene, second}, initial));
+}
+
+void FlatSceneTest::draw() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Matrix4& result): SceneGraph::Drawable3D(object, group), result(result) {}
+
+        protected:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                result = transformationMatrix;
+            }
+
+        private:
+            Matrix4& result;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D first(&scene);
+    Matrix4 firstTransformation;
+    first.scale(Vector3(5.0f));
+    new Drawable(first, &group, firstTransformation);
+
+    Object3D second(&scene);
+    Matrix4 secondTransformation;
+    second.translate(Vector3::yAxis(3.0f));
+    new Drawable(second, &group, secondTransformation);
+
+    Object3D third(&second);
+    Matrix4 thirdTransformation;
+    third.translate(Vector3::zAxis(-1.5f));
+    new Drawable(third, &group, thirdTransformation);
+
+    Camera3D camera(third);
+    FlatScene3D flat{scene};
+    flat.update();
+    flat.draw(camera, group);
+
+    CORRADE_COMPARE(firstTransformation, Matrix4::translation({0.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+    CORRADE_COMPARE(secondTransformation, Matrix4::translation(Vector3::zAxis(1.5f)));
+    CORRADE_COMPARE(thirdTransformation, Matrix4());
+}
+
+void FlatSceneTest::drawNotFound() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Int& drawn): SceneGraph::Drawable3D(object, group), drawn(drawn) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {
+                ++drawn;
+            }
+
+        private:
+            Int& drawn;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Int drawn = 0;
+    Object3D first(&scene);
+    new Drawable(first, &group, drawn);
+    new Drawable(scene, &group, drawn);
+
+    Camera3D camera(first);
+    FlatScene3D flat{scene};
+    flat.update();
+
+    /* Object added after the hierarchy was flattened is skipped */
+    Object3D second(&scene);
+    new Drawable(second, &group, drawn);
+    flat.draw(camera, group);
+    CORRADE_COMPARE(drawn, 2);
+
+    /* After rebuild it's drawn as well */
+    drawn = 0;
+    flat.rebuild();
+    flat.update();
+    flat.draw(camera, group);
+    CORRADE_COMPARE(drawn, 3);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
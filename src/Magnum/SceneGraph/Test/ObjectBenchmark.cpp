@@ -0,0 +1,185 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <cstring>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+/* Compares serial and threaded computation of transformations and the
+   flattened scene on large scenes, and the dirty tracking modes */
+struct ObjectBenchmark: TestSuite::Tester {
+    explicit ObjectBenchmark();
+
+    void transformationsWide();
+    void transformationsDeep();
+    void dirtyTrackingWide();
+    void dirtyTrackingDeep();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+typedef SceneGraph::FlatScene<SceneGraph::MatrixTransformation3D> FlatScene3D;
+
+ObjectBenchmark::ObjectBenchmark() {
+    addTests({&ObjectBenchmark::transformationsWide,
+              &ObjectBenchmark::transformationsDeep,
+              &ObjectBenchmark::dirtyTrackingWide,
+              &ObjectBenchmark::dirtyTrackingDeep});
+}
+
+namespace {
+
+void compareTransformations(Scene3D& scene, const std::vector<std::reference_wrapper<Object3D>>& objects, std::vector<Matrix4>& serial, std::vector<Matrix4>& threaded, std::vector<Matrix4>& flat) {
+    scene.setTransformationThreadCount(1);
+    Magnum::Test::benchmark("serial:", [&]() {
+        serial = scene.transformations(objects);
+    });
+
+    scene.setTransformationThreadCount(0);
+    Magnum::Test::benchmark("threaded:", [&]() {
+        threaded = scene.transformations(objects);
+    });
+
+    /* The hierarchy is flattened once upfront, only the per-frame update is
+       measured */
+    FlatScene3D flatScene{scene};
+    Magnum::Test::benchmark("flat:", [&]() {
+        flatScene.update();
+        flat = flatScene.transformations(objects);
+    });
+}
+
+void compareDirtyTracking(Scene3D& scene, Object3D& root, const std::vector<std::reference_wrapper<Object3D>>& objects) {
+    /* Each frame the root is moved and then all requested objects are
+       cleaned, which makes the whole subtree clean again */
+    for(const DirtyTracking tracking: {DirtyTracking::Recursive, DirtyTracking::Generation}) {
+        scene.setDirtyTracking(tracking);
+        Object3D::setClean(objects);
+
+        const std::string prefix = tracking == DirtyTracking::Recursive ? "recursive" : "generation";
+        Magnum::Test::benchmark(prefix + " setDirty():", [&]() {
+            root.translate(Vector3::xAxis(0.1f));
+        });
+        Magnum::Test::benchmark(prefix + " setClean():", [&]() {
+            Object3D::setClean(objects);
+        });
+    }
+}
+
+}
+
+void ObjectBenchmark::transformationsWide() {
+    /* 1000 subtrees with 200 leaves each, the leaves are two levels below the
+       subtree root */
+    Scene3D scene;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(Int i = 0; i != 1000; ++i) {
+        Object3D* branch = new Object3D{&scene};
+        branch->rotateY(Deg(i*0.37f)).translate(Vector3::xAxis(i*0.1f));
+
+        for(Int j = 0; j != 200; ++j) {
+            Object3D* parent = new Object3D{branch};
+            parent->scale(Vector3(1.0f + j*0.001f));
+            Object3D* leaf = new Object3D{parent};
+            leaf->rotateX(Deg(j*0.7f)).translate(Vector3::zAxis(j*0.01f));
+            objects.push_back(*leaf);
+        }
+    }
+
+    std::vector<Matrix4> serial, threaded, flat;
+    compareTransformations(scene, objects, serial, threaded, flat);
+
+    CORRADE_COMPARE(threaded.size(), serial.size());
+    CORRADE_VERIFY(std::memcmp(threaded.data(), serial.data(), serial.size()*sizeof(Matrix4)) == 0);
+    CORRADE_COMPARE(flat.size(), serial.size());
+    CORRADE_COMPARE(flat.back(), serial.back());
+}
+
+void ObjectBenchmark::transformationsDeep() {
+    /* 20000 chains of length 10 hanging off the scene root, only the ends are
+       requested */
+    Scene3D scene;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(Int i = 0; i != 20000; ++i) {
+        Object3D* o = new Object3D{&scene};
+        o->translate(Vector3::yAxis(i*0.01f));
+        for(Int j = 0; j != 10; ++j) {
+            o = new Object3D{o};
+            o->rotateZ(Deg(j*3.0f)).translate(Vector3::xAxis(1.0f));
+        }
+        objects.push_back(*o);
+    }
+
+    std::vector<Matrix4> serial, threaded, flat;
+    compareTransformations(scene, objects, serial, threaded, flat);
+
+    CORRADE_COMPARE(threaded.size(), serial.size());
+    CORRADE_VERIFY(std::memcmp(threaded.data(), serial.data(), serial.size()*sizeof(Matrix4)) == 0);
+    CORRADE_COMPARE(flat.size(), serial.size());
+    CORRADE_COMPARE(flat.back(), serial.back());
+}
+
+void ObjectBenchmark::dirtyTrackingWide() {
+    /* 1000 subtrees with 200 leaves each under a single root */
+    Scene3D scene;
+    Object3D* root = new Object3D{&scene};
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(Int i = 0; i != 1000; ++i) {
+        Object3D* branch = new Object3D{root};
+        for(Int j = 0; j != 200; ++j)
+            objects.push_back(*new Object3D{branch});
+    }
+
+    compareDirtyTracking(scene, *root, objects);
+
+    CORRADE_VERIFY(!objects.back().get().isDirty());
+}
+
+void ObjectBenchmark::dirtyTrackingDeep() {
+    /* 20000 chains of length 10 under a single root, only the ends are
+       requested */
+    Scene3D scene;
+    Object3D* root = new Object3D{&scene};
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(Int i = 0; i != 20000; ++i) {
+        Object3D* o = root;
+        for(Int j = 0; j != 10; ++j)
+            o = new Object3D{o};
+        objects.push_back(*o);
+    }
+
+    compareDirtyTracking(scene, *root, objects);
+
+    CORRADE_VERIFY(!objects.back().get().isDirty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
@@ -45,9 +46,14 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationsThreaded();
+    void transformationsLarge();
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
+    void setCleanGeneration();
+    void setDirtyGenerationFeatures();
+    void dirtyTrackingSwitch();
 
     void rangeBasedForChildren();
     void rangeBasedForFeatures();
@@ -82,9 +88,14 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsThreaded,
+              &ObjectTest::transformationsLarge,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
+              &ObjectTest::setCleanGeneration,
+              &ObjectTest::setDirtyGenerationFeatures,
+              &ObjectTest::dirtyTrackingSwitch,
 
               &ObjectTest::rangeBasedForChildren,
               &ObjectTest::rangeBasedForFeatures});
@@ -304,6 +315,68 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsThreaded() {
+    /* Large enough to be split across threads, objects are owned by the
+       scene */
+    Scene3D s;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(Int i = 0; i != 20; ++i) {
+        Object3D* branch = new Object3D{&s};
+        branch->rotateY(Deg(i*17.0f))
+            .translate(Vector3::xAxis(i*0.3f));
+        objects.push_back(*branch);
+
+        for(Int j = 0; j != 500; ++j) {
+            Object3D* parent = new Object3D{branch};
+            parent->scale(Vector3(1.0f + j*0.001f));
+            Object3D* leaf = new Object3D{parent};
+            leaf->rotateX(Deg(j*0.7f))
+                .translate(Vector3::zAxis(j*0.01f));
+            objects.push_back(*leaf);
+        }
+    }
+
+    const Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    const std::vector<Matrix4> serial = s.transformations(objects, initial);
+
+    s.setTransformationThreadCount(4);
+    const std::vector<Matrix4> threaded = s.transformations(objects, initial);
+
+    /* The results should be bit-identical */
+    CORRADE_COMPARE(threaded.size(), objects.size());
+    CORRADE_VERIFY(std::memcmp(threaded.data(), serial.data(), serial.size()*sizeof(Matrix4)) == 0);
+
+    /* Verify few against the slow path */
+    CORRADE_COMPARE(serial[0], initial*objects[0].get().absoluteTransformation());
+    CORRADE_COMPARE(serial[5000], initial*objects[5000].get().absoluteTransformation());
+}
+
+void ObjectTest::transformationsLarge() {
+    /* More than 65535 objects and more than 65535 joints, objects are owned
+       by the scene */
+    Scene3D s;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(Int i = 0; i != 40000; ++i) {
+        Object3D* parent = new Object3D{&s};
+        parent->translate(Vector3::xAxis(Float(i)));
+        for(Int j = 0; j != 2; ++j) {
+            Object3D* child = new Object3D{parent};
+            child->translate(Vector3::yAxis(Float(j + 1)));
+            objects.push_back(*child);
+        }
+    }
+
+    /* One object twice to verify duplicate handling past the limit */
+    objects.push_back(objects[70000]);
+
+    const std::vector<Matrix4> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), std::size_t(80001));
+    CORRADE_COMPARE(transformations[0], Matrix4::translation({0.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[70000], Matrix4::translation({35000.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[79999], Matrix4::translation({39999.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[80000], transformations[70000]);
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -484,6 +557,117 @@ void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::zAxis(3.0f))*Matrix4::scaling(Vector3(-2.0f)));
 }
 
+void ObjectTest::setCleanGeneration() {
+    Scene3D scene;
+    scene.setDirtyTracking(DirtyTracking::Generation);
+
+    CachingObject* parent = new CachingObject(&scene);
+    parent->translate(Vector3::xAxis(1.0f));
+    CachingObject* child = new CachingObject(parent);
+    child->scale(Vector3(2.0f));
+    CORRADE_VERIFY(child->dirtyTracking() == DirtyTracking::Generation);
+    CORRADE_VERIFY(parent->isDirty());
+    CORRADE_VERIFY(child->isDirty());
+
+    /* Only the requested object is cleaned */
+    child->setClean();
+    CORRADE_VERIFY(parent->isDirty());
+    CORRADE_VERIFY(!child->isDirty());
+    CORRADE_COMPARE(child->cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3(2.0f)));
+
+    /* Changing the parent makes the child dirty */
+    parent->setClean();
+    CORRADE_VERIFY(!parent->isDirty());
+    parent->translate(Vector3::yAxis(1.0f));
+    CORRADE_VERIFY(parent->isDirty());
+    CORRADE_VERIFY(child->isDirty());
+
+    /* Cleaning a list, duplicates are cleaned only once */
+    Object3D::setClean({*child, *parent, *child});
+    CORRADE_VERIFY(!parent->isDirty());
+    CORRADE_VERIFY(!child->isDirty());
+    CORRADE_COMPARE(parent->cleanedAbsoluteTransformation, Matrix4::translation({1.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(child->cleanedAbsoluteTransformation, Matrix4::translation({1.0f, 1.0f, 0.0f})*Matrix4::scaling(Vector3(2.0f)));
+
+    /* Reparenting makes the object dirty */
+    CachingObject* other = new CachingObject(&scene);
+    other->setClean();
+    child->setParent(other);
+    CORRADE_VERIFY(child->isDirty());
+    child->setClean();
+    CORRADE_COMPARE(child->cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(2.0f)));
+}
+
+void ObjectTest::setDirtyGenerationFeatures() {
+    class DirtyFeature: public AbstractFeature3D {
+        public:
+            explicit DirtyFeature(AbstractObject3D& object): AbstractFeature3D{object}, dirtyCount{} {}
+
+            Int dirtyCount;
+
+        private:
+            void markDirty() override { ++dirtyCount; }
+    };
+
+    Scene3D scene;
+    scene.setDirtyTracking(DirtyTracking::Generation);
+
+    Object3D parent(&scene);
+    DirtyFeature parentFeature(parent);
+    Object3D child(&parent);
+    DirtyFeature childFeature(child);
+    Object3D::setClean({parent, child});
+    parentFeature.dirtyCount = childFeature.dirtyCount = 0;
+
+    /* Features of the changed object are notified */
+    child.translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(childFeature.dirtyCount, 1);
+    CORRADE_COMPARE(parentFeature.dirtyCount, 0);
+
+    /* Features of children are not notified, but the children are dirty */
+    child.setClean();
+    parent.translate(Vector3::yAxis(1.0f));
+    CORRADE_COMPARE(parentFeature.dirtyCount, 1);
+    CORRADE_COMPARE(childFeature.dirtyCount, 1);
+    CORRADE_VERIFY(child.isDirty());
+
+    /* Switching the mode notifies everything */
+    scene.setDirtyTracking(DirtyTracking::Recursive);
+    CORRADE_COMPARE(parentFeature.dirtyCount, 2);
+    CORRADE_COMPARE(childFeature.dirtyCount, 2);
+}
+
+void ObjectTest::dirtyTrackingSwitch() {
+    Scene3D scene;
+    CORRADE_VERIFY(scene.dirtyTracking() == DirtyTracking::Recursive);
+
+    Object3D* a = new Object3D(&scene);
+    a->setClean();
+    scene.setDirtyTracking(DirtyTracking::Generation);
+    CORRADE_VERIFY(a->dirtyTracking() == DirtyTracking::Generation);
+
+    /* Everything is dirty after the switch */
+    CORRADE_VERIFY(a->isDirty());
+    a->setClean();
+    CORRADE_VERIFY(!a->isDirty());
+
+    /* Object added from outside inherits the mode, including its children */
+    Object3D* orphan = new Object3D;
+    Object3D* orphanChild = new Object3D(orphan);
+    CORRADE_VERIFY(orphan->dirtyTracking() == DirtyTracking::Recursive);
+    orphan->setParent(a);
+    CORRADE_VERIFY(orphan->dirtyTracking() == DirtyTracking::Generation);
+    CORRADE_VERIFY(orphanChild->dirtyTracking() == DirtyTracking::Generation);
+    CORRADE_VERIFY(orphanChild->isDirty());
+
+    /* Switching back makes everything dirty again */
+    orphanChild->setClean();
+    scene.setDirtyTracking(DirtyTracking::Recursive);
+    CORRADE_VERIFY(orphanChild->dirtyTracking() == DirtyTracking::Recursive);
+    CORRADE_VERIFY(orphanChild->isDirty());
+    CORRADE_VERIFY(a->isDirty());
+}
+
 void ObjectTest::rangeBasedForChildren() {
     Scene3D scene;
     Object3D a(&scene);
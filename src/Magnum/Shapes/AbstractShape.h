@@ -87,6 +87,8 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
          */
         explicit AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group = nullptr);
 
+        ~AbstractShape();
+
         /**
          * @brief Shape group containing this shape
          *
@@ -101,14 +103,18 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
         /**
          * @brief Detect collision with other shape
          *
-         * Default implementation returns false.
+         * If collision occurence is not implemented for given pair of shape
+         * types, returns `false`, see @ref shapes-collisions-pairs.
          */
         bool collides(const AbstractShape<dimensions>& other) const;
 
         /**
          * @brief Collision with other shape
          *
-         * Default implementation returns empty collision.
+         * If collision is not implemented for given pair of shape types,
+         * returns empty collision, see @ref shapes-collisions-pairs. For
+         * pairs which have no finite penetration depth, such as a line and a
+         * plane, returns empty collision too.
          */
         Collision<dimensions> collision(const AbstractShape<dimensions>& other) const;
 
@@ -25,9 +25,18 @@
 
 #include "AxisAlignedBox.h"
 
+#include <algorithm>
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
 
 namespace Magnum { namespace Shapes {
 
@@ -41,6 +50,283 @@ template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(cons
            (other.position() < _max).all();
 }
 
+namespace {
+
+/* Finds the box face nearest to given point inside the box. Returns the
+   separating normal (moving the box along it pushes the point out) and the
+   penetration depth. */
+template<UnsignedInt dimensions> std::pair<VectorTypeFor<dimensions, Float>, Float> nearestFace(const VectorTypeFor<dimensions, Float>& min, const VectorTypeFor<dimensions, Float>& max, const VectorTypeFor<dimensions, Float>& point) {
+    std::size_t axis = 0;
+    Float sign = 1.0f;
+    Float depth = Constants::inf();
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        const Float toMin = point[i] - min[i];
+        const Float toMax = max[i] - point[i];
+        if(toMin < depth) {
+            axis = i;
+            sign = 1.0f;
+            depth = toMin;
+        }
+        if(toMax < depth) {
+            axis = i;
+            sign = -1.0f;
+            depth = toMax;
+        }
+    }
+
+    VectorTypeFor<dimensions, Float> normal;
+    normal[axis] = sign;
+    return {normal, depth};
+}
+
+/* Axes perpendicular to given direction, which together with the box face
+   normals are candidates for separating axis of the box and a line segment.
+   In 3D these are the cross products with the box edges. */
+inline std::size_t perpendicularAxes(const Vector2& direction, Vector2* out) {
+    if(direction.isZero()) return 0;
+    out[0] = direction.perpendicular().normalized();
+    return 1;
+}
+inline std::size_t perpendicularAxes(const Vector3& direction, Vector3* out) {
+    std::size_t count = 0;
+    for(const Vector3& edge: {Vector3::xAxis(), Vector3::yAxis(), Vector3::zAxis()}) {
+        const Vector3 axis = Math::cross(direction, edge);
+        const Float length = axis.length();
+        if(length <= Math::TypeTraits<Float>::epsilon()*direction.length()) continue;
+        out[count++] = axis/length;
+    }
+    return count;
+}
+
+/* Collision of the box with line segment `ab` (or infinite line going
+   through `a` and `b`) inflated by `radius`, i.e. with a capsule or an
+   infinite cylinder. The penetration depth is the depth of the segment
+   itself plus the radius, so:
+
+   - if the segment doesn't intersect the box, it is equivalent to collision
+     with a sphere placed on the segment point closest to the box,
+   - otherwise the minimal translation is found using separating axis test
+     with the box face normals and the axes perpendicular to the segment. The
+     segment projection is infinite on any axis not perpendicular to an
+     infinite line, so for it only the perpendicular axes are tested. */
+template<UnsignedInt dimensions> Collision<dimensions> inflatedSegmentCollision(const AxisAlignedBox<dimensions>& box, const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Float radius, const bool infinite) {
+    const VectorTypeFor<dimensions, Float> direction = b - a;
+    const auto squaredDistance = [&box](const VectorTypeFor<dimensions, Float>& point) {
+        return (point - Math::min(Math::max(point, box.min()), box.max())).dot();
+    };
+
+    /* Squared distance of the box and a point on the line is a convex and
+       piecewise quadratic function of the line parameter, its pieces being
+       separated by the parameters where the line crosses the box face planes.
+       For an infinite line the minimum lies between the outermost crossings,
+       outside of them the line only goes away from the box. */
+    Float params[2*dimensions + 2];
+    std::size_t paramCount = 0;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        if(direction[i] == 0.0f) continue;
+        params[paramCount++] = (box.min()[i] - a[i])/direction[i];
+        params[paramCount++] = (box.max()[i] - a[i])/direction[i];
+    }
+    Float min = 0.0f, max = 1.0f;
+    if(infinite) {
+        min = max = 0.0f;
+        if(paramCount) {
+            min = *std::min_element(params, params + paramCount);
+            max = *std::max_element(params, params + paramCount);
+        }
+    }
+    for(std::size_t i = 0; i != paramCount; ++i)
+        params[i] = Math::clamp(params[i], min, max);
+    params[paramCount++] = min;
+    params[paramCount++] = max;
+    std::sort(params, params + paramCount);
+
+    /* Check the minimum of each piece and the points between them */
+    Float closestParam = min;
+    Float closestDistance = squaredDistance(a + direction*min);
+    const auto check = [&](const Float t) {
+        const Float distance = squaredDistance(a + direction*t);
+        if(distance < closestDistance) {
+            closestParam = t;
+            closestDistance = distance;
+        }
+    };
+    for(std::size_t i = 0; i != paramCount; ++i) {
+        check(params[i]);
+        if(i + 1 == paramCount || params[i] == params[i + 1]) continue;
+
+        /* Coordinates outside of the box in the middle of the piece contribute
+           to the distance, minimize the sum of their squares */
+        const VectorTypeFor<dimensions, Float> middle = a + direction*((params[i] + params[i + 1])*0.5f);
+        Float numerator = 0.0f, denominator = 0.0f;
+        for(std::size_t j = 0; j != dimensions; ++j) {
+            Float bound;
+            if(middle[j] < box.min()[j]) bound = box.min()[j];
+            else if(middle[j] > box.max()[j]) bound = box.max()[j];
+            else continue;
+            numerator += direction[j]*(bound - a[j]);
+            denominator += direction[j]*direction[j];
+        }
+        if(denominator != 0.0f)
+            check(Math::clamp(numerator/denominator, params[i], params[i + 1]));
+    }
+
+    /* The segment doesn't intersect the box */
+    const VectorTypeFor<dimensions, Float> closest = a + direction*closestParam;
+    if(closestDistance > 0.0f)
+        return box/Sphere<dimensions>{closest, radius};
+
+    /* Otherwise find the separating axis with the smallest overlap */
+    VectorTypeFor<dimensions, Float> axes[dimensions*2];
+    std::size_t axisCount = 0;
+    if(!infinite || direction.isZero()) for(std::size_t i = 0; i != dimensions; ++i) {
+        axes[axisCount] = {};
+        axes[axisCount++][i] = 1.0f;
+    }
+    axisCount += perpendicularAxes(direction, axes + axisCount);
+
+    const VectorTypeFor<dimensions, Float> halfExtents = (box.max() - box.min())*0.5f;
+    const VectorTypeFor<dimensions, Float> distance = a + direction*0.5f - (box.min() + box.max())*0.5f;
+    VectorTypeFor<dimensions, Float> separatingNormal;
+    Float depth = Constants::inf();
+    for(std::size_t i = 0; i != axisCount; ++i) {
+        const Float projected = Math::dot(distance, axes[i]);
+        const Float overlap = Math::dot(Math::abs(axes[i]), halfExtents) +
+            (infinite ? 0.0f : Math::abs(Math::dot(direction, axes[i]))*0.5f) +
+            radius - Math::abs(projected);
+        if(overlap < depth) {
+            separatingNormal = projected < 0.0f ? axes[i] : -axes[i];
+            depth = overlap;
+        }
+    }
+
+    /* No collision occured, can happen only when touching with zero radius */
+    if(depth <= 0.0f) return {};
+
+    /* Contact position is on the segment end penetrating deepest in the
+       direction of separating normal (or on the closest point, if both ends
+       are equally deep), moved to the surface */
+    const Float endDirection = Math::dot(direction, separatingNormal);
+    const VectorTypeFor<dimensions, Float> deepest = infinite || endDirection == 0.0f ? closest : endDirection > 0.0f ? b : a;
+    return Collision<dimensions>(deepest + separatingNormal*radius, separatingNormal, depth);
+}
+
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Point<dimensions>& other) const {
+    /* No collision occured */
+    if(!(*this % other)) return {};
+
+    /* Push the box out along the axis with the smallest penetration,
+       collision position is on the point */
+    const std::pair<VectorTypeFor<dimensions, Float>, Float> face = nearestFace<dimensions>(_min, _max, other.position());
+    return Collision<dimensions>(other.position(), face.first, face.second);
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const Line<dimensions>& other) const {
+    return inflatedSegmentCollision(*this, other.a(), other.b(), 0.0f, true);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Line<dimensions>& other) const {
+    return inflatedSegmentCollision(*this, other.a(), other.b(), 0.0f, true);
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const LineSegment<dimensions>& other) const {
+    return inflatedSegmentCollision(*this, other.a(), other.b(), 0.0f, false);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const LineSegment<dimensions>& other) const {
+    return inflatedSegmentCollision(*this, other.a(), other.b(), 0.0f, false);
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const Sphere<dimensions>& other) const {
+    const VectorTypeFor<dimensions, Float> closest = Math::min(Math::max(other.position(), _min), _max);
+    return (other.position() - closest).dot() < Math::pow<2>(other.radius());
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Sphere<dimensions>& other) const {
+    const VectorTypeFor<dimensions, Float> closest = Math::min(Math::max(other.position(), _min), _max);
+    const VectorTypeFor<dimensions, Float> separating = closest - other.position();
+    const Float dot = separating.dot();
+
+    /* No collision occured */
+    if(dot >= Math::pow<2>(other.radius())) return {};
+
+    VectorTypeFor<dimensions, Float> separatingNormal;
+    Float distance;
+
+    /* Sphere center is inside the box, push the box out along the axis with
+       the smallest penetration */
+    if(dot == 0.0f) {
+        const std::pair<VectorTypeFor<dimensions, Float>, Float> face = nearestFace<dimensions>(_min, _max, other.position());
+        separatingNormal = face.first;
+        distance = face.second + other.radius();
+
+    /* Otherwise move the box away from the center */
+    } else {
+        const Float length = Math::sqrt(dot);
+        separatingNormal = separating/length;
+        distance = other.radius() - length;
+    }
+
+    /* Contact position is on the surface of the sphere */
+    return Collision<dimensions>(other.position() + separatingNormal*other.radius(), separatingNormal, distance);
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const Cylinder<dimensions>& other) const {
+    return inflatedSegmentCollision(*this, other.a(), other.b(), other.radius(), true);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Cylinder<dimensions>& other) const {
+    return inflatedSegmentCollision(*this, other.a(), other.b(), other.radius(), true);
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const Capsule<dimensions>& other) const {
+    return inflatedSegmentCollision(*this, other.a(), other.b(), other.radius(), false);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const Capsule<dimensions>& other) const {
+    return inflatedSegmentCollision(*this, other.a(), other.b(), other.radius(), false);
+}
+
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    return (_min < other._max).all() && (other._min < _max).all();
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const AxisAlignedBox<dimensions>& other) const {
+    /* No collision occured */
+    if(!(*this % other)) return {};
+
+    /* Find the smallest translation of this box along any axis direction that
+       separates the two */
+    std::size_t axis = 0;
+    Float sign = 1.0f;
+    Float distance = Constants::inf();
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        const Float positive = other._max[i] - _min[i];
+        const Float negative = _max[i] - other._min[i];
+        if(positive < distance) {
+            axis = i;
+            sign = 1.0f;
+            distance = positive;
+        }
+        if(negative < distance) {
+            axis = i;
+            sign = -1.0f;
+            distance = negative;
+        }
+    }
+
+    /* Contact position is on the face of `other`, centered on the overlapping
+       region in the remaining axes */
+    VectorTypeFor<dimensions, Float> position = (Math::max(_min, other._min) + Math::min(_max, other._max))*0.5f;
+    position[axis] = sign > 0.0f ? other._max[axis] : other._min[axis];
+
+    VectorTypeFor<dimensions, Float> separatingNormal;
+    separatingNormal[axis] = sign;
+    return Collision<dimensions>(position, separatingNormal, distance);
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<2>;
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<3>;
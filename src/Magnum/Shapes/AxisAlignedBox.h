@@ -31,6 +31,7 @@
 
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Shapes/Collision.h"
 #include "Magnum/Shapes/Shapes.h"
 #include "Magnum/Shapes/visibility.h"
 
@@ -85,6 +86,56 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AxisAlignedBox {
         /** @brief Collision occurence with point */
         bool operator%(const Point<dimensions>& other) const;
 
+        /** @brief Collision with point */
+        Collision<dimensions> operator/(const Point<dimensions>& other) const;
+
+        /** @brief Collision occurence with line */
+        bool operator%(const Line<dimensions>& other) const;
+
+        /** @brief Collision with line */
+        Collision<dimensions> operator/(const Line<dimensions>& other) const;
+
+        /** @brief Collision occurence with line segment */
+        bool operator%(const LineSegment<dimensions>& other) const;
+
+        /** @brief Collision with line segment */
+        Collision<dimensions> operator/(const LineSegment<dimensions>& other) const;
+
+        /** @brief Collision occurence with sphere */
+        bool operator%(const Sphere<dimensions>& other) const;
+
+        /** @brief Collision with sphere */
+        Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
+
+        /** @brief Collision occurence with cylinder */
+        bool operator%(const Cylinder<dimensions>& other) const;
+
+        /**
+         * @brief Collision with cylinder
+         *
+         * See @ref operator/(const Capsule<dimensions>&) const for details.
+         */
+        Collision<dimensions> operator/(const Cylinder<dimensions>& other) const;
+
+        /** @brief Collision occurence with capsule */
+        bool operator%(const Capsule<dimensions>& other) const;
+
+        /**
+         * @brief Collision with capsule
+         *
+         * If the capsule axis doesn't intersect the box, equivalent to
+         * collision with sphere placed on the axis point closest to the box.
+         * Otherwise the separation normal is the separating axis with the
+         * smallest penetration.
+         */
+        Collision<dimensions> operator/(const Capsule<dimensions>& other) const;
+
+        /** @brief Collision occurence with another axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief Collision with another axis-aligned box */
+        Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& other) const;
+
     private:
         VectorTypeFor<dimensions, Float> _min, _max;
 };
@@ -98,6 +149,39 @@ typedef AxisAlignedBox<3> AxisAlignedBox3D;
 /** @collisionoccurenceoperator{Point,AxisAlignedBox} */
 template<UnsignedInt dimensions> inline bool operator%(const Point<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
 
+/** @collisionoccurenceoperator{Line,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline bool operator%(const Line<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{LineSegment,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline bool operator%(const LineSegment<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Cylinder,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline bool operator%(const Cylinder<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Capsule,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline bool operator%(const Capsule<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Sphere,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Point,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Point<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Line,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Line<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{LineSegment,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const LineSegment<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Cylinder,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Cylinder<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Capsule,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Capsule<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Sphere,AxisAlignedBox} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const AxisAlignedBox<dimensions>& b) { return (b/a).flipped(); }
+
 }}
 
 #endif
@@ -0,0 +1,233 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Batch.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Shapes {
+
+namespace {
+
+/* Count of mask items needed for given count of shapes */
+inline std::size_t maskSize(const std::size_t count) {
+    return (count + 31)/32;
+}
+
+/* Collision bits of sphere with up to 32 points (if radii are nullptr) or
+   spheres. Branchless and going over contiguous arrays so it can be
+   vectorized, for full blocks the size is known at compile time. */
+template<UnsignedInt dimensions, bool withRadii> inline UnsignedInt sphereMaskWord(const Float(&position)[dimensions], const Float radius, const Float* const(&coordinates)[dimensions], const Float* const radii, const std::size_t offset, const std::size_t size) {
+    /* Tests first, packing the bits afterwards */
+    UnsignedInt collides[32];
+    for(std::size_t i = 0; i != size; ++i) {
+        Float distanceSquared = 0.0f;
+        for(UnsignedInt j = 0; j != dimensions; ++j) {
+            const Float delta = position[j] - coordinates[j][offset + i];
+            distanceSquared += delta*delta;
+        }
+
+        const Float radiusSum = withRadii ? radius + radii[offset + i] : radius;
+        collides[i] = UnsignedInt(distanceSquared < radiusSum*radiusSum);
+    }
+
+    UnsignedInt word = 0;
+    for(std::size_t i = 0; i != size; ++i)
+        word |= collides[i] << i;
+    return word;
+}
+
+template<UnsignedInt dimensions, bool withRadii> void sphereMaskInto(const Sphere<dimensions>& sphere, const std::vector<Float>* const coordinateArrays, const Float* const radii, const std::size_t count, UnsignedInt* const mask) {
+    Float position[dimensions];
+    const Float* coordinates[dimensions];
+    for(UnsignedInt j = 0; j != dimensions; ++j) {
+        position[j] = sphere.position()[j];
+        coordinates[j] = coordinateArrays[j].data();
+    }
+
+    const std::size_t fullBlockCount = count/32;
+    for(std::size_t i = 0; i != fullBlockCount; ++i)
+        mask[i] = sphereMaskWord<dimensions, withRadii>(position, sphere.radius(), coordinates, radii, i*32, 32);
+    if(count % 32)
+        mask[fullBlockCount] = sphereMaskWord<dimensions, withRadii>(position, sphere.radius(), coordinates, radii, fullBlockCount*32, count % 32);
+}
+
+void indicesInto(const UnsignedInt* const mask, const std::size_t count, std::vector<UnsignedInt>& indices) {
+    for(std::size_t i = 0; i != maskSize(count); ++i) {
+        for(UnsignedInt word = mask[i], bit = 0; word; word >>= 1, ++bit)
+            if(word & 1) indices.push_back(UnsignedInt(i*32 + bit));
+    }
+}
+
+}
+
+template<UnsignedInt dimensions> PointBatch<dimensions>::PointBatch() = default;
+
+template<UnsignedInt dimensions> void PointBatch<dimensions>::reserve(const std::size_t size) {
+    for(std::vector<Float>& coordinates: _coordinates)
+        coordinates.reserve(size);
+}
+
+template<UnsignedInt dimensions> void PointBatch<dimensions>::clear() {
+    for(std::vector<Float>& coordinates: _coordinates)
+        coordinates.clear();
+}
+
+template<UnsignedInt dimensions> PointBatch<dimensions>& PointBatch<dimensions>::add(const Point<dimensions>& point) {
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        _coordinates[i].push_back(point.position()[i]);
+    return *this;
+}
+
+template<UnsignedInt dimensions> Point<dimensions> PointBatch<dimensions>::operator[](const std::size_t i) const {
+    VectorTypeFor<dimensions, Float> position;
+    for(UnsignedInt j = 0; j != dimensions; ++j)
+        position[j] = _coordinates[j][i];
+    return Point<dimensions>{position};
+}
+
+template<UnsignedInt dimensions> void PointBatch<dimensions>::set(const std::size_t i, const Point<dimensions>& point) {
+    for(UnsignedInt j = 0; j != dimensions; ++j)
+        _coordinates[j][i] = point.position()[j];
+}
+
+template<UnsignedInt dimensions> const std::vector<Float>& PointBatch<dimensions>::coordinates(const UnsignedInt dimension) const {
+    CORRADE_ASSERT(dimension < dimensions,
+        "Shapes::PointBatch::coordinates(): dimension" << dimension << "out of range for" << dimensions << "dimensions", _coordinates[0]);
+    return _coordinates[dimension];
+}
+
+template<UnsignedInt dimensions> SphereBatch<dimensions>::SphereBatch() = default;
+
+template<UnsignedInt dimensions> void SphereBatch<dimensions>::reserve(const std::size_t size) {
+    for(std::vector<Float>& coordinates: _coordinates)
+        coordinates.reserve(size);
+    _radii.reserve(size);
+}
+
+template<UnsignedInt dimensions> void SphereBatch<dimensions>::clear() {
+    for(std::vector<Float>& coordinates: _coordinates)
+        coordinates.clear();
+    _radii.clear();
+}
+
+template<UnsignedInt dimensions> SphereBatch<dimensions>& SphereBatch<dimensions>::add(const Sphere<dimensions>& sphere) {
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        _coordinates[i].push_back(sphere.position()[i]);
+    _radii.push_back(sphere.radius());
+    return *this;
+}
+
+template<UnsignedInt dimensions> Sphere<dimensions> SphereBatch<dimensions>::operator[](const std::size_t i) const {
+    VectorTypeFor<dimensions, Float> position;
+    for(UnsignedInt j = 0; j != dimensions; ++j)
+        position[j] = _coordinates[j][i];
+    return Sphere<dimensions>{position, _radii[i]};
+}
+
+template<UnsignedInt dimensions> void SphereBatch<dimensions>::set(const std::size_t i, const Sphere<dimensions>& sphere) {
+    for(UnsignedInt j = 0; j != dimensions; ++j)
+        _coordinates[j][i] = sphere.position()[j];
+    _radii[i] = sphere.radius();
+}
+
+template<UnsignedInt dimensions> const std::vector<Float>& SphereBatch<dimensions>::coordinates(const UnsignedInt dimension) const {
+    CORRADE_ASSERT(dimension < dimensions,
+        "Shapes::SphereBatch::coordinates(): dimension" << dimension << "out of range for" << dimensions << "dimensions", _coordinates[0]);
+    return _coordinates[dimension];
+}
+
+template<UnsignedInt dimensions> std::vector<UnsignedInt> collisionMask(const Sphere<dimensions>& sphere, const PointBatch<dimensions>& points) {
+    std::vector<UnsignedInt> mask(maskSize(points.size()));
+    sphereMaskInto<dimensions, false>(sphere, &points.coordinates(0), nullptr, points.size(), mask.data());
+    return mask;
+}
+
+template<UnsignedInt dimensions> std::vector<UnsignedInt> collisionMask(const Sphere<dimensions>& sphere, const SphereBatch<dimensions>& spheres) {
+    std::vector<UnsignedInt> mask(maskSize(spheres.size()));
+    sphereMaskInto<dimensions, true>(sphere, &spheres.coordinates(0), spheres.radii().data(), spheres.size(), mask.data());
+    return mask;
+}
+
+template<UnsignedInt dimensions> std::vector<UnsignedInt> collisionMask(const SphereBatch<dimensions>& a, const SphereBatch<dimensions>& b) {
+    const std::size_t rowSize = maskSize(b.size());
+    std::vector<UnsignedInt> mask(a.size()*rowSize);
+    for(std::size_t i = 0; i != a.size(); ++i)
+        sphereMaskInto<dimensions, true>(a[i], &b.coordinates(0), b.radii().data(), b.size(), mask.data() + i*rowSize);
+    return mask;
+}
+
+template<UnsignedInt dimensions> std::vector<UnsignedInt> collisionIndices(const Sphere<dimensions>& sphere, const PointBatch<dimensions>& points) {
+    std::vector<UnsignedInt> indices;
+    indicesInto(collisionMask(sphere, points).data(), points.size(), indices);
+    return indices;
+}
+
+template<UnsignedInt dimensions> std::vector<UnsignedInt> collisionIndices(const Sphere<dimensions>& sphere, const SphereBatch<dimensions>& spheres) {
+    std::vector<UnsignedInt> indices;
+    indicesInto(collisionMask(sphere, spheres).data(), spheres.size(), indices);
+    return indices;
+}
+
+template<UnsignedInt dimensions> std::vector<std::pair<UnsignedInt, UnsignedInt>> collisionIndices(const SphereBatch<dimensions>& a, const SphereBatch<dimensions>& b) {
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> pairs;
+
+    /* Reusing the row mask and index arrays for all spheres */
+    std::vector<UnsignedInt> mask(maskSize(b.size()));
+    std::vector<UnsignedInt> indices;
+    for(std::size_t i = 0; i != a.size(); ++i) {
+        sphereMaskInto<dimensions, true>(a[i], &b.coordinates(0), b.radii().data(), b.size(), mask.data());
+        indices.clear();
+        indicesInto(mask.data(), b.size(), indices);
+        for(const UnsignedInt j: indices)
+            pairs.emplace_back(UnsignedInt(i), j);
+    }
+
+    return pairs;
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_SHAPES_EXPORT PointBatch<2>;
+template class MAGNUM_SHAPES_EXPORT PointBatch<3>;
+template class MAGNUM_SHAPES_EXPORT SphereBatch<2>;
+template class MAGNUM_SHAPES_EXPORT SphereBatch<3>;
+
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const Sphere<2>&, const PointBatch<2>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const Sphere<3>&, const PointBatch<3>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const Sphere<2>&, const SphereBatch<2>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const Sphere<3>&, const SphereBatch<3>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const SphereBatch<2>&, const SphereBatch<2>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const SphereBatch<3>&, const SphereBatch<3>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionIndices(const Sphere<2>&, const PointBatch<2>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionIndices(const Sphere<3>&, const PointBatch<3>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionIndices(const Sphere<2>&, const SphereBatch<2>&);
+template MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionIndices(const Sphere<3>&, const SphereBatch<3>&);
+template MAGNUM_SHAPES_EXPORT std::vector<std::pair<UnsignedInt, UnsignedInt>> collisionIndices(const SphereBatch<2>&, const SphereBatch<2>&);
+template MAGNUM_SHAPES_EXPORT std::vector<std::pair<UnsignedInt, UnsignedInt>> collisionIndices(const SphereBatch<3>&, const SphereBatch<3>&);
+#endif
+
+}}
@@ -0,0 +1,240 @@
+#ifndef Magnum_Shapes_Batch_h
+#define Magnum_Shapes_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shapes::PointBatch, @ref Magnum::Shapes::SphereBatch, typedef @ref Magnum::Shapes::PointBatch2D, @ref Magnum::Shapes::PointBatch3D, @ref Magnum::Shapes::SphereBatch2D, @ref Magnum::Shapes::SphereBatch3D, function @ref Magnum::Shapes::collisionMask(), @ref Magnum::Shapes::collisionIndices()
+ */
+
+#include <utility>
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/visibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Batch of points
+
+Stores positions of many points in structure-of-arrays layout, i.e. all X
+coordinates together, then all Y coordinates etc., for use in batch collision
+queries like @ref collisionMask() and @ref collisionIndices(). Compared to
+testing the shapes one by one using `%` operator, the queries don't go through
+any dispatch and the tight loops over the contiguous coordinate arrays can be
+vectorized by the compiler.
+@code
+Shapes::PointBatch3D crowd;
+crowd.reserve(people.size());
+for(const Person& person: people) crowd.add({person.position()});
+
+// Indices of all people the guard can hear
+std::vector<UnsignedInt> heard = Shapes::collisionIndices(
+    Shapes::Sphere3D{guard.position(), guard.hearingDistance()}, crowd);
+@endcode
+@see @ref PointBatch2D, @ref PointBatch3D, @ref SphereBatch
+*/
+template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT PointBatch {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates empty batch.
+         */
+        explicit PointBatch();
+
+        /** @brief Count of points in the batch */
+        std::size_t size() const { return _coordinates[0].size(); }
+
+        /** @brief Whether the batch is empty */
+        bool isEmpty() const { return _coordinates[0].empty(); }
+
+        /** @brief Reserve memory for given count of points */
+        void reserve(std::size_t size);
+
+        /** @brief Remove all points */
+        void clear();
+
+        /**
+         * @brief Add point to the batch
+         * @return Reference to self (for method chaining)
+         */
+        PointBatch<dimensions>& add(const Point<dimensions>& point);
+
+        /** @brief Point at given position */
+        Point<dimensions> operator[](std::size_t i) const;
+
+        /** @brief Replace point at given position */
+        void set(std::size_t i, const Point<dimensions>& point);
+
+        /**
+         * @brief Coordinates of all points in given dimension
+         *
+         * Expects that @p dimension is less than @ref Dimensions.
+         */
+        const std::vector<Float>& coordinates(UnsignedInt dimension) const;
+
+    private:
+        std::vector<Float> _coordinates[dimensions];
+};
+
+/**
+@brief Batch of spheres
+
+Stores positions and radii of many spheres in structure-of-arrays layout. See
+@ref PointBatch for more information.
+@see @ref SphereBatch2D, @ref SphereBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT SphereBatch {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates empty batch.
+         */
+        explicit SphereBatch();
+
+        /** @brief Count of spheres in the batch */
+        std::size_t size() const { return _radii.size(); }
+
+        /** @brief Whether the batch is empty */
+        bool isEmpty() const { return _radii.empty(); }
+
+        /** @brief Reserve memory for given count of spheres */
+        void reserve(std::size_t size);
+
+        /** @brief Remove all spheres */
+        void clear();
+
+        /**
+         * @brief Add sphere to the batch
+         * @return Reference to self (for method chaining)
+         */
+        SphereBatch<dimensions>& add(const Sphere<dimensions>& sphere);
+
+        /** @brief Sphere at given position */
+        Sphere<dimensions> operator[](std::size_t i) const;
+
+        /** @brief Replace sphere at given position */
+        void set(std::size_t i, const Sphere<dimensions>& sphere);
+
+        /**
+         * @brief Coordinates of all sphere centers in given dimension
+         *
+         * Expects that @p dimension is less than @ref Dimensions.
+         */
+        const std::vector<Float>& coordinates(UnsignedInt dimension) const;
+
+        /** @brief Radii of all spheres */
+        const std::vector<Float>& radii() const { return _radii; }
+
+    private:
+        std::vector<Float> _coordinates[dimensions];
+        std::vector<Float> _radii;
+};
+
+/** @brief Batch of two-dimensional points */
+typedef PointBatch<2> PointBatch2D;
+
+/** @brief Batch of three-dimensional points */
+typedef PointBatch<3> PointBatch3D;
+
+/** @brief Batch of two-dimensional spheres */
+typedef SphereBatch<2> SphereBatch2D;
+
+/** @brief Batch of three-dimensional spheres */
+typedef SphereBatch<3> SphereBatch3D;
+
+/**
+@brief Collision occurence of sphere with batch of points
+
+Returns bit mask with bit `i % 32` of item `i / 32` set if the sphere collides
+with point `i` in the batch. The result is the same as with
+@ref Sphere::operator%(const Point<dimensions>&) const.
+@see @ref collisionIndices()
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const Sphere<dimensions>& sphere, const PointBatch<dimensions>& points);
+
+/**
+@brief Collision occurence of sphere with batch of spheres
+
+Returns bit mask with bit `i % 32` of item `i / 32` set if the sphere collides
+with sphere `i` in the batch. The result is the same as with
+@ref Sphere::operator%(const Sphere<dimensions>&) const.
+@see @ref collisionIndices()
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const Sphere<dimensions>& sphere, const SphereBatch<dimensions>& spheres);
+
+/**
+@brief Collision occurence of each sphere in one batch with each in another
+
+Returns bit mask with one row for each sphere in @p a, each row is
+`(b.size() + 31)/32` items long and has the same layout as in
+@ref collisionMask(const Sphere<dimensions>&, const SphereBatch<dimensions>&).
+@see @ref collisionIndices()
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionMask(const SphereBatch<dimensions>& a, const SphereBatch<dimensions>& b);
+
+/**
+@brief Indices of points colliding with sphere
+
+Returns indices of points in the batch colliding with the sphere, in
+ascending order.
+@see @ref collisionMask()
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionIndices(const Sphere<dimensions>& sphere, const PointBatch<dimensions>& points);
+
+/**
+@brief Indices of spheres colliding with sphere
+
+Returns indices of spheres in the batch colliding with the sphere, in
+ascending order.
+@see @ref collisionMask()
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::vector<UnsignedInt> collisionIndices(const Sphere<dimensions>& sphere, const SphereBatch<dimensions>& spheres);
+
+/**
+@brief Indices of colliding spheres from two batches
+
+Returns pairs of indices of colliding spheres, first from @p a, second from
+@p b, ordered by the first and then the second index.
+@see @ref collisionMask()
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::vector<std::pair<UnsignedInt, UnsignedInt>> collisionIndices(const SphereBatch<dimensions>& a, const SphereBatch<dimensions>& b);
+
+}}
+
+#endif
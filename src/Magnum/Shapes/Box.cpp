@@ -25,12 +25,253 @@
 
 #include "Box.h"
 
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+
 namespace Magnum { namespace Shapes {
 
+namespace {
+
+/* Box decomposed into center, unit axes and half extents. The transformation
+   is expected to have no skew, so the axes are orthogonal. */
+template<UnsignedInt dimensions> struct BoxFrame {
+    explicit BoxFrame(const MatrixTypeFor<dimensions, Float>& transformation): center{transformation.translation()} {
+        for(std::size_t i = 0; i != dimensions; ++i) {
+            VectorTypeFor<dimensions, Float> axis;
+            axis[i] = 1.0f;
+            const VectorTypeFor<dimensions, Float> transformed = transformation.transformVector(axis);
+            halfExtents[i] = transformed.length();
+            axes[i] = halfExtents[i] == 0.0f ? axis : transformed/halfExtents[i];
+        }
+    }
+
+    /* Half size of the box projected on given unit axis */
+    Float projectedRadius(const VectorTypeFor<dimensions, Float>& axis) const {
+        Float radius = 0.0f;
+        for(std::size_t i = 0; i != dimensions; ++i)
+            radius += Math::abs(Math::dot(axis, axes[i]))*halfExtents[i];
+        return radius;
+    }
+
+    /* Vertex of the box furthest in given direction */
+    VectorTypeFor<dimensions, Float> support(const VectorTypeFor<dimensions, Float>& direction) const {
+        VectorTypeFor<dimensions, Float> out = center;
+        for(std::size_t i = 0; i != dimensions; ++i)
+            out += axes[i]*(Math::dot(direction, axes[i]) < 0.0f ? -halfExtents[i] : halfExtents[i]);
+        return out;
+    }
+
+    /* Conversion of directions from and to box space with unit axes */
+    VectorTypeFor<dimensions, Float> toLocal(const VectorTypeFor<dimensions, Float>& vector) const {
+        VectorTypeFor<dimensions, Float> out;
+        for(std::size_t i = 0; i != dimensions; ++i)
+            out[i] = Math::dot(vector, axes[i]);
+        return out;
+    }
+    VectorTypeFor<dimensions, Float> fromLocal(const VectorTypeFor<dimensions, Float>& vector) const {
+        VectorTypeFor<dimensions, Float> out;
+        for(std::size_t i = 0; i != dimensions; ++i)
+            out += axes[i]*vector[i];
+        return out;
+    }
+    VectorTypeFor<dimensions, Float> toLocalPoint(const VectorTypeFor<dimensions, Float>& point) const {
+        return toLocal(point - center);
+    }
+
+    /* In box space with unit axes the box is axis-aligned. Unlike the box
+       transformation the conversion preserves lengths, so the collision
+       calculated there needs only the position and normal converted back. */
+    AxisAlignedBox<dimensions> localBox() const {
+        return {-halfExtents, halfExtents};
+    }
+    Collision<dimensions> fromLocal(const Collision<dimensions>& collision) const {
+        /* No collision occured */
+        if(!collision) return {};
+
+        return Collision<dimensions>(center + fromLocal(collision.position()), fromLocal(collision.separationNormal()), collision.separationDistance());
+    }
+
+    VectorTypeFor<dimensions, Float> center, halfExtents;
+    VectorTypeFor<dimensions, Float> axes[dimensions];
+};
+
+/* In 3D the edge cross products are also candidates for separating axis,
+   parallel edges are already covered by the face normals */
+inline std::size_t edgeAxes(const BoxFrame<2>&, const BoxFrame<2>&, Vector2*) { return 0; }
+inline std::size_t edgeAxes(const BoxFrame<3>& a, const BoxFrame<3>& b, Vector3* out) {
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != 3; ++i) for(std::size_t j = 0; j != 3; ++j) {
+        const Vector3 axis = Math::cross(a.axes[i], b.axes[j]);
+        const Float length = axis.length();
+        if(length < Math::TypeTraits<Float>::epsilon()) continue;
+        out[count++] = axis/length;
+    }
+    return count;
+}
+
+/* Separating axis test. Returns the axis along which should box `a` move to
+   get separated from `b` with the smallest penetration and the penetration
+   depth, which is zero or negative if the boxes don't collide. */
+template<UnsignedInt dimensions> std::pair<VectorTypeFor<dimensions, Float>, Float> separation(const BoxFrame<dimensions>& a, const BoxFrame<dimensions>& b) {
+    VectorTypeFor<dimensions, Float> axes[dimensions == 3 ? 15 : 4];
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        axes[count++] = a.axes[i];
+        axes[count++] = b.axes[i];
+    }
+    count += edgeAxes(a, b, axes + count);
+
+    const VectorTypeFor<dimensions, Float> distance = b.center - a.center;
+    VectorTypeFor<dimensions, Float> separatingNormal;
+    Float depth = Constants::inf();
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float projected = Math::dot(distance, axes[i]);
+        const Float overlap = a.projectedRadius(axes[i]) + b.projectedRadius(axes[i]) - Math::abs(projected);
+
+        /* Found separating axis, no collision */
+        if(overlap <= 0.0f) return {{}, overlap};
+
+        if(overlap < depth) {
+            separatingNormal = projected < 0.0f ? axes[i] : -axes[i];
+            depth = overlap;
+        }
+    }
+
+    return {separatingNormal, depth};
+}
+
+template<UnsignedInt dimensions> Box<dimensions> boxFromAxisAlignedBox(const AxisAlignedBox<dimensions>& box) {
+    return Box<dimensions>{MatrixTypeFor<dimensions, Float>::translation((box.min() + box.max())*0.5f)*
+        MatrixTypeFor<dimensions, Float>::scaling((box.max() - box.min())*0.5f)};
+}
+
+}
+
 template<UnsignedInt dimensions> Box<dimensions> Box<dimensions>::transformed(const MatrixTypeFor<dimensions, Float>& matrix) const {
     return Box<dimensions>(matrix*_transformation);
 }
 
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Point<dimensions>& other) const {
+    /* Transform the point into box space, where it is unit-size */
+    const VectorTypeFor<dimensions, Float> local = _transformation.inverted().transformPoint(other.position());
+    return (Math::abs(local) < VectorTypeFor<dimensions, Float>{1.0f}).all();
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Point<dimensions>& other) const {
+    const VectorTypeFor<dimensions, Float> local = _transformation.inverted().transformPoint(other.position());
+
+    /* No collision occured */
+    if(!(Math::abs(local) < VectorTypeFor<dimensions, Float>{1.0f}).all())
+        return {};
+
+    /* Push the box out through the face nearest to the point, measuring the
+       penetration in world space */
+    VectorTypeFor<dimensions, Float> separatingNormal;
+    Float distance = Constants::inf();
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        VectorTypeFor<dimensions, Float> axis;
+        axis[i] = 1.0f;
+        axis = _transformation.transformVector(axis);
+        const Float length = axis.length();
+
+        const Float toPositive = (1.0f - local[i])*length;
+        const Float toNegative = (local[i] + 1.0f)*length;
+        if(toPositive < distance) {
+            separatingNormal = -axis/length;
+            distance = toPositive;
+        }
+        if(toNegative < distance) {
+            separatingNormal = axis/length;
+            distance = toNegative;
+        }
+    }
+
+    /* Collision position is on the point */
+    return Collision<dimensions>(other.position(), separatingNormal, distance);
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Line<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.localBox() % Line<dimensions>{frame.toLocalPoint(other.a()), frame.toLocalPoint(other.b())};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Line<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.fromLocal(frame.localBox()/Line<dimensions>{frame.toLocalPoint(other.a()), frame.toLocalPoint(other.b())});
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const LineSegment<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.localBox() % LineSegment<dimensions>{frame.toLocalPoint(other.a()), frame.toLocalPoint(other.b())};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const LineSegment<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.fromLocal(frame.localBox()/LineSegment<dimensions>{frame.toLocalPoint(other.a()), frame.toLocalPoint(other.b())});
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Sphere<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.localBox() % Sphere<dimensions>{frame.toLocalPoint(other.position()), other.radius()};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Sphere<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.fromLocal(frame.localBox()/Sphere<dimensions>{frame.toLocalPoint(other.position()), other.radius()});
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Cylinder<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.localBox() % Cylinder<dimensions>{frame.toLocalPoint(other.a()), frame.toLocalPoint(other.b()), other.radius()};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Cylinder<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.fromLocal(frame.localBox()/Cylinder<dimensions>{frame.toLocalPoint(other.a()), frame.toLocalPoint(other.b()), other.radius()});
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Capsule<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.localBox() % Capsule<dimensions>{frame.toLocalPoint(other.a()), frame.toLocalPoint(other.b()), other.radius()};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Capsule<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{_transformation};
+    return frame.fromLocal(frame.localBox()/Capsule<dimensions>{frame.toLocalPoint(other.a()), frame.toLocalPoint(other.b()), other.radius()});
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    return *this % boxFromAxisAlignedBox(other);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const AxisAlignedBox<dimensions>& other) const {
+    return *this/boxFromAxisAlignedBox(other);
+}
+
+template<UnsignedInt dimensions> bool Box<dimensions>::operator%(const Box<dimensions>& other) const {
+    return separation(BoxFrame<dimensions>{_transformation}, BoxFrame<dimensions>{other._transformation}).second > 0.0f;
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Box<dimensions>::operator/(const Box<dimensions>& other) const {
+    const BoxFrame<dimensions> frame{other._transformation};
+    const std::pair<VectorTypeFor<dimensions, Float>, Float> separating = separation(BoxFrame<dimensions>{_transformation}, frame);
+
+    /* No collision occured */
+    if(separating.second <= 0.0f) return {};
+
+    /* Collision position is on the vertex of the other box which penetrates
+       deepest */
+    return Collision<dimensions>(frame.support(separating.first), separating.first, separating.second);
+}
+
 template class Box<2>;
 template class Box<3>;
 
@@ -32,6 +32,8 @@
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/Collision.h"
+#include "Magnum/Shapes/Shapes.h"
 #include "Magnum/Shapes/visibility.h"
 
 namespace Magnum { namespace Shapes {
@@ -74,6 +76,75 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Box {
             _transformation = transformation;
         }
 
+        /** @brief Collision occurence with point */
+        bool operator%(const Point<dimensions>& other) const;
+
+        /** @brief Collision with point */
+        Collision<dimensions> operator/(const Point<dimensions>& other) const;
+
+        /** @brief Collision occurence with line */
+        bool operator%(const Line<dimensions>& other) const;
+
+        /** @brief Collision with line */
+        Collision<dimensions> operator/(const Line<dimensions>& other) const;
+
+        /** @brief Collision occurence with line segment */
+        bool operator%(const LineSegment<dimensions>& other) const;
+
+        /** @brief Collision with line segment */
+        Collision<dimensions> operator/(const LineSegment<dimensions>& other) const;
+
+        /** @brief Collision occurence with sphere */
+        bool operator%(const Sphere<dimensions>& other) const;
+
+        /** @brief Collision with sphere */
+        Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
+
+        /** @brief Collision occurence with cylinder */
+        bool operator%(const Cylinder<dimensions>& other) const;
+
+        /**
+         * @brief Collision with cylinder
+         *
+         * See @ref operator/(const Capsule<dimensions>&) const for details.
+         */
+        Collision<dimensions> operator/(const Cylinder<dimensions>& other) const;
+
+        /** @brief Collision occurence with capsule */
+        bool operator%(const Capsule<dimensions>& other) const;
+
+        /**
+         * @brief Collision with capsule
+         *
+         * If the capsule axis doesn't intersect the box, equivalent to
+         * collision with sphere placed on the axis point closest to the box.
+         * Otherwise the separation normal is the separating axis with the
+         * smallest penetration.
+         */
+        Collision<dimensions> operator/(const Capsule<dimensions>& other) const;
+
+        /** @brief Collision occurence with axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
+        /**
+         * @brief Collision with axis-aligned box
+         *
+         * See @ref operator/(const Box<dimensions>&) const for details.
+         */
+        Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief Collision occurence with other box */
+        bool operator%(const Box<dimensions>& other) const;
+
+        /**
+         * @brief Collision with other box
+         *
+         * Separation normal is the separating axis with the smallest
+         * penetration, contact position is the vertex of @p other
+         * penetrating deepest in that direction.
+         */
+        Collision<dimensions> operator/(const Box<dimensions>& other) const;
+
     private:
         MatrixTypeFor<dimensions, Float> _transformation;
 };
@@ -84,6 +155,48 @@ typedef Box<2> Box2D;
 /** @brief Three-dimensional box */
 typedef Box<3> Box3D;
 
+/** @collisionoccurenceoperator{Point,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Point<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Line,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Line<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{LineSegment,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const LineSegment<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Cylinder,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Cylinder<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Capsule,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Capsule<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Sphere,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{AxisAlignedBox,Box} */
+template<UnsignedInt dimensions> inline bool operator%(const AxisAlignedBox<dimensions>& a, const Box<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Point,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Point<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Line,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Line<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{LineSegment,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const LineSegment<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Cylinder,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Cylinder<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Capsule,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Capsule<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Sphere,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{AxisAlignedBox,Box} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& a, const Box<dimensions>& b) { return (b/a).flipped(); }
+
 }}
 
 #endif
@@ -30,8 +30,11 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Geometry/Distance.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/Implementation/ClosestPoint.h"
 
 using namespace Magnum::Math::Geometry;
 
@@ -46,11 +49,65 @@ template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Point
         Math::pow<2>(_radius);
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Point<dimensions>& other) const {
+    /* Equivalent to collision with sphere placed on the axis point closest to
+       the other shape */
+    return Sphere<dimensions>{Implementation::lineSegmentClosestPoint(_a, _b, other.position()), _radius}/other;
+}
+
+template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Line<dimensions>& other) const {
+    const std::pair<VectorTypeFor<dimensions, Float>, VectorTypeFor<dimensions, Float>> closest = Implementation::lineSegmentLineSegmentClosestPoints(other.a(), other.b(), _a, _b, true);
+    return (closest.second - closest.first).dot() < Math::pow<2>(_radius);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Line<dimensions>& other) const {
+    /* Equivalent to collision of sphere placed on the axis point closest to
+       the line with the closest point on the line */
+    const std::pair<VectorTypeFor<dimensions, Float>, VectorTypeFor<dimensions, Float>> closest = Implementation::lineSegmentLineSegmentClosestPoints(other.a(), other.b(), _a, _b, true);
+    return Sphere<dimensions>{closest.second, _radius}/Point<dimensions>{closest.first};
+}
+
+template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const LineSegment<dimensions>& other) const {
+    const std::pair<VectorTypeFor<dimensions, Float>, VectorTypeFor<dimensions, Float>> closest = Implementation::lineSegmentLineSegmentClosestPoints(_a, _b, other.a(), other.b());
+    return (closest.first - closest.second).dot() < Math::pow<2>(_radius);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const LineSegment<dimensions>& other) const {
+    const std::pair<VectorTypeFor<dimensions, Float>, VectorTypeFor<dimensions, Float>> closest = Implementation::lineSegmentLineSegmentClosestPoints(_a, _b, other.a(), other.b());
+    return Sphere<dimensions>{closest.first, _radius}/Point<dimensions>{closest.second};
+}
+
 template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Sphere<dimensions>& other) const {
     return Distance::lineSegmentPointSquared(_a, _b, other.position()) <
         Math::pow<2>(_radius+other.radius());
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Sphere<dimensions>& other) const {
+    return Sphere<dimensions>{Implementation::lineSegmentClosestPoint(_a, _b, other.position()), _radius}/other;
+}
+
+template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Cylinder<dimensions>& other) const {
+    const std::pair<VectorTypeFor<dimensions, Float>, VectorTypeFor<dimensions, Float>> closest = Implementation::lineSegmentLineSegmentClosestPoints(other.a(), other.b(), _a, _b, true);
+    return (closest.second - closest.first).dot() < Math::pow<2>(_radius+other.radius());
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Cylinder<dimensions>& other) const {
+    /* Equivalent to collision of two spheres placed on the closest points of
+       both axes */
+    const std::pair<VectorTypeFor<dimensions, Float>, VectorTypeFor<dimensions, Float>> closest = Implementation::lineSegmentLineSegmentClosestPoints(other.a(), other.b(), _a, _b, true);
+    return Sphere<dimensions>{closest.second, _radius}/Sphere<dimensions>{closest.first, other.radius()};
+}
+
+template<UnsignedInt dimensions> bool Capsule<dimensions>::operator%(const Capsule<dimensions>& other) const {
+    const std::pair<VectorTypeFor<dimensions, Float>, VectorTypeFor<dimensions, Float>> closest = Implementation::lineSegmentLineSegmentClosestPoints(_a, _b, other._a, other._b);
+    return (closest.first - closest.second).dot() < Math::pow<2>(_radius+other._radius);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> Capsule<dimensions>::operator/(const Capsule<dimensions>& other) const {
+    const std::pair<VectorTypeFor<dimensions, Float>, VectorTypeFor<dimensions, Float>> closest = Implementation::lineSegmentLineSegmentClosestPoints(_a, _b, other._a, other._b);
+    return Sphere<dimensions>{closest.first, _radius}/Sphere<dimensions>{closest.second, other._radius};
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT Capsule<2>;
 template class MAGNUM_SHAPES_EXPORT Capsule<3>;
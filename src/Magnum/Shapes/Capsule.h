@@ -31,6 +31,7 @@
 
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Shapes/Collision.h"
 #include "Magnum/Shapes/Shapes.h"
 #include "Magnum/Shapes/visibility.h"
 
@@ -93,9 +94,39 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Capsule {
         /** @brief Collision occurence with point */
         bool operator%(const Point<dimensions>& other) const;
 
+        /** @brief Collision with point */
+        Collision<dimensions> operator/(const Point<dimensions>& other) const;
+
+        /** @brief Collision occurence with line */
+        bool operator%(const Line<dimensions>& other) const;
+
+        /** @brief Collision with line */
+        Collision<dimensions> operator/(const Line<dimensions>& other) const;
+
+        /** @brief Collision occurence with line segment */
+        bool operator%(const LineSegment<dimensions>& other) const;
+
+        /** @brief Collision with line segment */
+        Collision<dimensions> operator/(const LineSegment<dimensions>& other) const;
+
         /** @brief Collision occurence with sphere */
         bool operator%(const Sphere<dimensions>& other) const;
 
+        /** @brief Collision with sphere */
+        Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
+
+        /** @brief Collision occurence with cylinder */
+        bool operator%(const Cylinder<dimensions>& other) const;
+
+        /** @brief Collision with cylinder */
+        Collision<dimensions> operator/(const Cylinder<dimensions>& other) const;
+
+        /** @brief Collision occurence with other capsule */
+        bool operator%(const Capsule<dimensions>& other) const;
+
+        /** @brief Collision with other capsule */
+        Collision<dimensions> operator/(const Capsule<dimensions>& other) const;
+
     private:
         VectorTypeFor<dimensions, Float> _a, _b;
         Float _radius;
@@ -110,9 +141,33 @@ typedef Capsule<3> Capsule3D;
 /** @collisionoccurenceoperator{Point,Capsule} */
 template<UnsignedInt dimensions> inline bool operator%(const Point<dimensions>& a, const Capsule<dimensions>& b) { return b % a; }
 
+/** @collisionoccurenceoperator{Line,Capsule} */
+template<UnsignedInt dimensions> inline bool operator%(const Line<dimensions>& a, const Capsule<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{LineSegment,Capsule} */
+template<UnsignedInt dimensions> inline bool operator%(const LineSegment<dimensions>& a, const Capsule<dimensions>& b) { return b % a; }
+
 /** @collisionoccurenceoperator{Sphere,Capsule} */
 template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const Capsule<dimensions>& b) { return b % a; }
 
+/** @collisionoccurenceoperator{Cylinder,Capsule} */
+template<UnsignedInt dimensions> inline bool operator%(const Cylinder<dimensions>& a, const Capsule<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Point,Capsule} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Point<dimensions>& a, const Capsule<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Line,Capsule} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Line<dimensions>& a, const Capsule<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{LineSegment,Capsule} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const LineSegment<dimensions>& a, const Capsule<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Sphere,Capsule} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const Capsule<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Cylinder,Capsule} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Cylinder<dimensions>& a, const Capsule<dimensions>& b) { return (b/a).flipped(); }
+
 }}
 
 #endif
@@ -50,6 +50,9 @@ namespace Implementation {
     template<UnsignedInt dimensions> inline const AbstractShape<dimensions>& getAbstractShape(const Composition<dimensions>& group, std::size_t i) {
         return *group._shapes[i];
     }
+    template<UnsignedInt dimensions> inline bool compositionCollides(const Composition<dimensions>& composition, const AbstractShape<dimensions>& shape) {
+        return composition.collides(shape);
+    }
 }
 
 /** @brief Shape operation */
@@ -67,6 +70,7 @@ Result of logical operations on shapes. See @ref shapes for brief introduction.
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
     friend Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(Composition<dimensions>&, std::size_t);
     friend const Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(const Composition<dimensions>&, std::size_t);
+    friend bool Implementation::compositionCollides<>(const Composition<dimensions>&, const Implementation::AbstractShape<dimensions>&);
     friend Implementation::ShapeHelper<Composition<dimensions>>;
 
     public:
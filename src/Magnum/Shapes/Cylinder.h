@@ -31,6 +31,7 @@
 
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Shapes/Collision.h"
 #include "Magnum/Shapes/Shapes.h"
 #include "Magnum/Shapes/visibility.h"
 
@@ -93,9 +94,33 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Cylinder {
         /** @brief Collision occurence with point */
         bool operator%(const Point<dimensions>& other) const;
 
+        /** @brief Collision with point */
+        Collision<dimensions> operator/(const Point<dimensions>& other) const;
+
+        /** @brief Collision occurence with line */
+        bool operator%(const Line<dimensions>& other) const;
+
+        /** @brief Collision with line */
+        Collision<dimensions> operator/(const Line<dimensions>& other) const;
+
+        /** @brief Collision occurence with line segment */
+        bool operator%(const LineSegment<dimensions>& other) const;
+
+        /** @brief Collision with line segment */
+        Collision<dimensions> operator/(const LineSegment<dimensions>& other) const;
+
         /** @brief Collision occurence with sphere */
         bool operator%(const Sphere<dimensions>& other) const;
 
+        /** @brief Collision with sphere */
+        Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
+
+        /** @brief Collision occurence with other cylinder */
+        bool operator%(const Cylinder<dimensions>& other) const;
+
+        /** @brief Collision with other cylinder */
+        Collision<dimensions> operator/(const Cylinder<dimensions>& other) const;
+
     private:
         VectorTypeFor<dimensions, Float> _a, _b;
         Float _radius;
@@ -110,9 +135,27 @@ typedef Cylinder<3> Cylinder3D;
 /** @collisionoccurenceoperator{Point,Cylinder} */
 template<UnsignedInt dimensions> inline bool operator%(const Point<dimensions>& a, const Cylinder<dimensions>& b) { return b % a; }
 
+/** @collisionoccurenceoperator{Line,Cylinder} */
+template<UnsignedInt dimensions> inline bool operator%(const Line<dimensions>& a, const Cylinder<dimensions>& b) { return b % a; }
+
+/** @collisionoccurenceoperator{LineSegment,Cylinder} */
+template<UnsignedInt dimensions> inline bool operator%(const LineSegment<dimensions>& a, const Cylinder<dimensions>& b) { return b % a; }
+
 /** @collisionoccurenceoperator{Sphere,Cylinder} */
 template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const Cylinder<dimensions>& b) { return b % a; }
 
+/** @collisionoperator{Point,Cylinder} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Point<dimensions>& a, const Cylinder<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Line,Cylinder} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Line<dimensions>& a, const Cylinder<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{LineSegment,Cylinder} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const LineSegment<dimensions>& a, const Cylinder<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Sphere,Cylinder} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const Cylinder<dimensions>& b) { return (b/a).flipped(); }
+
 }}
 
 #endif
@@ -0,0 +1,104 @@
+#ifndef Magnum_Shapes_Implementation_ClosestPoint_h
+#define Magnum_Shapes_Implementation_ClosestPoint_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+/* Closest point on infinite line going through a and b. Degenerate line
+   collapses to a. */
+template<std::size_t size> Math::Vector<size, Float> lineClosestPoint(const Math::Vector<size, Float>& a, const Math::Vector<size, Float>& b, const Math::Vector<size, Float>& point) {
+    const Math::Vector<size, Float> bMinusA = b - a;
+    const Float length = bMinusA.dot();
+    if(length == 0.0f) return a;
+    return a + bMinusA*(Math::dot(point - a, bMinusA)/length);
+}
+
+/* Closest point on line segment ab */
+template<std::size_t size> Math::Vector<size, Float> lineSegmentClosestPoint(const Math::Vector<size, Float>& a, const Math::Vector<size, Float>& b, const Math::Vector<size, Float>& point) {
+    const Math::Vector<size, Float> bMinusA = b - a;
+    const Float length = bMinusA.dot();
+    if(length == 0.0f) return a;
+    return a + bMinusA*Math::clamp(Math::dot(point - a, bMinusA)/length, 0.0f, 1.0f);
+}
+
+/* Pair of closest points on line segments ab and cd. If `infiniteAB` or
+   `infiniteCD` is set, ab or cd is treated as an infinite line. Degenerate
+   segments collapse to their first point, for parallel segments an arbitrary
+   pair is returned. */
+template<std::size_t size> std::pair<Math::Vector<size, Float>, Math::Vector<size, Float>> lineSegmentLineSegmentClosestPoints(const Math::Vector<size, Float>& a, const Math::Vector<size, Float>& b, const Math::Vector<size, Float>& c, const Math::Vector<size, Float>& d, const bool infiniteAB = false, const bool infiniteCD = false) {
+    const Math::Vector<size, Float> bMinusA = b - a;
+    const Math::Vector<size, Float> dMinusC = d - c;
+    const Math::Vector<size, Float> aMinusC = a - c;
+    const Float lengthAB = bMinusA.dot();
+    const Float lengthCD = dMinusC.dot();
+    const Float f = Math::dot(dMinusC, aMinusC);
+
+    const auto clampAB = [infiniteAB](const Float t) {
+        return infiniteAB ? t : Math::clamp(t, 0.0f, 1.0f);
+    };
+    const auto clampCD = [infiniteCD](const Float t) {
+        return infiniteCD ? t : Math::clamp(t, 0.0f, 1.0f);
+    };
+
+    /* Parameters of the closest points on ab and cd */
+    Float s = 0.0f;
+    Float t = 0.0f;
+    if(lengthAB == 0.0f) {
+        if(lengthCD != 0.0f) t = clampCD(f/lengthCD);
+    } else {
+        const Float e = Math::dot(bMinusA, aMinusC);
+        if(lengthCD == 0.0f) s = clampAB(-e/lengthAB);
+        else {
+            const Float dot = Math::dot(bMinusA, dMinusC);
+            const Float denominator = lengthAB*lengthCD - dot*dot;
+            if(denominator != 0.0f) s = clampAB((dot*f - e*lengthCD)/denominator);
+
+            /* Closest point on cd to the point on ab, if it is outside of
+               the segment, recalculate the point on ab from the clamped one.
+               Not needed if cd is an infinite line. */
+            t = (dot*s + f)/lengthCD;
+            if(!infiniteCD && t < 0.0f) {
+                t = 0.0f;
+                s = clampAB(-e/lengthAB);
+            } else if(!infiniteCD && t > 1.0f) {
+                t = 1.0f;
+                s = clampAB((dot - e)/lengthAB);
+            }
+        }
+    }
+
+    return {a + bMinusA*s, c + dMinusC*t};
+}
+
+}}}
+
+#endif
@@ -28,6 +28,7 @@
 #include "Magnum/Shapes/AxisAlignedBox.h"
 #include "Magnum/Shapes/Box.h"
 #include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Composition.h"
 #include "Magnum/Shapes/Cylinder.h"
 #include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Plane.h"
@@ -37,93 +38,229 @@
 
 namespace Magnum { namespace Shapes { namespace Implementation {
 
-template<> bool collides(const AbstractShape<2>& a, const AbstractShape<2>& b) {
-    if(a.type() < b.type()) return collides(b, a);
+namespace {
 
-    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
-        #define _c(aType, aClass, bType, bClass) \
-            case UnsignedInt(ShapeDimensionTraits<2>::Type::aType)*UnsignedInt(ShapeDimensionTraits<2>::Type::bType): \
-                return static_cast<const Shape<aClass>&>(a).shape % static_cast<const Shape<bClass>&>(b).shape;
-        _c(Sphere, Sphere2D, Point, Point2D)
-        _c(Sphere, Sphere2D, Line, Line2D)
-        _c(Sphere, Sphere2D, LineSegment, LineSegment2D)
-        _c(Sphere, Sphere2D, Sphere, Sphere2D)
+/* Dense index for each shape type prime, used to address the dispatch
+   tables. The last entries are shared between 2D Composition and 3D Plane /
+   Composition. */
+constexpr std::size_t TypeCount = 11;
+constexpr UnsignedByte TypeIndex[]{
+    0xff,  0,  1,  2, 0xff,  3, 0xff,  4, 0xff, 0xff,
+    0xff,  5, 0xff,  6, 0xff, 0xff, 0xff,  7, 0xff,  8,
+    0xff, 0xff, 0xff,  9, 0xff, 0xff, 0xff, 0xff, 0xff, 10
+};
 
-        _c(InvertedSphere, InvertedSphere2D, Point, Point2D)
-        _c(InvertedSphere, InvertedSphere2D, Sphere, Sphere2D)
+template<class T> constexpr std::size_t typeIndex(const T type) {
+    return TypeIndex[UnsignedByte(type)];
+}
 
-        _c(Cylinder, Cylinder2D, Point, Point2D)
-        _c(Cylinder, Cylinder2D, Sphere, Sphere2D)
+/* For pairs of zero-sized shapes, which are never reported as colliding, and
+   for pairs that are not implemented */
+template<UnsignedInt dimensions> bool collidesNone(const AbstractShape<dimensions>&, const AbstractShape<dimensions>&) {
+    return false;
+}
 
-        _c(Capsule, Capsule2D, Point, Point2D)
-        _c(Capsule, Capsule2D, Sphere, Sphere2D)
+/* For pairs of unbounded shapes which always intersect */
+template<UnsignedInt dimensions> bool collidesAlways(const AbstractShape<dimensions>&, const AbstractShape<dimensions>&) {
+    return true;
+}
 
-        _c(AxisAlignedBox, AxisAlignedBox2D, Point, Point2D)
-        #undef _c
-    }
+/* For pairs which have only collision occurence, as they have no finite
+   penetration depth */
+template<UnsignedInt dimensions> Collision<dimensions> collisionNone(const AbstractShape<dimensions>&, const AbstractShape<dimensions>&) {
+    return {};
+}
 
-    return false;
+template<class A, class B> bool collidesImplementation(const AbstractShape<A::Dimensions>& a, const AbstractShape<A::Dimensions>& b) {
+    return static_cast<const Shape<A>&>(a).shape % static_cast<const Shape<B>&>(b).shape;
 }
 
-template<> Collision<2> collision(const AbstractShape<2>& a, const AbstractShape<2>& b) {
-    if(a.type() < b.type()) return collision(b, a);
+template<class A, class B> bool collidesFlipped(const AbstractShape<A::Dimensions>& b, const AbstractShape<A::Dimensions>& a) {
+    return static_cast<const Shape<A>&>(a).shape % static_cast<const Shape<B>&>(b).shape;
+}
 
-    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
-        #define _c(aType, aClass, bType, bClass) \
-            case UnsignedInt(ShapeDimensionTraits<2>::Type::aType)*UnsignedInt(ShapeDimensionTraits<2>::Type::bType): \
-                return static_cast<const Shape<aClass>&>(a).shape / static_cast<const Shape<bClass>&>(b).shape;
-        _c(Sphere, Sphere2D, Point, Point2D)
-        _c(Sphere, Sphere2D, Sphere, Sphere2D)
-        #undef _c
-    }
+template<UnsignedInt dimensions> bool collidesComposition(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b) {
+    return compositionCollides(static_cast<const Shape<Composition<dimensions>>&>(a).shape, b);
+}
 
-    return {};
+template<UnsignedInt dimensions> bool collidesCompositionFlipped(const AbstractShape<dimensions>& b, const AbstractShape<dimensions>& a) {
+    return compositionCollides(static_cast<const Shape<Composition<dimensions>>&>(a).shape, b);
 }
 
-template<> bool collides(const AbstractShape<3>& a, const AbstractShape<3>& b) {
-    if(a.type() < b.type()) return collides(b, a);
+template<class A, class B> Collision<A::Dimensions> collisionImplementation(const AbstractShape<A::Dimensions>& a, const AbstractShape<A::Dimensions>& b) {
+    return static_cast<const Shape<A>&>(a).shape / static_cast<const Shape<B>&>(b).shape;
+}
 
-    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
-        #define _c(aType, aClass, bType, bClass) \
-            case UnsignedInt(ShapeDimensionTraits<3>::Type::aType)*UnsignedInt(ShapeDimensionTraits<3>::Type::bType): \
-                return static_cast<const Shape<aClass>&>(a).shape % static_cast<const Shape<bClass>&>(b).shape;
-        _c(Sphere, Sphere3D, Point, Point3D)
-        _c(Sphere, Sphere3D, Line, Line3D)
-        _c(Sphere, Sphere3D, LineSegment, LineSegment3D)
-        _c(Sphere, Sphere3D, Sphere, Sphere3D)
+/* Collision is always computed from the point of view of the first shape, so
+   the result needs to be flipped for swapped order */
+template<class A, class B> Collision<A::Dimensions> collisionFlipped(const AbstractShape<A::Dimensions>& b, const AbstractShape<A::Dimensions>& a) {
+    return (static_cast<const Shape<A>&>(a).shape / static_cast<const Shape<B>&>(b).shape).flipped();
+}
 
-        _c(InvertedSphere, InvertedSphere3D, Point, Point3D)
-        _c(InvertedSphere, InvertedSphere3D, Sphere, Sphere3D)
+template<UnsignedInt dimensions> struct DispatchTable {
+    typedef bool(*CollidesFunction)(const AbstractShape<dimensions>&, const AbstractShape<dimensions>&);
+    typedef Collision<dimensions>(*CollisionFunction)(const AbstractShape<dimensions>&, const AbstractShape<dimensions>&);
 
-        _c(Cylinder, Cylinder3D, Point, Point3D)
-        _c(Cylinder, Cylinder3D, Sphere, Sphere3D)
+    explicit DispatchTable();
 
-        _c(Capsule, Capsule3D, Point, Point3D)
-        _c(Capsule, Capsule3D, Sphere, Sphere3D)
+    /* Pair with only collision occurence implemented */
+    template<class A, class B> void addCollides() {
+        const std::size_t a = typeIndex(TypeOf<A>::type());
+        const std::size_t b = typeIndex(TypeOf<B>::type());
+        collides[a][b] = collidesImplementation<A, B>;
+        if(a != b) collides[b][a] = collidesFlipped<A, B>;
+        collision[a][b] = collisionNone<dimensions>;
+        collision[b][a] = collisionNone<dimensions>;
+    }
 
-        _c(AxisAlignedBox, AxisAlignedBox3D, Point, Point3D)
+    /* Pair which never collides */
+    template<class A, class B> void addNone() {
+        const std::size_t a = typeIndex(TypeOf<A>::type());
+        const std::size_t b = typeIndex(TypeOf<B>::type());
+        collides[a][b] = collidesNone<dimensions>;
+        collides[b][a] = collidesNone<dimensions>;
+        collision[a][b] = collisionNone<dimensions>;
+        collision[b][a] = collisionNone<dimensions>;
+    }
 
-        _c(Plane, Plane, Line, Line3D)
-        _c(Plane, Plane, LineSegment, LineSegment3D)
-        #undef _c
+    /* Pair which always collides and has no finite penetration depth */
+    template<class A, class B> void addAlways() {
+        const std::size_t a = typeIndex(TypeOf<A>::type());
+        const std::size_t b = typeIndex(TypeOf<B>::type());
+        collides[a][b] = collidesAlways<dimensions>;
+        collides[b][a] = collidesAlways<dimensions>;
+        collision[a][b] = collisionNone<dimensions>;
+        collision[b][a] = collisionNone<dimensions>;
     }
 
-    return false;
-}
+    /* Pair with both collision occurence and collision implemented */
+    template<class A, class B> void add() {
+        addCollides<A, B>();
+
+        const std::size_t a = typeIndex(TypeOf<A>::type());
+        const std::size_t b = typeIndex(TypeOf<B>::type());
+        collision[a][b] = collisionImplementation<A, B>;
+        if(a != b) collision[b][a] = collisionFlipped<A, B>;
+    }
 
-template<> Collision<3> collision(const AbstractShape<3>& a, const AbstractShape<3>& b) {
-    if(a.type() < b.type()) return collision(b, a);
+    /* Pairs implemented for both 2D and 3D, everything else is reported as
+       not colliding */
+    void addCommon();
 
-    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
-        #define _c(aType, aClass, bType, bClass) \
-            case UnsignedInt(ShapeDimensionTraits<3>::Type::aType)*UnsignedInt(ShapeDimensionTraits<3>::Type::bType): \
-                return static_cast<const Shape<aClass>&>(a).shape / static_cast<const Shape<bClass>&>(b).shape;
-        _c(Sphere, Sphere3D, Point, Point3D)
-        _c(Sphere, Sphere3D, Sphere, Sphere3D)
-        #undef _c
+    CollidesFunction collides[TypeCount][TypeCount];
+    CollisionFunction collision[TypeCount][TypeCount];
+};
+
+template<UnsignedInt dimensions> void DispatchTable<dimensions>::addCommon() {
+    for(std::size_t i = 0; i != TypeCount; ++i) for(std::size_t j = 0; j != TypeCount; ++j) {
+        collides[i][j] = collidesNone<dimensions>;
+        collision[i][j] = collisionNone<dimensions>;
     }
 
-    return {};
+    /* Compositions test the other shape against their parts, they have only
+       collision occurence */
+    const std::size_t composition = typeIndex(ShapeDimensionTraits<dimensions>::Type::Composition);
+    for(std::size_t i = 0; i != TypeCount; ++i) {
+        collides[composition][i] = collidesComposition<dimensions>;
+        collides[i][composition] = collidesCompositionFlipped<dimensions>;
+    }
+
+    /* Collisions of one-dimensional shapes with each other are numerically
+       unstable, they are not detected */
+    addNone<Shapes::Point<dimensions>, Shapes::Point<dimensions>>();
+    addNone<Shapes::Line<dimensions>, Shapes::Point<dimensions>>();
+    addNone<Shapes::Line<dimensions>, Shapes::Line<dimensions>>();
+    addNone<Shapes::LineSegment<dimensions>, Shapes::Point<dimensions>>();
+    addNone<Shapes::LineSegment<dimensions>, Shapes::Line<dimensions>>();
+    addNone<Shapes::LineSegment<dimensions>, Shapes::LineSegment<dimensions>>();
+
+    add<Shapes::Sphere<dimensions>, Shapes::Point<dimensions>>();
+    add<Shapes::Sphere<dimensions>, Shapes::Line<dimensions>>();
+    add<Shapes::Sphere<dimensions>, Shapes::LineSegment<dimensions>>();
+    add<Shapes::Sphere<dimensions>, Shapes::Sphere<dimensions>>();
+
+    /* Unbounded shapes always reach outside of the inverted sphere */
+    addAlways<Shapes::InvertedSphere<dimensions>, Shapes::Line<dimensions>>();
+    addAlways<Shapes::InvertedSphere<dimensions>, Shapes::InvertedSphere<dimensions>>();
+    addAlways<Shapes::InvertedSphere<dimensions>, Shapes::Cylinder<dimensions>>();
+    add<Shapes::InvertedSphere<dimensions>, Shapes::Point<dimensions>>();
+    add<Shapes::InvertedSphere<dimensions>, Shapes::LineSegment<dimensions>>();
+    add<Shapes::InvertedSphere<dimensions>, Shapes::Sphere<dimensions>>();
+    add<Shapes::InvertedSphere<dimensions>, Shapes::Capsule<dimensions>>();
+    add<Shapes::InvertedSphere<dimensions>, Shapes::AxisAlignedBox<dimensions>>();
+    add<Shapes::InvertedSphere<dimensions>, Shapes::Box<dimensions>>();
+
+    add<Shapes::Cylinder<dimensions>, Shapes::Point<dimensions>>();
+    add<Shapes::Cylinder<dimensions>, Shapes::Line<dimensions>>();
+    add<Shapes::Cylinder<dimensions>, Shapes::LineSegment<dimensions>>();
+    add<Shapes::Cylinder<dimensions>, Shapes::Sphere<dimensions>>();
+    add<Shapes::Cylinder<dimensions>, Shapes::Cylinder<dimensions>>();
+
+    add<Shapes::Capsule<dimensions>, Shapes::Point<dimensions>>();
+    add<Shapes::Capsule<dimensions>, Shapes::Line<dimensions>>();
+    add<Shapes::Capsule<dimensions>, Shapes::LineSegment<dimensions>>();
+    add<Shapes::Capsule<dimensions>, Shapes::Sphere<dimensions>>();
+    add<Shapes::Capsule<dimensions>, Shapes::Cylinder<dimensions>>();
+    add<Shapes::Capsule<dimensions>, Shapes::Capsule<dimensions>>();
+
+    add<Shapes::AxisAlignedBox<dimensions>, Shapes::Point<dimensions>>();
+    add<Shapes::AxisAlignedBox<dimensions>, Shapes::Line<dimensions>>();
+    add<Shapes::AxisAlignedBox<dimensions>, Shapes::LineSegment<dimensions>>();
+    add<Shapes::AxisAlignedBox<dimensions>, Shapes::Sphere<dimensions>>();
+    add<Shapes::AxisAlignedBox<dimensions>, Shapes::Cylinder<dimensions>>();
+    add<Shapes::AxisAlignedBox<dimensions>, Shapes::Capsule<dimensions>>();
+    add<Shapes::AxisAlignedBox<dimensions>, Shapes::AxisAlignedBox<dimensions>>();
+
+    add<Shapes::Box<dimensions>, Shapes::Point<dimensions>>();
+    add<Shapes::Box<dimensions>, Shapes::Line<dimensions>>();
+    add<Shapes::Box<dimensions>, Shapes::LineSegment<dimensions>>();
+    add<Shapes::Box<dimensions>, Shapes::Sphere<dimensions>>();
+    add<Shapes::Box<dimensions>, Shapes::Cylinder<dimensions>>();
+    add<Shapes::Box<dimensions>, Shapes::Capsule<dimensions>>();
+    add<Shapes::Box<dimensions>, Shapes::AxisAlignedBox<dimensions>>();
+    add<Shapes::Box<dimensions>, Shapes::Box<dimensions>>();
+}
+
+template<> DispatchTable<2>::DispatchTable() {
+    addCommon();
+}
+
+template<> DispatchTable<3>::DispatchTable() {
+    addCommon();
+
+    /* Point lying exactly on the plane is not detected, similarly to points
+       on lines. Line, cylinder and other plane have no finite penetration
+       depth with an infinite plane. */
+    addNone<Shapes::Plane, Shapes::Point3D>();
+    addAlways<Shapes::Plane, Shapes::InvertedSphere3D>();
+    addCollides<Shapes::Plane, Shapes::Line3D>();
+    addCollides<Shapes::Plane, Shapes::Cylinder3D>();
+    addCollides<Shapes::Plane, Shapes::Plane>();
+    add<Shapes::Plane, Shapes::LineSegment3D>();
+    add<Shapes::Plane, Shapes::Sphere3D>();
+    add<Shapes::Plane, Shapes::Capsule3D>();
+    add<Shapes::Plane, Shapes::AxisAlignedBox3D>();
+    add<Shapes::Plane, Shapes::Box3D>();
+}
+
+template<UnsignedInt dimensions> const DispatchTable<dimensions>& dispatchTable() {
+    static const DispatchTable<dimensions> table;
+    return table;
+}
+
 }
 
+template<UnsignedInt dimensions> bool collides(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b) {
+    return dispatchTable<dimensions>().collides[typeIndex(a.type())][typeIndex(b.type())](a, b);
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> collision(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b) {
+    return dispatchTable<dimensions>().collision[typeIndex(a.type())][typeIndex(b.type())](a, b);
+}
+
+template bool collides(const AbstractShape<2>&, const AbstractShape<2>&);
+template bool collides(const AbstractShape<3>&, const AbstractShape<3>&);
+template Collision<2> collision(const AbstractShape<2>&, const AbstractShape<2>&);
+template Collision<3> collision(const AbstractShape<3>&, const AbstractShape<3>&);
+
 }}}
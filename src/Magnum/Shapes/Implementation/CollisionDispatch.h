@@ -35,11 +35,11 @@ template<UnsignedInt> struct AbstractShape;
 /*
 Shape collision double-dispatch:
 
-The collision is symmetric, i.e. it doesn't matter if we test Point vs. Sphere
-or Sphere vs. Point. Each type is specified by unique prime number. Then we
-multiply the two numbers together and switch() on the result. Because of
-multiplying two prime numbers, there is no ambiguity (the result is unique for
-each combination).
+Each type is specified by unique prime number, which is mapped to a dense
+index. The implementations are looked up in a two-dimensional table of
+function pointers indexed by types of both shapes. The table is filled for
+both orders of each implemented pair, collision results for the swapped order
+are flipped so the result is always from the point of view of the first shape.
 */
 
 template<UnsignedInt dimensions> bool collides(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b);
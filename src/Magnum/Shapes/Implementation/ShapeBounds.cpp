@@ -0,0 +1,108 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShapeBounds.h"
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/shapeImplementation.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+namespace {
+
+template<UnsignedInt dimensions> RangeTypeFor<dimensions, Float> unboundedBounds() {
+    return {VectorTypeFor<dimensions, Float>{-Constants::inf()},
+            VectorTypeFor<dimensions, Float>{Constants::inf()}};
+}
+
+template<UnsignedInt dimensions> RangeTypeFor<dimensions, Float> boxBounds(const Box<dimensions>& box) {
+    /* Unit box transformed, extent in each axis is sum of absolute values of
+       scaled and rotated axes */
+    const MatrixTypeFor<dimensions, Float> transformation = box.transformation();
+    VectorTypeFor<dimensions, Float> center, extent;
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        center[i] = transformation[dimensions][i];
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            extent[i] += Math::abs(transformation[j][i]);
+    }
+
+    return {center - extent, center + extent};
+}
+
+template<UnsignedInt dimensions> RangeTypeFor<dimensions, Float> shapeBounds(const AbstractShape<dimensions>& shape) {
+    typedef typename ShapeDimensionTraits<dimensions>::Type Type;
+
+    switch(shape.type()) {
+        case Type::Point: {
+            const Point<dimensions>& point = static_cast<const Shape<Point<dimensions>>&>(shape).shape;
+            return {point.position(), point.position()};
+        }
+        case Type::LineSegment: {
+            const LineSegment<dimensions>& segment = static_cast<const Shape<LineSegment<dimensions>>&>(shape).shape;
+            return {Math::min(segment.a(), segment.b()), Math::max(segment.a(), segment.b())};
+        }
+        case Type::Sphere: {
+            const Sphere<dimensions>& sphere = static_cast<const Shape<Sphere<dimensions>>&>(shape).shape;
+            return {sphere.position() - VectorTypeFor<dimensions, Float>{sphere.radius()},
+                    sphere.position() + VectorTypeFor<dimensions, Float>{sphere.radius()}};
+        }
+        case Type::Capsule: {
+            const Capsule<dimensions>& capsule = static_cast<const Shape<Capsule<dimensions>>&>(shape).shape;
+            return {Math::min(capsule.a(), capsule.b()) - VectorTypeFor<dimensions, Float>{capsule.radius()},
+                    Math::max(capsule.a(), capsule.b()) + VectorTypeFor<dimensions, Float>{capsule.radius()}};
+        }
+        case Type::AxisAlignedBox: {
+            const AxisAlignedBox<dimensions>& box = static_cast<const Shape<AxisAlignedBox<dimensions>>&>(shape).shape;
+            return {Math::min(box.min(), box.max()), Math::max(box.min(), box.max())};
+        }
+        case Type::Box:
+            return boxBounds(static_cast<const Shape<Box<dimensions>>&>(shape).shape);
+
+        /* Infinite shapes, compositions are treated as infinite too as they
+           can contain negation */
+        default:
+            return unboundedBounds<dimensions>();
+    }
+}
+
+}
+
+template<> RangeTypeFor<2, Float> bounds(const AbstractShape<2>& shape) {
+    return shapeBounds(shape);
+}
+
+template<> RangeTypeFor<3, Float> bounds(const AbstractShape<3>& shape) {
+    return shapeBounds(shape);
+}
+
+}}}
@@ -25,9 +25,15 @@
 
 #include "Plane.h"
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
 #include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Sphere.h"
 
 using namespace Magnum::Math::Geometry;
 
@@ -51,4 +57,121 @@ bool Plane::operator%(const LineSegment3D& other) const {
     return t > 0.0f && t < 1.0f;
 }
 
+Collision3D Plane::operator/(const LineSegment3D& other) const {
+    /* No collision occured */
+    if(!(*this % other)) return {};
+
+    /* Signed distances of the endpoints, the endpoint nearer to the plane is
+       the one which needs to be pushed back */
+    const Float a = Math::dot(other.a() - _position, _normal);
+    const Float b = Math::dot(other.b() - _position, _normal);
+    const bool nearerA = Math::abs(a) < Math::abs(b);
+    const Float distance = nearerA ? a : b;
+
+    /* Moving the plane past the nearer endpoint puts the whole segment on one
+       side, collision position is on that endpoint */
+    return Collision3D(nearerA ? other.a() : other.b(), _normal*Math::sign(distance), Math::abs(distance));
+}
+
+bool Plane::operator%(const Sphere3D& other) const {
+    return Math::abs(Math::dot(other.position() - _position, _normal)) < other.radius();
+}
+
+Collision3D Plane::operator/(const Sphere3D& other) const {
+    const Float distance = Math::dot(other.position() - _position, _normal);
+
+    /* No collision occured */
+    if(Math::abs(distance) >= other.radius()) return {};
+
+    /* Move the plane away from the center. If the center lies on the plane,
+       move against the normal. */
+    const Vector3 separatingNormal = distance < 0.0f ? _normal : -_normal;
+
+    /* Contact position is on the surface of the sphere */
+    return Collision3D(other.position() + separatingNormal*other.radius(), separatingNormal, other.radius() - Math::abs(distance));
+}
+
+bool Plane::operator%(const Cylinder3D& other) const {
+    /* Cylinder not parallel with the plane always crosses it, otherwise
+       equivalent to sphere placed on the axis */
+    return Math::dot(other.b() - other.a(), _normal) != 0.0f ||
+        *this % Sphere3D{other.a(), other.radius()};
+}
+
+bool Plane::operator%(const Capsule3D& other) const {
+    const Float a = Math::dot(other.a() - _position, _normal);
+    const Float b = Math::dot(other.b() - _position, _normal);
+
+    /* Either the axis crosses the plane or one of the end caps touches it */
+    return a*b < 0.0f || Math::min(Math::abs(a), Math::abs(b)) < other.radius();
+}
+
+Collision3D Plane::operator/(const Capsule3D& other) const {
+    const Float a = Math::dot(other.a() - _position, _normal);
+    const Float b = Math::dot(other.b() - _position, _normal);
+    const bool nearerA = Math::abs(a) < Math::abs(b);
+
+    /* The axis doesn't cross the plane, equivalent to collision with the end
+       cap nearer to the plane */
+    if(a*b >= 0.0f)
+        return *this/Sphere3D{nearerA ? other.a() : other.b(), other.radius()};
+
+    /* Otherwise move the plane past the nearer end cap, similarly to
+       collision with line segment. Contact position is on the surface of the
+       cap. */
+    const Float distance = nearerA ? a : b;
+    const Vector3 separatingNormal = _normal*Math::sign(distance);
+    return Collision3D((nearerA ? other.a() : other.b()) + separatingNormal*other.radius(), separatingNormal, Math::abs(distance) + other.radius());
+}
+
+bool Plane::operator%(const AxisAlignedBox3D& other) const {
+    return *this % Box3D{Matrix4::translation((other.min() + other.max())*0.5f)*Matrix4::scaling((other.max() - other.min())*0.5f)};
+}
+
+Collision3D Plane::operator/(const AxisAlignedBox3D& other) const {
+    return *this/Box3D{Matrix4::translation((other.min() + other.max())*0.5f)*Matrix4::scaling((other.max() - other.min())*0.5f)};
+}
+
+namespace {
+
+/* Half size of the box projected on the plane normal */
+Float projectedRadius(const Matrix4& transformation, const Vector3& normal) {
+    return Math::abs(Math::dot(transformation.right(), normal)) +
+           Math::abs(Math::dot(transformation.up(), normal)) +
+           Math::abs(Math::dot(transformation.backward(), normal));
+}
+
+}
+
+bool Plane::operator%(const Box3D& other) const {
+    const Matrix4 transformation = other.transformation();
+    return Math::abs(Math::dot(transformation.translation() - _position, _normal)) < projectedRadius(transformation, _normal);
+}
+
+Collision3D Plane::operator/(const Box3D& other) const {
+    const Matrix4 transformation = other.transformation();
+    const Float radius = projectedRadius(transformation, _normal);
+    const Float distance = Math::dot(transformation.translation() - _position, _normal);
+
+    /* No collision occured */
+    if(Math::abs(distance) >= radius) return {};
+
+    /* Move the plane away from the center, same as with sphere */
+    const Vector3 separatingNormal = distance < 0.0f ? _normal : -_normal;
+
+    /* Contact position is on the box vertex furthest in that direction */
+    Vector3 position = transformation.translation();
+    for(const Vector3& axis: {transformation.right(), transformation.up(), transformation.backward()})
+        position += Math::dot(axis, separatingNormal) < 0.0f ? -axis : axis;
+
+    return Collision3D(position, separatingNormal, radius - Math::abs(distance));
+}
+
+bool Plane::operator%(const Plane& other) const {
+    /* Planes which are not parallel always intersect, parallel ones only if
+       they are the same */
+    return !Math::cross(_normal, other._normal).isZero() ||
+        Math::TypeTraits<Float>::equals(Math::dot(other._position - _position, _normal), 0.0f);
+}
+
 }}
@@ -31,6 +31,7 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Shapes/Collision.h"
 #include "Magnum/Shapes/Shapes.h"
 #include "Magnum/Shapes/visibility.h"
 
@@ -83,6 +84,86 @@ class MAGNUM_SHAPES_EXPORT Plane {
         /** @brief Collision occurence with line segment */
         bool operator%(const LineSegment3D& other) const;
 
+        /**
+         * @brief Collision with line segment
+         *
+         * Expects that the plane normal is normalized.
+         */
+        Collision3D operator/(const LineSegment3D& other) const;
+
+        /**
+         * @brief Collision occurence with sphere
+         *
+         * Expects that the plane normal is normalized.
+         */
+        bool operator%(const Sphere3D& other) const;
+
+        /**
+         * @brief Collision with sphere
+         *
+         * Expects that the plane normal is normalized.
+         */
+        Collision3D operator/(const Sphere3D& other) const;
+
+        /**
+         * @brief Collision occurence with cylinder
+         *
+         * Cylinder which is not parallel with the plane always intersects it
+         * and has no finite penetration depth, so only collision occurence is
+         * implemented. Expects that the plane normal is normalized.
+         */
+        bool operator%(const Cylinder3D& other) const;
+
+        /**
+         * @brief Collision occurence with capsule
+         *
+         * Expects that the plane normal is normalized.
+         */
+        bool operator%(const Capsule3D& other) const;
+
+        /**
+         * @brief Collision with capsule
+         *
+         * Expects that the plane normal is normalized.
+         */
+        Collision3D operator/(const Capsule3D& other) const;
+
+        /**
+         * @brief Collision occurence with axis-aligned box
+         *
+         * Expects that the plane normal is normalized.
+         */
+        bool operator%(const AxisAlignedBox3D& other) const;
+
+        /**
+         * @brief Collision with axis-aligned box
+         *
+         * Expects that the plane normal is normalized.
+         */
+        Collision3D operator/(const AxisAlignedBox3D& other) const;
+
+        /**
+         * @brief Collision occurence with box
+         *
+         * Expects that the plane normal is normalized.
+         */
+        bool operator%(const Box3D& other) const;
+
+        /**
+         * @brief Collision with box
+         *
+         * Expects that the plane normal is normalized.
+         */
+        Collision3D operator/(const Box3D& other) const;
+
+        /**
+         * @brief Collision occurence with other plane
+         *
+         * Planes which are not parallel always intersect and have no finite
+         * penetration depth, so only collision occurence is implemented.
+         */
+        bool operator%(const Plane& other) const;
+
     private:
         Vector3 _position, _normal;
 };
@@ -93,6 +174,36 @@ inline bool operator%(const Line3D& a, const Plane& b) { return b % a; }
 /** @collisionoccurenceoperator{LineSegment,Plane} */
 inline bool operator%(const LineSegment3D& a, const Plane& b) { return b % a; }
 
+/** @collisionoccurenceoperator{Sphere,Plane} */
+inline bool operator%(const Sphere3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Cylinder,Plane} */
+inline bool operator%(const Cylinder3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Capsule,Plane} */
+inline bool operator%(const Capsule3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoccurenceoperator{AxisAlignedBox,Plane} */
+inline bool operator%(const AxisAlignedBox3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoccurenceoperator{Box,Plane} */
+inline bool operator%(const Box3D& a, const Plane& b) { return b % a; }
+
+/** @collisionoperator{LineSegment,Plane} */
+inline Collision3D operator/(const LineSegment3D& a, const Plane& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Sphere,Plane} */
+inline Collision3D operator/(const Sphere3D& a, const Plane& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Capsule,Plane} */
+inline Collision3D operator/(const Capsule3D& a, const Plane& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{AxisAlignedBox,Plane} */
+inline Collision3D operator/(const AxisAlignedBox3D& a, const Plane& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{Box,Plane} */
+inline Collision3D operator/(const Box3D& a, const Plane& b) { return (b/a).flipped(); }
+
 
 }}
 
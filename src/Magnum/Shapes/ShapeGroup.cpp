@@ -25,11 +25,50 @@
 
 #include "ShapeGroup.h"
 
+#include <algorithm>
+
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Shapes/AbstractShape.h"
+#include "Magnum/Shapes/Implementation/ShapeBounds.h"
 
 namespace Magnum { namespace Shapes {
 
+namespace {
+
+template<UnsignedInt dimensions> inline bool overlaps(const RangeTypeFor<dimensions, Float>& a, const RangeTypeFor<dimensions, Float>& b) {
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        if(a.max()[i] < b.min()[i] || b.max()[i] < a.min()[i]) return false;
+    return true;
+}
+
+}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>::ShapeGroup(): dirty(true), _membershipChanged(true), _axis(0), _maxExtent(0.0f) {}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>& ShapeGroup<dimensions>::add(AbstractShape<dimensions>& shape) {
+    /* The shape is removed from the previous group, if any */
+    if(shape.group()) shape.group()->_membershipChanged = true;
+    SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float>::add(shape);
+    _membershipChanged = true;
+    return *this;
+}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>& ShapeGroup<dimensions>::remove(AbstractShape<dimensions>& shape) {
+    SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float>::remove(shape);
+    _membershipChanged = true;
+    return *this;
+}
+
 template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
+    /* Nothing moved and no shape was added or removed, the bounds are up to
+       date. With SceneGraph::DirtyTracking::Generation the shapes are not
+       notified when a parent of their object moves, so ask the objects. */
+    if(!dirty && !_membershipChanged && _bounds.size() == this->size()) {
+        std::size_t i = 0;
+        while(i != this->size() && !(*this)[i].object().isDirty()) ++i;
+        if(i == this->size()) return;
+    }
+
     /* Clean all objects */
     if(!this->isEmpty()) {
         std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
@@ -40,18 +79,143 @@ template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
         SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
     }
 
+    updateBroadPhase();
     dirty = false;
 }
 
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateBroadPhase() {
+    const bool rebuild = _membershipChanged || _bounds.size() != this->size();
+    _membershipChanged = false;
+
+    /* Update bounds of all shapes */
+    _bounds.resize(this->size());
+    for(std::size_t i = 0; i != this->size(); ++i)
+        _bounds[i] = Implementation::bounds(Implementation::getAbstractShape((*this)[i]));
+
+    /* The shapes changed, put the bounded ones into the sweep list and sort
+       them from scratch along the axis with the largest spread of centers */
+    if(rebuild) {
+        _sorted.clear();
+        _unbounded.clear();
+        VectorTypeFor<dimensions, Float> sum, sumSquared;
+        for(std::size_t i = 0; i != _bounds.size(); ++i) {
+            if(!Implementation::isBounded<dimensions>(_bounds[i])) {
+                _unbounded.push_back(UnsignedInt(i));
+                continue;
+            }
+
+            _sorted.push_back(UnsignedInt(i));
+            const VectorTypeFor<dimensions, Float> center = (_bounds[i].min() + _bounds[i].max())*0.5f;
+            sum += center;
+            sumSquared += center*center;
+        }
+
+        _axis = 0;
+        if(!_sorted.empty()) {
+            const VectorTypeFor<dimensions, Float> mean = sum/Float(_sorted.size());
+            const VectorTypeFor<dimensions, Float> variance = sumSquared/Float(_sorted.size()) - mean*mean;
+            for(UnsignedInt i = 1; i != dimensions; ++i)
+                if(variance[i] > variance[_axis]) _axis = i;
+        }
+
+        std::sort(_sorted.begin(), _sorted.end(), [this](UnsignedInt a, UnsignedInt b) {
+            return _bounds[a].min()[_axis] < _bounds[b].min()[_axis];
+        });
+
+    /* Otherwise the previous order is nearly sorted, fix it with insertion
+       sort. If the shapes moved too much, fall back to full sort. */
+    } else {
+        std::size_t moves = 0;
+        for(std::size_t i = 1; i < _sorted.size() && moves <= 8*_sorted.size(); ++i) {
+            const UnsignedInt index = _sorted[i];
+            const Float min = _bounds[index].min()[_axis];
+            std::size_t j = i;
+            for(; j && _bounds[_sorted[j - 1]].min()[_axis] > min; --j)
+                _sorted[j] = _sorted[j - 1];
+            _sorted[j] = index;
+            moves += i - j;
+        }
+
+        if(moves > 8*_sorted.size())
+            std::sort(_sorted.begin(), _sorted.end(), [this](UnsignedInt a, UnsignedInt b) {
+                return _bounds[a].min()[_axis] < _bounds[b].min()[_axis];
+            });
+    }
+
+    /* Sorted minimums for binary search and the largest extent, which limits
+       how far back the overlapping shapes can be */
+    _sortedMin.resize(_sorted.size());
+    _maxExtent = 0.0f;
+    for(std::size_t i = 0; i != _sorted.size(); ++i) {
+        const RangeTypeFor<dimensions, Float>& bounds = _bounds[_sorted[i]];
+        _sortedMin[i] = bounds.min()[_axis];
+        _maxExtent = Math::max(_maxExtent, bounds.max()[_axis] - bounds.min()[_axis]);
+    }
+}
+
 template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>& shape) {
     setClean();
-    for(std::size_t i = 0; i != this->size(); ++i)
+
+    /* Shape without finite bounds, test against everything. Pairs without
+       an implementation are dispatched to a no-op reporting no collision. */
+    const RangeTypeFor<dimensions, Float> bounds = Implementation::bounds(Implementation::getAbstractShape(shape));
+    if(!Implementation::isBounded<dimensions>(bounds)) {
+        for(std::size_t i = 0; i != this->size(); ++i)
+            if(&(*this)[i] != &shape && (*this)[i].collides(shape))
+                return &(*this)[i];
+
+        return nullptr;
+    }
+
+    /* Gather shapes with overlapping bounds */
+    std::vector<UnsignedInt> candidates{_unbounded};
+    const std::size_t first = std::lower_bound(_sortedMin.begin(), _sortedMin.end(), bounds.min()[_axis] - _maxExtent) - _sortedMin.begin();
+    for(std::size_t i = first; i != _sorted.size() && _sortedMin[i] <= bounds.max()[_axis]; ++i)
+        if(overlaps<dimensions>(_bounds[_sorted[i]], bounds))
+            candidates.push_back(_sorted[i]);
+
+    /* Test them in the order they are in the group */
+    std::sort(candidates.begin(), candidates.end());
+    for(const UnsignedInt i: candidates)
         if(&(*this)[i] != &shape && (*this)[i].collides(shape))
             return &(*this)[i];
 
     return nullptr;
 }
 
+template<UnsignedInt dimensions> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> ShapeGroup<dimensions>::collidingPairs() {
+    setClean();
+
+    /* Sweep along the axis, for each shape go through the following ones
+       until they start after its end */
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> candidates;
+    for(std::size_t i = 0; i != _sorted.size(); ++i) {
+        const RangeTypeFor<dimensions, Float>& bounds = _bounds[_sorted[i]];
+        for(std::size_t j = i + 1; j != _sorted.size() && _sortedMin[j] <= bounds.max()[_axis]; ++j) {
+            if(!overlaps<dimensions>(bounds, _bounds[_sorted[j]])) continue;
+            candidates.emplace_back(Math::min(_sorted[i], _sorted[j]), Math::max(_sorted[i], _sorted[j]));
+        }
+    }
+
+    /* Shapes without finite bounds with everything else, each pair of them
+       only once */
+    for(std::size_t i = 0; i != _unbounded.size(); ++i) {
+        for(const UnsignedInt j: _sorted)
+            candidates.emplace_back(Math::min(_unbounded[i], j), Math::max(_unbounded[i], j));
+        for(std::size_t j = i + 1; j != _unbounded.size(); ++j)
+            candidates.emplace_back(Math::min(_unbounded[i], _unbounded[j]), Math::max(_unbounded[i], _unbounded[j]));
+    }
+
+    /* Narrow phase in the order the shapes are in the group */
+    std::sort(candidates.begin(), candidates.end());
+    std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> pairs;
+    for(const std::pair<UnsignedInt, UnsignedInt>& candidate: candidates)
+        if((*this)[candidate.first].collides((*this)[candidate.second]))
+            pairs.emplace_back(&(*this)[candidate.first], &(*this)[candidate.second]);
+
+    return pairs;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<2>;
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<3>;
@@ -29,8 +29,11 @@
  * @brief Class @ref Magnum::Shapes::ShapeGroup, typedef @ref Magnum::Shapes::ShapeGroup2D, @ref Magnum::Shapes::ShapeGroup3D
  */
 
+#include <utility>
 #include <vector>
 
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/Shapes/AbstractShape.h"
 #include "Magnum/Shapes/visibility.h"
@@ -41,6 +44,20 @@ namespace Magnum { namespace Shapes {
 @brief Group of shapes
 
 See @ref Shape for more information. See @ref shapes for brief introduction.
+
+## Broad phase
+
+To avoid testing each shape against every other, the group keeps axis-aligned
+bounds of all shapes sorted along one axis (sweep and prune). The bounds are
+updated in @ref setClean(), the sorted order is updated incrementally, so for
+coherent motion between frames it is close to linear. @ref firstCollision()
+then needs to test only shapes with overlapping bounds and
+@ref collidingPairs() finds all colliding pairs in a single sweep.
+
+Shapes without finite bounds (@ref Line, @ref Cylinder, @ref InvertedSphere,
+@ref Plane) and @ref Composition are kept aside and tested against everything,
+so they should be used sparingly in large groups.
+
 @see @ref scenegraph, @ref ShapeGroup2D, @ref ShapeGroup3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float> {
@@ -52,11 +69,16 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          *
          * Marks the group as dirty.
          */
-        explicit ShapeGroup(): dirty(true) {}
+        explicit ShapeGroup();
 
         /**
          * @brief Whether the group is dirty
          * @return True if any object in the group is dirty, false otherwise.
+         *
+         * With @ref SceneGraph::DirtyTracking::Generation the group is not
+         * notified when a parent of an object in the group changes its
+         * transformation. @ref setClean() checks dirty state of the objects
+         * directly in that case.
          */
         bool isDirty() const { return dirty; }
 
@@ -82,13 +104,51 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          * @brief First collision of given shape with other shapes in the group
          *
          * Returns first shape colliding with given one. If there aren't any
-         * collisions, returns `nullptr`. Calls @ref setClean() before the
+         * collisions, returns `nullptr`. Pairs for which collision is not
+         * implemented are treated as not colliding, see
+         * @ref shapes-collisions-pairs. Calls @ref setClean() before the
          * operation.
          */
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape);
 
+        /**
+         * @brief All colliding pairs of shapes in the group
+         *
+         * Returns pairs of colliding shapes, each pair only once, ordered by
+         * position of the shapes in the group. Shapes without finite bounds
+         * are tested against all other shapes, pairs for which collision is
+         * not implemented are treated as not colliding. Calls
+         * @ref setClean() before the operation.
+         * @see @ref AbstractShape::collides()
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> collidingPairs();
+
+        /**
+         * @brief Add shape to the group
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref FeatureGroup::add()
+         */
+        ShapeGroup<dimensions>& add(AbstractShape<dimensions>& shape);
+
+        /**
+         * @brief Remove shape from the group
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref FeatureGroup::remove()
+         */
+        ShapeGroup<dimensions>& remove(AbstractShape<dimensions>& shape);
+
     private:
+        void MAGNUM_SHAPES_LOCAL updateBroadPhase();
+
         bool dirty;
+        bool _membershipChanged;
+        UnsignedInt _axis;
+        Float _maxExtent;
+        std::vector<RangeTypeFor<dimensions, Float>> _bounds;
+        std::vector<UnsignedInt> _sorted, _unbounded;
+        std::vector<Float> _sortedMin;
 };
 
 /**
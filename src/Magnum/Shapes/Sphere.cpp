@@ -30,8 +30,12 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Geometry/Distance.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
 #include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Implementation/ClosestPoint.h"
 
 using namespace Magnum::Math::Geometry;
 
@@ -91,10 +95,19 @@ template<UnsignedInt dimensions> bool Sphere<dimensions>::operator%(const Line<d
     return Distance::linePointSquared(other.a(), other.b(), _position) < Math::pow<2>(_radius);
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> Sphere<dimensions>::operator/(const Line<dimensions>& other) const {
+    /* Collision position is the point on the line closest to the center */
+    return *this/Point<dimensions>{Implementation::lineClosestPoint(other.a(), other.b(), _position)};
+}
+
 template<UnsignedInt dimensions> bool Sphere<dimensions>::operator%(const LineSegment<dimensions>& other) const {
     return Distance::lineSegmentPointSquared(other.a(), other.b(), _position) < Math::pow<2>(_radius);
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> Sphere<dimensions>::operator/(const LineSegment<dimensions>& other) const {
+    return *this/Point<dimensions>{Implementation::lineSegmentClosestPoint(other.a(), other.b(), _position)};
+}
+
 template<UnsignedInt dimensions> bool Sphere<dimensions>::operator%(const Sphere<dimensions>& other) const {
     return (_position - other._position).dot() < Math::pow<2>(_radius + other._radius);
 }
@@ -145,6 +158,70 @@ template<UnsignedInt dimensions> Collision<dimensions> InvertedSphere<dimensions
     return Collision<dimensions>(other.position() + separatingNormal*other.radius(), separatingNormal, distance - maxDistance);
 }
 
+namespace {
+
+/* The part of a shape furthest from the center of the inverted sphere is the
+   one colliding with it deepest */
+template<UnsignedInt dimensions> VectorTypeFor<dimensions, Float> furthestEnd(const VectorTypeFor<dimensions, Float>& center, const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b) {
+    return (a - center).dot() > (b - center).dot() ? a : b;
+}
+
+template<UnsignedInt dimensions> VectorTypeFor<dimensions, Float> furthestVertex(const VectorTypeFor<dimensions, Float>& center, const AxisAlignedBox<dimensions>& box) {
+    VectorTypeFor<dimensions, Float> out;
+    for(std::size_t i = 0; i != dimensions; ++i)
+        out[i] = Math::abs(box.min()[i] - center[i]) > Math::abs(box.max()[i] - center[i]) ? box.min()[i] : box.max()[i];
+    return out;
+}
+
+/* Expects that the box axes are orthogonal, then the furthest vertex can be
+   found separately for each axis */
+template<UnsignedInt dimensions> VectorTypeFor<dimensions, Float> furthestVertex(const VectorTypeFor<dimensions, Float>& center, const Box<dimensions>& box) {
+    const MatrixTypeFor<dimensions, Float> transformation = box.transformation();
+    const VectorTypeFor<dimensions, Float> boxCenter = transformation.translation();
+    VectorTypeFor<dimensions, Float> out = boxCenter;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        VectorTypeFor<dimensions, Float> axis;
+        axis[i] = 1.0f;
+        axis = transformation.transformVector(axis);
+        out += Math::dot(axis, boxCenter - center) < 0.0f ? -axis : axis;
+    }
+    return out;
+}
+
+}
+
+template<UnsignedInt dimensions> bool InvertedSphere<dimensions>::operator%(const LineSegment<dimensions>& other) const {
+    return *this % Point<dimensions>{furthestEnd<dimensions>(position(), other.a(), other.b())};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> InvertedSphere<dimensions>::operator/(const LineSegment<dimensions>& other) const {
+    return *this/Point<dimensions>{furthestEnd<dimensions>(position(), other.a(), other.b())};
+}
+
+template<UnsignedInt dimensions> bool InvertedSphere<dimensions>::operator%(const Capsule<dimensions>& other) const {
+    return *this % Sphere<dimensions>{furthestEnd<dimensions>(position(), other.a(), other.b()), other.radius()};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> InvertedSphere<dimensions>::operator/(const Capsule<dimensions>& other) const {
+    return *this/Sphere<dimensions>{furthestEnd<dimensions>(position(), other.a(), other.b()), other.radius()};
+}
+
+template<UnsignedInt dimensions> bool InvertedSphere<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    return *this % Point<dimensions>{furthestVertex(position(), other)};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> InvertedSphere<dimensions>::operator/(const AxisAlignedBox<dimensions>& other) const {
+    return *this/Point<dimensions>{furthestVertex(position(), other)};
+}
+
+template<UnsignedInt dimensions> bool InvertedSphere<dimensions>::operator%(const Box<dimensions>& other) const {
+    return *this % Point<dimensions>{furthestVertex(position(), other)};
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> InvertedSphere<dimensions>::operator/(const Box<dimensions>& other) const {
+    return *this/Point<dimensions>{furthestVertex(position(), other)};
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT Sphere<2>;
 template class MAGNUM_SHAPES_EXPORT Sphere<3>;
@@ -90,9 +90,15 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Sphere {
         /** @brief Collision occurence with line */
         bool operator%(const Line<dimensions>& other) const;
 
+        /** @brief Collision with line */
+        Collision<dimensions> operator/(const Line<dimensions>& other) const;
+
         /** @brief Collision occurence with line segment */
         bool operator%(const LineSegment<dimensions>& other) const;
 
+        /** @brief Collision with line segment */
+        Collision<dimensions> operator/(const LineSegment<dimensions>& other) const;
+
         /** @brief Collision occurence with sphere */
         bool operator%(const Sphere<dimensions>& other) const;
 
@@ -159,6 +165,50 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT InvertedSphere:
         /** @brief Collision with sphere */
         Collision<dimensions> operator/(const Sphere<dimensions>& other) const;
 
+        /** @brief Collision occurence with line segment */
+        bool operator%(const LineSegment<dimensions>& other) const;
+
+        /**
+         * @brief Collision with line segment
+         *
+         * Equivalent to collision with the segment end furthest from the
+         * center.
+         */
+        Collision<dimensions> operator/(const LineSegment<dimensions>& other) const;
+
+        /** @brief Collision occurence with capsule */
+        bool operator%(const Capsule<dimensions>& other) const;
+
+        /**
+         * @brief Collision with capsule
+         *
+         * Equivalent to collision with sphere placed on the capsule end
+         * furthest from the center.
+         */
+        Collision<dimensions> operator/(const Capsule<dimensions>& other) const;
+
+        /** @brief Collision occurence with axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
+        /**
+         * @brief Collision with axis-aligned box
+         *
+         * Equivalent to collision with the box vertex furthest from the
+         * center.
+         */
+        Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& other) const;
+
+        /** @brief Collision occurence with box */
+        bool operator%(const Box<dimensions>& other) const;
+
+        /**
+         * @brief Collision with box
+         *
+         * Equivalent to collision with the box vertex furthest from the
+         * center.
+         */
+        Collision<dimensions> operator/(const Box<dimensions>& other) const;
+
     private:
         constexpr /*implicit*/ InvertedSphere(const Sphere<dimensions>& other): Sphere<dimensions>(other) {}
 };
@@ -187,12 +237,42 @@ template<UnsignedInt dimensions> inline bool operator%(const Line<dimensions>& a
 /** @collisionoccurenceoperator{LineSegment,Sphere} */
 template<UnsignedInt dimensions> inline bool operator%(const LineSegment<dimensions>& a, const Sphere<dimensions>& b) { return b % a; }
 
+/** @collisionoperator{Line,Sphere} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Line<dimensions>& a, const Sphere<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoperator{LineSegment,Sphere} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const LineSegment<dimensions>& a, const Sphere<dimensions>& b) { return (b/a).flipped(); }
+
 /** @collisionoccurenceoperator{Sphere,InvertedSphere} */
 template<UnsignedInt dimensions> inline bool operator%(const Sphere<dimensions>& a, const InvertedSphere<dimensions>& b) { return b % a; }
 
 /** @collisionoperator{Sphere,InvertedSphere} */
 template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Sphere<dimensions>& a, const InvertedSphere<dimensions>& b) { return (b/a).flipped(); }
 
+/** @collisionoccurenceoperator{LineSegment,InvertedSphere} */
+template<UnsignedInt dimensions> inline bool operator%(const LineSegment<dimensions>& a, const InvertedSphere<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{LineSegment,InvertedSphere} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const LineSegment<dimensions>& a, const InvertedSphere<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Capsule,InvertedSphere} */
+template<UnsignedInt dimensions> inline bool operator%(const Capsule<dimensions>& a, const InvertedSphere<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Capsule,InvertedSphere} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Capsule<dimensions>& a, const InvertedSphere<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{AxisAlignedBox,InvertedSphere} */
+template<UnsignedInt dimensions> inline bool operator%(const AxisAlignedBox<dimensions>& a, const InvertedSphere<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{AxisAlignedBox,InvertedSphere} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& a, const InvertedSphere<dimensions>& b) { return (b/a).flipped(); }
+
+/** @collisionoccurenceoperator{Box,InvertedSphere} */
+template<UnsignedInt dimensions> inline bool operator%(const Box<dimensions>& a, const InvertedSphere<dimensions>& b) { return b % a; }
+
+/** @collisionoperator{Box,InvertedSphere} */
+template<UnsignedInt dimensions> inline Collision<dimensions> operator/(const Box<dimensions>& a, const InvertedSphere<dimensions>& b) { return (b/a).flipped(); }
+
 }}
 
 #endif
@@ -0,0 +1,232 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Sweep.h"
+
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Geometry/Distance.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Plane.h"
+#include "Magnum/Shapes/Sphere.h"
+
+using namespace Magnum::Math::Geometry;
+
+namespace Magnum { namespace Shapes {
+
+namespace {
+
+/* Smallest non-negative parameter at which point moving from origin along
+   direction gets to given distance from center, zero if it already is
+   closer and infinity if it never gets there */
+template<UnsignedInt dimensions> Float raySphere(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const VectorTypeFor<dimensions, Float>& center, const Float radius) {
+    const VectorTypeFor<dimensions, Float> m = origin - center;
+    const Float c = m.dot() - radius*radius;
+    if(c <= 0.0f) return 0.0f;
+
+    /* Not moving at all or moving away */
+    const Float b = Math::dot(m, direction);
+    if(b >= 0.0f) return Constants::inf();
+
+    const Float a = direction.dot();
+    const Float discriminant = b*b - a*c;
+    if(discriminant < 0.0f) return Constants::inf();
+
+    return (-b - Math::sqrt(discriminant))/a;
+}
+
+/* The same for line segment ab, i.e. union of the cylinder between the
+   endpoints and spheres around them */
+template<UnsignedInt dimensions> Float rayCapsule(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Float radius) {
+    if(Distance::lineSegmentPointSquared(a, b, origin) <= radius*radius)
+        return 0.0f;
+
+    Float t = Math::min(raySphere<dimensions>(origin, direction, a, radius),
+                        raySphere<dimensions>(origin, direction, b, radius));
+
+    /* Degenerate capsule is just a sphere */
+    const VectorTypeFor<dimensions, Float> axis = b - a;
+    const Float axisDot = axis.dot();
+    if(axisDot == 0.0f) return t;
+
+    /* Components perpendicular to the axis */
+    const VectorTypeFor<dimensions, Float> m = origin - a;
+    const Float mAxis = Math::dot(m, axis);
+    const Float directionAxis = Math::dot(direction, axis);
+    const VectorTypeFor<dimensions, Float> mPerpendicular = m - axis*(mAxis/axisDot);
+    const VectorTypeFor<dimensions, Float> directionPerpendicular = direction - axis*(directionAxis/axisDot);
+
+    /* Hitting the cylinder side only if starting outside of the infinite
+       cylinder and moving towards it, otherwise the caps are hit first */
+    const Float qa = directionPerpendicular.dot();
+    const Float qb = Math::dot(mPerpendicular, directionPerpendicular);
+    const Float qc = mPerpendicular.dot() - radius*radius;
+    if(qc <= 0.0f || qb >= 0.0f) return t;
+
+    const Float discriminant = qb*qb - qa*qc;
+    if(discriminant < 0.0f) return t;
+
+    /* Take the side hit only if it is between the endpoints */
+    const Float side = (-qb - Math::sqrt(discriminant))/qa;
+    const Float s = (mAxis + side*directionAxis)/axisDot;
+    if(s >= 0.0f && s <= 1.0f) t = Math::min(t, side);
+
+    return t;
+}
+
+/* Restrict the result to the movement */
+inline Float clampToMovement(const Float t) {
+    return t <= 1.0f ? t : Constants::inf();
+}
+
+}
+
+template<UnsignedInt dimensions> Float timeOfImpact(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Sphere<dimensions>& other) {
+    return clampToMovement(raySphere<dimensions>(sphere.position(), displacement, other.position(), sphere.radius() + other.radius()));
+}
+
+template<UnsignedInt dimensions> Float timeOfImpact(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Capsule<dimensions>& capsule) {
+    return clampToMovement(rayCapsule<dimensions>(sphere.position(), displacement, capsule.a(), capsule.b(), sphere.radius() + capsule.radius()));
+}
+
+template<UnsignedInt dimensions> Float timeOfImpact(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const AxisAlignedBox<dimensions>& box) {
+    if(box % sphere) return 0.0f;
+
+    /* Slab test of the center movement with the box expanded by the radius */
+    const Float radius = sphere.radius();
+    Float tMin = 0.0f;
+    Float tMax = 1.0f;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        const Float min = box.min()[i] - radius;
+        const Float max = box.max()[i] + radius;
+        const Float origin = sphere.position()[i];
+
+        if(displacement[i] == 0.0f) {
+            if(origin < min || origin > max) return Constants::inf();
+            continue;
+        }
+
+        Float tNear = (min - origin)/displacement[i];
+        Float tFar = (max - origin)/displacement[i];
+        if(tNear > tFar) std::swap(tNear, tFar);
+        tMin = Math::max(tMin, tNear);
+        tMax = Math::min(tMax, tFar);
+        if(tMin > tMax) return Constants::inf();
+    }
+
+    /* If the center hits the expanded box where it is outside of the
+       original box in at most one axis, it's a face hit */
+    const VectorTypeFor<dimensions, Float> hit = sphere.position() + displacement*tMin;
+    VectorTypeFor<dimensions, Float> corner;
+    std::size_t outside = 0;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        if(hit[i] < box.min()[i]) {
+            corner[i] = box.min()[i];
+            ++outside;
+        } else if(hit[i] > box.max()[i]) {
+            corner[i] = box.max()[i];
+            ++outside;
+        }
+    }
+    if(outside <= 1) return tMin;
+
+    /* Otherwise the expanded box has rounded edges and corners there. Test
+       the movement with capsules around the box edges adjacent to the corner,
+       or only the edge going along the only axis the hit is inside in. */
+    Float t = Constants::inf();
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        if(outside != dimensions && (hit[i] < box.min()[i] || hit[i] > box.max()[i]))
+            continue;
+
+        VectorTypeFor<dimensions, Float> a = corner, b = corner;
+        a[i] = box.min()[i];
+        b[i] = box.max()[i];
+        t = Math::min(t, rayCapsule<dimensions>(sphere.position(), displacement, a, b, radius));
+    }
+
+    return clampToMovement(t);
+}
+
+template<UnsignedInt dimensions> Float timeOfImpact(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Box<dimensions>& box) {
+    /* Transform the movement into box space with unit axes, where the box is
+       axis-aligned and the sphere stays a sphere */
+    const VectorTypeFor<dimensions, Float> relative = sphere.position() - box.transformation().translation();
+    VectorTypeFor<dimensions, Float> halfExtents, position, localDisplacement;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        VectorTypeFor<dimensions, Float> axis;
+        axis[i] = 1.0f;
+        const VectorTypeFor<dimensions, Float> transformed = box.transformation().transformVector(axis);
+        halfExtents[i] = transformed.length();
+        if(halfExtents[i] != 0.0f) axis = transformed/halfExtents[i];
+
+        position[i] = Math::dot(relative, axis);
+        localDisplacement[i] = Math::dot(displacement, axis);
+    }
+
+    return timeOfImpact(Sphere<dimensions>{position, sphere.radius()}, localDisplacement, AxisAlignedBox<dimensions>{-halfExtents, halfExtents});
+}
+
+Float timeOfImpact(const Sphere3D& sphere, const Vector3& displacement, const Plane& plane) {
+    const Float distance = Math::dot(sphere.position() - plane.position(), plane.normal());
+    if(Math::abs(distance) < sphere.radius()) return 0.0f;
+
+    /* Intersection of center movement with the plane moved towards the sphere
+       by its radius. Parallel movement gives either infinity or NaN, failing
+       the range check below. */
+    const Float t = Intersection::planeLine(plane.position() + plane.normal()*(distance > 0.0f ? sphere.radius() : -sphere.radius()), plane.normal(), sphere.position(), displacement);
+    return t >= 0.0f && t <= 1.0f ? t : Constants::inf();
+}
+
+Float timeOfImpact(const Capsule3D& capsule, const Vector3& displacement, const Plane& plane) {
+    /* Already intersecting if the endpoints are on different sides or any of
+       them is closer than the radius */
+    const Float distanceA = Math::dot(capsule.a() - plane.position(), plane.normal());
+    const Float distanceB = Math::dot(capsule.b() - plane.position(), plane.normal());
+    if((distanceA < 0.0f) != (distanceB < 0.0f) ||
+        Math::abs(distanceA) < capsule.radius() ||
+        Math::abs(distanceB) < capsule.radius()) return 0.0f;
+
+    /* Otherwise the sphere around the nearer endpoint touches the plane
+       first */
+    return timeOfImpact(Sphere3D{Math::abs(distanceA) < Math::abs(distanceB) ? capsule.a() : capsule.b(), capsule.radius()}, displacement, plane);
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<2>&, const Vector2&, const Sphere<2>&);
+template MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<3>&, const Vector3&, const Sphere<3>&);
+template MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<2>&, const Vector2&, const Capsule<2>&);
+template MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<3>&, const Vector3&, const Capsule<3>&);
+template MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<2>&, const Vector2&, const AxisAlignedBox<2>&);
+template MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<3>&, const Vector3&, const AxisAlignedBox<3>&);
+template MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<2>&, const Vector2&, const Box<2>&);
+template MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<3>&, const Vector3&, const Box<3>&);
+#endif
+
+}}
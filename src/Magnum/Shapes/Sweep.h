@@ -0,0 +1,108 @@
+#ifndef Magnum_Shapes_Sweep_h
+#define Magnum_Shapes_Sweep_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Shapes::timeOfImpact()
+ */
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Shapes/Shapes.h"
+#include "Magnum/Shapes/visibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Time of impact of moving sphere with another sphere
+@param sphere       Sphere at the beginning of the movement
+@param displacement Movement of the sphere during the whole time step
+@param other        Static sphere
+
+Unlike the `%` and `/` operators, which test only the current positions,
+this is a continuous (swept) test, so a fast moving sphere can't tunnel
+through the other shape between two time steps. Returns fraction of
+@p displacement in range @f$ [0, 1] @f$ at which the sphere first touches
+@p other, `0.0f` if they already collide at the beginning and
+@ref Constants::inf() if they don't touch during the whole movement. For two
+moving shapes pass difference of their displacements.
+@code
+const Float t = Shapes::timeOfImpact(ball, velocity*delta, other);
+if(t <= 1.0f) {
+    // move the ball only by velocity*delta*t and resolve the contact...
+}
+@endcode
+@see @ref Sphere::operator%(const Sphere<dimensions>&) const
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Sphere<dimensions>& other);
+
+/**
+@brief Time of impact of moving sphere with capsule
+
+See @ref timeOfImpact(const Sphere<dimensions>&, const VectorTypeFor<dimensions, Float>&, const Sphere<dimensions>&)
+for more information.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Capsule<dimensions>& capsule);
+
+/**
+@brief Time of impact of moving sphere with axis-aligned box
+
+See @ref timeOfImpact(const Sphere<dimensions>&, const VectorTypeFor<dimensions, Float>&, const Sphere<dimensions>&)
+for more information.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const AxisAlignedBox<dimensions>& box);
+
+/**
+@brief Time of impact of moving sphere with box
+
+Expects that the box transformation has no shear, i.e. that the transformed
+box axes are orthogonal. See
+@ref timeOfImpact(const Sphere<dimensions>&, const VectorTypeFor<dimensions, Float>&, const Sphere<dimensions>&)
+for more information.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Box<dimensions>& box);
+
+/**
+@brief Time of impact of moving sphere with plane
+
+Expects that the plane normal is normalized. See
+@ref timeOfImpact(const Sphere<dimensions>&, const VectorTypeFor<dimensions, Float>&, const Sphere<dimensions>&)
+for more information.
+*/
+MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Sphere3D& sphere, const Vector3& displacement, const Plane& plane);
+
+/**
+@brief Time of impact of moving capsule with plane
+
+Expects that the plane normal is normalized. The capsule is only translated,
+not rotated. See @ref timeOfImpact(const Sphere<dimensions>&, const VectorTypeFor<dimensions, Float>&, const Sphere<dimensions>&)
+for more information.
+*/
+MAGNUM_SHAPES_EXPORT Float timeOfImpact(const Capsule3D& capsule, const Vector3& displacement, const Plane& plane);
+
+}}
+
+#endif
@@ -26,7 +26,11 @@
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
 
 #include "ShapeTestBase.h"
 
@@ -37,11 +41,25 @@ struct AxisAlignedBoxTest: TestSuite::Tester {
 
     void transformed();
     void collisionPoint();
+    void collisionLine();
+    void collisionLineSegment();
+    void collisionSphere();
+    void collisionSphereInside();
+    void collisionCylinder();
+    void collisionCapsule();
+    void collisionAxisAlignedBox();
 };
 
 AxisAlignedBoxTest::AxisAlignedBoxTest() {
     addTests({&AxisAlignedBoxTest::transformed,
-              &AxisAlignedBoxTest::collisionPoint});
+              &AxisAlignedBoxTest::collisionPoint,
+              &AxisAlignedBoxTest::collisionLine,
+              &AxisAlignedBoxTest::collisionLineSegment,
+              &AxisAlignedBoxTest::collisionSphere,
+              &AxisAlignedBoxTest::collisionSphereInside,
+              &AxisAlignedBoxTest::collisionCylinder,
+              &AxisAlignedBoxTest::collisionCapsule,
+              &AxisAlignedBoxTest::collisionAxisAlignedBox});
 }
 
 void AxisAlignedBoxTest::transformed() {
@@ -58,6 +76,189 @@ void AxisAlignedBoxTest::collisionPoint() {
 
     VERIFY_NOT_COLLIDES(box, point1);
     VERIFY_COLLIDES(box, point2);
+
+    /* Collision, the box is pushed out through the nearest face */
+    const Shapes::Point3D point3({0.5f, 1.0f, -2.0f});
+    const Shapes::Collision3D collision = box/point3;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), point3.position());
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(point3/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/point1));
+}
+
+void AxisAlignedBoxTest::collisionLine() {
+    Shapes::AxisAlignedBox3D box({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+    Shapes::Line3D line({0.5f, 0.0f, 0.0f}, {0.5f, 0.0f, 1.0f});
+    Shapes::Line3D line2({2.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 1.0f});
+
+    VERIFY_COLLIDES(box, line);
+    VERIFY_NOT_COLLIDES(box, line2);
+
+    /* Collision, only axes perpendicular to the line are tested */
+    const Shapes::Collision3D collision = box/line;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(line/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/line2));
+}
+
+void AxisAlignedBoxTest::collisionLineSegment() {
+    Shapes::AxisAlignedBox3D box({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+    Shapes::LineSegment3D segment({0.5f, 0.0f, -5.0f}, {0.5f, 0.0f, -2.0f});
+    Shapes::LineSegment3D segment2({0.5f, 0.0f, -5.0f}, {0.5f, 0.0f, -4.0f});
+
+    VERIFY_COLLIDES(box, segment);
+    VERIFY_NOT_COLLIDES(box, segment2);
+
+    /* Collision, moving the box along X is shorter than along Z */
+    const Shapes::Collision3D collision = box/segment;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.0f, -3.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(segment/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/segment2));
+}
+
+void AxisAlignedBoxTest::collisionSphere() {
+    Shapes::AxisAlignedBox3D box({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+    Shapes::Sphere3D sphere({2.0f, 0.0f, 0.0f}, 1.5f);
+    Shapes::Sphere3D sphere2({2.0f, 2.5f, 0.0f}, 1.0f);
+
+    VERIFY_COLLIDES(box, sphere);
+    VERIFY_NOT_COLLIDES(box, sphere2);
+
+    /* Collision */
+    const Shapes::Collision3D collision = box/sphere;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(sphere/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/sphere2));
+}
+
+void AxisAlignedBoxTest::collisionSphereInside() {
+    Shapes::AxisAlignedBox3D box({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+    Shapes::Sphere3D sphere({0.5f, 0.0f, 0.0f}, 0.5f);
+
+    VERIFY_COLLIDES(box, sphere);
+
+    /* Center inside, the box is pushed out through the nearest face */
+    const Shapes::Collision3D collision = box/sphere;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 1.0f);
+}
+
+void AxisAlignedBoxTest::collisionCylinder() {
+    Shapes::AxisAlignedBox3D box({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+    Shapes::Cylinder3D cylinder({2.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 1.0f}, 1.5f);
+    Shapes::Cylinder3D cylinder2({0.5f, 0.0f, 0.0f}, {0.5f, 0.0f, 1.0f}, 0.25f);
+    Shapes::Cylinder3D cylinder3({2.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 1.0f}, 0.5f);
+
+    VERIFY_COLLIDES(box, cylinder);
+    VERIFY_COLLIDES(box, cylinder2);
+    VERIFY_NOT_COLLIDES(box, cylinder3);
+
+    /* Axis outside of the box */
+    const Shapes::Collision3D collision = box/cylinder;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Axis crossing the box */
+    const Shapes::Collision3D collision2 = box/cylinder2;
+    CORRADE_VERIFY(collision2);
+    CORRADE_COMPARE(collision2.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision2.separationDistance(), 0.75f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision2.separationNormal(), -(cylinder2/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/cylinder3));
+}
+
+void AxisAlignedBoxTest::collisionCapsule() {
+    Shapes::AxisAlignedBox3D box({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+    Shapes::Capsule3D capsule({2.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f}, 1.5f);
+    Shapes::Capsule3D capsule2({0.5f, 0.0f, -5.0f}, {0.5f, 0.0f, 5.0f}, 0.25f);
+    Shapes::Capsule3D capsule3({2.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f}, 0.5f);
+
+    VERIFY_COLLIDES(box, capsule);
+    VERIFY_COLLIDES(box, capsule2);
+    VERIFY_NOT_COLLIDES(box, capsule3);
+
+    /* Axis outside of the box, equivalent to collision with sphere on the
+       closest axis point */
+    const Shapes::Collision3D collision = box/capsule;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Axis crossing the box */
+    const Shapes::Collision3D collision2 = box/capsule2;
+    CORRADE_VERIFY(collision2);
+    CORRADE_COMPARE(collision2.position(), Vector3(0.25f, 0.0f, -3.0f));
+    CORRADE_COMPARE(collision2.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision2.separationDistance(), 0.75f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision2.separationNormal(), -(capsule2/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/capsule3));
+
+    /* 2D */
+    Shapes::AxisAlignedBox2D box2D({-1.0f, -1.0f}, {1.0f, 1.0f});
+    VERIFY_COLLIDES(box2D, Shapes::Capsule2D({2.0f, -3.0f}, {2.0f, 3.0f}, 1.5f));
+    VERIFY_NOT_COLLIDES(box2D, Shapes::Capsule2D({2.0f, -3.0f}, {2.0f, 3.0f}, 0.5f));
+}
+
+void AxisAlignedBoxTest::collisionAxisAlignedBox() {
+    Shapes::AxisAlignedBox3D box({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+    Shapes::AxisAlignedBox3D box2({0.5f, -1.0f, -1.0f}, {3.0f, 1.0f, 1.0f});
+    Shapes::AxisAlignedBox3D box3({1.0f, 0.0f, 0.0f}, {2.0f, 1.0f, 1.0f});
+
+    VERIFY_COLLIDES(box, box2);
+    VERIFY_NOT_COLLIDES(box, box3);
+
+    /* Collision, position is on the face of the other box */
+    const Shapes::Collision3D collision = box/box2;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    const Shapes::Collision3D collision2 = box2/box;
+    CORRADE_COMPARE(collision2.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(collision2.separationDistance(), 0.5f);
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/box3));
 }
 
 }}}
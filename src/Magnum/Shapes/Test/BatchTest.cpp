@@ -0,0 +1,223 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Shapes/Batch.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct BatchTest: TestSuite::Tester {
+    explicit BatchTest();
+
+    void points();
+    void spheres();
+    void coordinatesOutOfRange();
+
+    void spherePointsMask();
+    void spherePointsIndices();
+    void sphereSpheresMask();
+    void sphereSpheresIndices();
+    void spheresSpheresMask();
+    void spheresSpheresIndices();
+    void empty();
+    void consistentWithShapes();
+};
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::points,
+              &BatchTest::spheres,
+              &BatchTest::coordinatesOutOfRange,
+
+              &BatchTest::spherePointsMask,
+              &BatchTest::spherePointsIndices,
+              &BatchTest::sphereSpheresMask,
+              &BatchTest::sphereSpheresIndices,
+              &BatchTest::spheresSpheresMask,
+              &BatchTest::spheresSpheresIndices,
+              &BatchTest::empty,
+              &BatchTest::consistentWithShapes});
+}
+
+void BatchTest::points() {
+    PointBatch3D points;
+    CORRADE_VERIFY(points.isEmpty());
+
+    points.add({{1.0f, 2.0f, 3.0f}})
+          .add({{4.0f, 5.0f, 6.0f}});
+    CORRADE_VERIFY(!points.isEmpty());
+    CORRADE_COMPARE(points.size(), 2);
+    CORRADE_COMPARE(points.coordinates(0), (std::vector<Float>{1.0f, 4.0f}));
+    CORRADE_COMPARE(points.coordinates(1), (std::vector<Float>{2.0f, 5.0f}));
+    CORRADE_COMPARE(points.coordinates(2), (std::vector<Float>{3.0f, 6.0f}));
+    CORRADE_COMPARE(points[1].position(), Vector3(4.0f, 5.0f, 6.0f));
+
+    points.set(0, {{7.0f, 8.0f, 9.0f}});
+    CORRADE_COMPARE(points[0].position(), Vector3(7.0f, 8.0f, 9.0f));
+
+    points.clear();
+    CORRADE_VERIFY(points.isEmpty());
+}
+
+void BatchTest::spheres() {
+    SphereBatch2D spheres;
+    CORRADE_VERIFY(spheres.isEmpty());
+
+    spheres.add({{1.0f, 2.0f}, 0.5f})
+           .add({{3.0f, 4.0f}, 1.5f});
+    CORRADE_COMPARE(spheres.size(), 2);
+    CORRADE_COMPARE(spheres.coordinates(0), (std::vector<Float>{1.0f, 3.0f}));
+    CORRADE_COMPARE(spheres.coordinates(1), (std::vector<Float>{2.0f, 4.0f}));
+    CORRADE_COMPARE(spheres.radii(), (std::vector<Float>{0.5f, 1.5f}));
+    CORRADE_COMPARE(spheres[1].position(), Vector2(3.0f, 4.0f));
+    CORRADE_COMPARE(spheres[1].radius(), 1.5f);
+
+    spheres.set(0, {{5.0f, 6.0f}, 2.5f});
+    CORRADE_COMPARE(spheres[0].position(), Vector2(5.0f, 6.0f));
+    CORRADE_COMPARE(spheres[0].radius(), 2.5f);
+
+    spheres.clear();
+    CORRADE_VERIFY(spheres.isEmpty());
+}
+
+void BatchTest::coordinatesOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    PointBatch2D points;
+    points.coordinates(2);
+    SphereBatch3D spheres;
+    spheres.coordinates(3);
+    CORRADE_COMPARE(out.str(),
+        "Shapes::PointBatch::coordinates(): dimension 2 out of range for 2 dimensions\n"
+        "Shapes::SphereBatch::coordinates(): dimension 3 out of range for 3 dimensions\n");
+}
+
+void BatchTest::spherePointsMask() {
+    /* More than one mask item */
+    PointBatch2D points;
+    for(Int i = 0; i != 40; ++i)
+        points.add({{Float(i), 0.0f}});
+
+    const std::vector<UnsignedInt> mask = collisionMask(Sphere2D{{30.5f, 0.0f}, 2.0f}, points);
+    CORRADE_COMPARE(mask, (std::vector<UnsignedInt>{
+        (1u << 29)|(1u << 30)|(1u << 31),
+        (1u << 0)}));
+}
+
+void BatchTest::spherePointsIndices() {
+    PointBatch3D points;
+    points.add({{0.0f, 0.0f, 0.0f}})
+          .add({{1.0f, 1.0f, 1.0f}})
+          .add({{0.5f, -0.5f, 0.0f}})
+          .add({{2.0f, 0.0f, 0.0f}});
+
+    CORRADE_COMPARE(collisionIndices(Sphere3D{{}, 1.0f}, points),
+        (std::vector<UnsignedInt>{0, 2}));
+}
+
+void BatchTest::sphereSpheresMask() {
+    SphereBatch3D spheres;
+    spheres.add({{3.0f, 0.0f, 0.0f}, 1.5f})
+           .add({{3.0f, 0.0f, 0.0f}, 0.5f})
+           .add({{0.0f, -1.0f, 0.0f}, 0.1f});
+
+    CORRADE_COMPARE(collisionMask(Sphere3D{{}, 2.0f}, spheres),
+        (std::vector<UnsignedInt>{(1u << 0)|(1u << 2)}));
+}
+
+void BatchTest::sphereSpheresIndices() {
+    SphereBatch2D spheres;
+    spheres.add({{3.0f, 0.0f}, 0.5f})
+           .add({{3.0f, 0.0f}, 1.5f})
+           .add({{0.0f, -1.0f}, 0.1f});
+
+    CORRADE_COMPARE(collisionIndices(Sphere2D{{}, 2.0f}, spheres),
+        (std::vector<UnsignedInt>{1, 2}));
+}
+
+void BatchTest::spheresSpheresMask() {
+    SphereBatch2D a, b;
+    a.add({{0.0f, 0.0f}, 1.0f})
+     .add({{10.0f, 0.0f}, 1.0f});
+    for(Int i = 0; i != 35; ++i)
+        b.add({{Float(i), 0.0f}, 0.25f});
+
+    /* Each row has two items */
+    CORRADE_COMPARE(collisionMask(a, b), (std::vector<UnsignedInt>{
+        (1u << 0)|(1u << 1), 0,
+        (1u << 9)|(1u << 10)|(1u << 11), 0}));
+}
+
+void BatchTest::spheresSpheresIndices() {
+    SphereBatch2D a, b;
+    a.add({{0.0f, 0.0f}, 1.0f})
+     .add({{5.0f, 0.0f}, 1.0f})
+     .add({{10.0f, 0.0f}, 1.0f});
+    b.add({{10.5f, 0.0f}, 0.25f})
+     .add({{0.5f, 0.0f}, 0.25f})
+     .add({{-0.5f, 0.0f}, 0.25f});
+
+    CORRADE_COMPARE(collisionIndices(a, b), (std::vector<std::pair<UnsignedInt, UnsignedInt>>{
+        {0, 1}, {0, 2}, {2, 0}}));
+}
+
+void BatchTest::empty() {
+    PointBatch3D points;
+    SphereBatch3D spheres;
+    CORRADE_VERIFY(collisionMask(Sphere3D{{}, 1.0f}, points).empty());
+    CORRADE_VERIFY(collisionIndices(Sphere3D{{}, 1.0f}, spheres).empty());
+    CORRADE_VERIFY(collisionMask(spheres, spheres).empty());
+    CORRADE_VERIFY(collisionIndices(spheres, spheres).empty());
+
+    /* Rows are empty as well */
+    spheres.add({{}, 1.0f});
+    CORRADE_VERIFY(collisionMask(spheres, SphereBatch3D{}).empty());
+}
+
+void BatchTest::consistentWithShapes() {
+    /* Pseudo-random shapes, including ones exactly touching */
+    PointBatch3D points;
+    SphereBatch3D spheres;
+    for(Int i = 0; i != 100; ++i) {
+        const Vector3 position{Float((i*37) % 17) - 8.0f, Float((i*11) % 13) - 6.0f, Float(i % 5) - 2.0f};
+        points.add(Point3D{position});
+        spheres.add({position*0.5f, Float(i % 4)*0.5f});
+    }
+
+    const Sphere3D sphere{{1.0f, -1.0f, 0.0f}, 3.0f};
+    const std::vector<UnsignedInt> pointMask = collisionMask(sphere, points);
+    const std::vector<UnsignedInt> sphereMask = collisionMask(sphere, spheres);
+    for(std::size_t i = 0; i != points.size(); ++i) {
+        CORRADE_COMPARE(bool(pointMask[i/32] & (1u << i%32)), sphere % points[i]);
+        CORRADE_COMPARE(bool(sphereMask[i/32] & (1u << i%32)), sphere % spheres[i]);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::BatchTest)
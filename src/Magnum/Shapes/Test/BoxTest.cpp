@@ -26,8 +26,17 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
 #include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+
+#include "ShapeTestBase.h"
 
 namespace Magnum { namespace Shapes { namespace Test {
 
@@ -35,10 +44,26 @@ struct BoxTest: TestSuite::Tester {
     explicit BoxTest();
 
     void transformed();
+    void collisionPoint();
+    void collisionLine();
+    void collisionLineSegment();
+    void collisionSphere();
+    void collisionCylinder();
+    void collisionCapsule();
+    void collisionAxisAlignedBox();
+    void collisionBox();
 };
 
 BoxTest::BoxTest() {
-    addTests({&BoxTest::transformed});
+    addTests({&BoxTest::transformed,
+              &BoxTest::collisionPoint,
+              &BoxTest::collisionLine,
+              &BoxTest::collisionLineSegment,
+              &BoxTest::collisionSphere,
+              &BoxTest::collisionCylinder,
+              &BoxTest::collisionCapsule,
+              &BoxTest::collisionAxisAlignedBox,
+              &BoxTest::collisionBox});
 }
 
 void BoxTest::transformed() {
@@ -47,6 +72,203 @@ void BoxTest::transformed() {
     CORRADE_COMPARE(box.transformation(), Matrix4::scaling({2.0f, -1.0f, 1.5f})*Matrix4::translation({1.0f, 2.0f, -3.0f}));
 }
 
+void BoxTest::collisionPoint() {
+    Shapes::Box3D box(Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::scaling({2.0f, 1.0f, 1.0f}));
+    Shapes::Point3D point({2.5f, 2.2f, 3.1f});
+    Shapes::Point3D point2({3.5f, 2.0f, 3.0f});
+
+    VERIFY_COLLIDES(box, point);
+    VERIFY_NOT_COLLIDES(box, point2);
+
+    /* Collision, penetration is measured in world space */
+    const Shapes::Collision3D collision = box/point;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), point.position());
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(point/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/point2));
+}
+
+void BoxTest::collisionLine() {
+    /* Unit box rotated by 45 degrees, vertices are at distance sqrt(2) from
+       the center */
+    Shapes::Box2D box(Matrix3::rotation(Deg(45.0f)));
+    Shapes::Line2D line({1.0f, -1.0f}, {1.0f, 1.0f});
+    Shapes::Line2D line2({2.0f, -1.0f}, {2.0f, 1.0f});
+
+    VERIFY_COLLIDES(box, line);
+    VERIFY_NOT_COLLIDES(box, line2);
+
+    /* Collision */
+    const Shapes::Collision2D collision = box/line;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.separationNormal(), -Vector2::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), Constants::sqrt2() - 1.0f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(line/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/line2));
+}
+
+void BoxTest::collisionLineSegment() {
+    /* Longer side is along Y, the box spans from 0 to 2 on X */
+    Shapes::Box3D box(Matrix4::translation({1.0f, 0.0f, 0.0f})*Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling({2.0f, 1.0f, 1.0f}));
+    Shapes::LineSegment3D segment({1.0f, 0.0f, -5.0f}, {1.0f, 0.0f, -0.5f});
+    Shapes::LineSegment3D segment2({1.0f, 0.0f, -5.0f}, {1.0f, 0.0f, -1.5f});
+
+    VERIFY_COLLIDES(box, segment);
+    VERIFY_NOT_COLLIDES(box, segment2);
+
+    /* Collision, contact position is on the segment end inside the box */
+    const Shapes::Collision3D collision = box/segment;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(1.0f, 0.0f, -0.5f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector3::zAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(segment/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/segment2));
+}
+
+void BoxTest::collisionSphere() {
+    /* Longer side is along Y */
+    Shapes::Box3D box(Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling({2.0f, 1.0f, 1.0f}));
+    Shapes::Sphere3D sphere({1.0f, 4.5f, 3.0f}, 1.0f);
+    Shapes::Sphere3D sphere2({1.0f, 5.1f, 3.0f}, 1.0f);
+
+    VERIFY_COLLIDES(box, sphere);
+    VERIFY_NOT_COLLIDES(box, sphere2);
+
+    /* Collision, contact position is on the surface of the sphere */
+    const Shapes::Collision3D collision = box/sphere;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(1.0f, 3.5f, 3.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(sphere/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/sphere2));
+}
+
+void BoxTest::collisionCylinder() {
+    /* Longer side is along Y, the box spans from 0 to 2 on X */
+    Shapes::Box3D box(Matrix4::translation({1.0f, 0.0f, 0.0f})*Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling({2.0f, 1.0f, 1.0f}));
+    Shapes::Cylinder3D cylinder({1.5f, 0.0f, 0.0f}, {1.5f, 0.0f, 1.0f}, 0.25f);
+    Shapes::Cylinder3D cylinder2({3.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 1.0f}, 0.5f);
+
+    VERIFY_COLLIDES(box, cylinder);
+    VERIFY_NOT_COLLIDES(box, cylinder2);
+
+    /* Collision */
+    const Shapes::Collision3D collision = box/cylinder;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.75f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(cylinder/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/cylinder2));
+}
+
+void BoxTest::collisionCapsule() {
+    /* Unit box rotated by 45 degrees, vertices are at distance sqrt(2) from
+       the center */
+    Shapes::Box2D box(Matrix3::rotation(Deg(45.0f)));
+    Shapes::Capsule2D capsule({2.0f, -1.0f}, {2.0f, 1.0f}, 0.7f);
+    Shapes::Capsule2D capsule2({2.0f, -1.0f}, {2.0f, 1.0f}, 0.5f);
+
+    VERIFY_COLLIDES(box, capsule);
+    VERIFY_NOT_COLLIDES(box, capsule2);
+
+    /* Collision with the box vertex, contact position is on the capsule
+       surface */
+    const Shapes::Collision2D collision = box/capsule;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector2(1.3f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector2::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.7f - (2.0f - Constants::sqrt2()));
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(capsule/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/capsule2));
+}
+
+void BoxTest::collisionAxisAlignedBox() {
+    Shapes::Box3D box(Matrix4::rotationZ(Deg(45.0f)));
+    Shapes::AxisAlignedBox3D aabb({1.2f, -0.1f, -0.1f}, {2.0f, 0.1f, 0.1f});
+    Shapes::AxisAlignedBox3D aabb2({1.5f, -0.1f, -0.1f}, {2.0f, 0.1f, 0.1f});
+
+    VERIFY_COLLIDES(box, aabb);
+    VERIFY_NOT_COLLIDES(box, aabb2);
+
+    /* Collision, the box corner penetrates the axis-aligned box */
+    const Shapes::Collision3D collision = box/aabb;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(1.2f, 0.1f, 0.1f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), Constants::sqrt2() - 1.2f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(aabb/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/aabb2));
+}
+
+void BoxTest::collisionBox() {
+    Shapes::Box3D box{Matrix4{}};
+    Shapes::Box3D box1(Matrix4::translation({0.0f, 0.0f, 2.3f})*Matrix4::rotationX(Deg(45.0f)));
+    Shapes::Box3D box2(Matrix4::translation({0.0f, 0.0f, 2.5f})*Matrix4::rotationX(Deg(45.0f)));
+
+    VERIFY_COLLIDES(box, box1);
+    VERIFY_NOT_COLLIDES(box, box2);
+
+    /* Collision, contact position is on the edge of the other box, the
+       vertex is picked arbitrarily */
+    const Shapes::Collision3D collision = box/box1;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(1.0f, 0.0f, 2.3f - Constants::sqrt2()));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::zAxis());
+    CORRADE_COMPARE(collision.separationDistance(), Constants::sqrt2() - 1.3f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(box1/box).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(box/box2));
+
+    /* 2D, the smaller penetration is along X */
+    Shapes::Box2D box2D(Matrix3::scaling({2.0f, 1.0f}));
+    Shapes::Box2D box2D1(Matrix3::translation({2.6f, 1.0f}));
+    Shapes::Box2D box2D2(Matrix3::translation({3.5f, 0.5f}));
+
+    VERIFY_COLLIDES(box2D, box2D1);
+    VERIFY_NOT_COLLIDES(box2D, box2D2);
+
+    const Shapes::Collision2D collision2D = box2D/box2D1;
+    CORRADE_VERIFY(collision2D);
+    CORRADE_COMPARE(collision2D.position(), Vector2(1.6f, 2.0f));
+    CORRADE_COMPARE(collision2D.separationNormal(), -Vector2::xAxis());
+    CORRADE_COMPARE(collision2D.separationDistance(), 0.4f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::BoxTest)
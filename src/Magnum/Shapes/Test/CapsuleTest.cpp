@@ -27,6 +27,8 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Sphere.h"
 
@@ -40,13 +42,21 @@ struct CapsuleTest: TestSuite::Tester {
     void transformed();
     void transformedAverageScaling();
     void collisionPoint();
+    void collisionLine();
+    void collisionLineSegment();
     void collisionSphere();
+    void collisionCylinder();
+    void collisionCapsule();
 };
 
 CapsuleTest::CapsuleTest() {
     addTests({&CapsuleTest::transformed,
               &CapsuleTest::collisionPoint,
-              &CapsuleTest::collisionSphere});
+              &CapsuleTest::collisionLine,
+              &CapsuleTest::collisionLineSegment,
+              &CapsuleTest::collisionSphere,
+              &CapsuleTest::collisionCylinder,
+              &CapsuleTest::collisionCapsule});
 }
 
 void CapsuleTest::transformed() {
@@ -67,6 +77,71 @@ void CapsuleTest::collisionPoint() {
     VERIFY_COLLIDES(capsule, point);
     VERIFY_COLLIDES(capsule, point1);
     VERIFY_NOT_COLLIDES(capsule, point2);
+
+    /* Collision */
+    const Shapes::Capsule3D capsule2({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 2.0f);
+    const Shapes::Point3D point3({0.5f, 1.5f, 0.0f});
+    const Shapes::Collision3D collision = capsule2/point3;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), point3.position());
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(point3/capsule2).separationNormal());
+
+    /* Collision beyond the endpoint is with the spherical cap */
+    const Shapes::Collision3D collision2 = capsule2/Shapes::Point3D({2.5f, 0.0f, 0.0f});
+    CORRADE_VERIFY(collision2);
+    CORRADE_COMPARE(collision2.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision2.separationDistance(), 0.5f);
+
+    /* No collision */
+    CORRADE_VERIFY(!(capsule/point2));
+}
+
+void CapsuleTest::collisionLine() {
+    Shapes::Capsule3D capsule({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 1.0f);
+    Shapes::Line3D line({0.0f, 0.5f, -1.0f}, {0.0f, 0.5f, 1.0f});
+    Shapes::Line3D line2({0.0f, 1.5f, -1.0f}, {0.0f, 1.5f, 1.0f});
+
+    VERIFY_COLLIDES(capsule, line);
+    VERIFY_NOT_COLLIDES(capsule, line2);
+
+    /* Collision, contact position is on the line */
+    const Shapes::Collision3D collision = capsule/line;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(line/capsule).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(capsule/line2));
+}
+
+void CapsuleTest::collisionLineSegment() {
+    Shapes::Capsule3D capsule({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 1.0f);
+    Shapes::LineSegment3D segment({0.0f, 0.5f, -1.0f}, {0.0f, 0.5f, 1.0f});
+    Shapes::LineSegment3D segment2({3.0f, 0.5f, -1.0f}, {3.0f, 0.5f, 1.0f});
+
+    VERIFY_COLLIDES(capsule, segment);
+    VERIFY_NOT_COLLIDES(capsule, segment2);
+
+    /* Collision */
+    const Shapes::Collision3D collision = capsule/segment;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(segment/capsule).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(capsule/segment2));
 }
 
 void CapsuleTest::collisionSphere() {
@@ -78,6 +153,76 @@ void CapsuleTest::collisionSphere() {
     VERIFY_COLLIDES(capsule, sphere);
     VERIFY_COLLIDES(capsule, sphere1);
     VERIFY_NOT_COLLIDES(capsule, sphere2);
+
+    /* Collision */
+    const Shapes::Capsule3D capsule2({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 2.0f);
+    const Shapes::Sphere3D sphere3({0.0f, 2.5f, 0.0f}, 1.0f);
+    const Shapes::Collision3D collision = capsule2/sphere3;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 1.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(sphere3/capsule2).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(capsule/sphere2));
+}
+
+void CapsuleTest::collisionCylinder() {
+    Shapes::Capsule3D capsule({-1.0f, 3.0f, 2.0f}, {1.0f, 3.0f, 2.0f}, 1.0f);
+    Shapes::Capsule3D capsule2({-1.0f, 3.0f, 2.6f}, {1.0f, 3.0f, 2.6f}, 1.0f);
+    Shapes::Cylinder3D cylinder({}, {0.0f, 1.0f, 0.0f}, 1.5f);
+
+    VERIFY_COLLIDES(capsule, cylinder);
+    VERIFY_NOT_COLLIDES(capsule2, cylinder);
+
+    /* Collision */
+    const Shapes::Collision3D collision = capsule/cylinder;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 3.0f, 1.5f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector3::zAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(cylinder/capsule).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(capsule2/cylinder));
+}
+
+void CapsuleTest::collisionCapsule() {
+    Shapes::Capsule3D capsule({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 1.0f);
+    Shapes::Capsule3D capsule1({0.0f, -1.0f, 1.5f}, {0.0f, 1.0f, 1.5f}, 1.0f);
+    Shapes::Capsule3D capsule2({0.0f, -1.0f, 2.5f}, {0.0f, 1.0f, 2.5f}, 1.0f);
+
+    VERIFY_COLLIDES(capsule, capsule1);
+    VERIFY_NOT_COLLIDES(capsule, capsule2);
+
+    /* Collision of crossing axes */
+    const Shapes::Collision3D collision = capsule/capsule1;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.0f, 0.5f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::zAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(capsule1/capsule).separationNormal());
+
+    /* Parallel axes */
+    const Shapes::Collision3D collision2 = capsule/Shapes::Capsule3D({0.0f, 1.5f, 0.0f}, {3.0f, 1.5f, 0.0f}, 1.0f);
+    CORRADE_VERIFY(collision2);
+    CORRADE_COMPARE(collision2.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision2.separationDistance(), 0.5f);
+
+    /* No collision */
+    CORRADE_VERIFY(!(capsule/capsule2));
+
+    /* 2D */
+    Shapes::Capsule2D capsule2D({-1.0f, 0.0f}, {1.0f, 0.0f}, 0.5f);
+    VERIFY_COLLIDES(capsule2D, Shapes::Capsule2D({1.5f, -1.0f}, {1.5f, 1.0f}, 0.4f));
+    VERIFY_NOT_COLLIDES(capsule2D, Shapes::Capsule2D({2.0f, -1.0f}, {2.0f, 1.0f}, 0.4f));
 }
 
 }}}
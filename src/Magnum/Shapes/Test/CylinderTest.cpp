@@ -27,6 +27,7 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Sphere.h"
 
@@ -40,13 +41,19 @@ struct CylinderTest: TestSuite::Tester {
     void transformed();
     void transformedAverageScaling();
     void collisionPoint();
+    void collisionLine();
+    void collisionLineSegment();
     void collisionSphere();
+    void collisionCylinder();
 };
 
 CylinderTest::CylinderTest() {
     addTests({&CylinderTest::transformed,
               &CylinderTest::collisionPoint,
-              &CylinderTest::collisionSphere});
+              &CylinderTest::collisionLine,
+              &CylinderTest::collisionLineSegment,
+              &CylinderTest::collisionSphere,
+              &CylinderTest::collisionCylinder});
 }
 
 void CylinderTest::transformed() {
@@ -67,6 +74,71 @@ void CylinderTest::collisionPoint() {
     VERIFY_COLLIDES(cylinder, point);
     VERIFY_COLLIDES(cylinder, point1);
     VERIFY_NOT_COLLIDES(cylinder, point2);
+
+    /* Collision */
+    const Shapes::Cylinder3D cylinder2({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 2.0f);
+    const Shapes::Point3D point3({0.5f, 1.5f, 0.0f});
+    const Shapes::Collision3D collision = cylinder2/point3;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), point3.position());
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(point3/cylinder2).separationNormal());
+
+    /* The cylinder is infinite, no caps */
+    const Shapes::Collision3D collision2 = cylinder2/Shapes::Point3D({2.5f, 1.5f, 0.0f});
+    CORRADE_VERIFY(collision2);
+    CORRADE_COMPARE(collision2.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision2.separationDistance(), 0.5f);
+
+    /* No collision */
+    CORRADE_VERIFY(!(cylinder/point2));
+}
+
+void CylinderTest::collisionLine() {
+    Shapes::Cylinder3D cylinder({}, {0.0f, 1.0f, 0.0f}, 1.5f);
+    Shapes::Line3D line({-1.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f});
+    Shapes::Line3D line2({-1.0f, 0.0f, 2.0f}, {1.0f, 0.0f, 2.0f});
+
+    VERIFY_COLLIDES(cylinder, line);
+    VERIFY_NOT_COLLIDES(cylinder, line2);
+
+    /* Collision, contact position is on the line */
+    const Shapes::Collision3D collision = cylinder/line;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::zAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(line/cylinder).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(cylinder/line2));
+}
+
+void CylinderTest::collisionLineSegment() {
+    Shapes::Cylinder3D cylinder({}, {0.0f, 1.0f, 0.0f}, 1.5f);
+    Shapes::LineSegment3D segment({-1.0f, 3.0f, 1.0f}, {1.0f, 3.0f, 1.0f});
+    Shapes::LineSegment3D segment2({5.0f, 3.0f, 1.0f}, {7.0f, 3.0f, 1.0f});
+
+    VERIFY_COLLIDES(cylinder, segment);
+    VERIFY_NOT_COLLIDES(cylinder, segment2);
+
+    /* Collision */
+    const Shapes::Collision3D collision = cylinder/segment;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 3.0f, 1.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::zAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(segment/cylinder).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(cylinder/segment2));
 }
 
 void CylinderTest::collisionSphere() {
@@ -78,6 +150,49 @@ void CylinderTest::collisionSphere() {
     VERIFY_COLLIDES(cylinder, sphere);
     VERIFY_COLLIDES(cylinder, sphere1);
     VERIFY_NOT_COLLIDES(cylinder, sphere2);
+
+    /* Collision */
+    const Shapes::Cylinder3D cylinder2({-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 2.0f);
+    const Shapes::Sphere3D sphere3({0.0f, 2.5f, 0.0f}, 1.0f);
+    const Shapes::Collision3D collision = cylinder2/sphere3;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 1.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(sphere3/cylinder2).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(cylinder/sphere2));
+}
+
+void CylinderTest::collisionCylinder() {
+    Shapes::Cylinder3D cylinder({}, {0.0f, 1.0f, 0.0f}, 1.5f);
+    Shapes::Cylinder3D cylinder1({0.0f, 0.0f, 2.0f}, {1.0f, 0.0f, 2.0f}, 1.0f);
+    Shapes::Cylinder3D cylinder2({0.0f, 0.0f, 2.0f}, {1.0f, 0.0f, 2.0f}, 0.4f);
+
+    VERIFY_COLLIDES(cylinder, cylinder1);
+    VERIFY_NOT_COLLIDES(cylinder, cylinder2);
+
+    /* Collision of crossing axes */
+    const Shapes::Collision3D collision = cylinder/cylinder1;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::zAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(cylinder1/cylinder).separationNormal());
+
+    /* Parallel axes */
+    const Shapes::Collision3D collision2 = cylinder/Shapes::Cylinder3D({2.0f, 0.0f, 0.0f}, {2.0f, 1.0f, 0.0f}, 1.0f);
+    CORRADE_VERIFY(collision2);
+    CORRADE_COMPARE(collision2.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision2.separationDistance(), 0.5f);
+
+    /* No collision */
+    CORRADE_VERIFY(!(cylinder/cylinder2));
 }
 
 }}}
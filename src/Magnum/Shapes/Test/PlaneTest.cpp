@@ -24,9 +24,14 @@
 */
 
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
 #include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Plane.h"
+#include "Magnum/Shapes/Sphere.h"
 
 #include "ShapeTestBase.h"
 
@@ -38,12 +43,24 @@ struct PlaneTest: TestSuite::Tester {
     void transformed();
     void collisionLine();
     void collisionLineSegment();
+    void collisionSphere();
+    void collisionCylinder();
+    void collisionCapsule();
+    void collisionAxisAlignedBox();
+    void collisionBox();
+    void collisionPlane();
 };
 
 PlaneTest::PlaneTest() {
     addTests({&PlaneTest::transformed,
               &PlaneTest::collisionLine,
-              &PlaneTest::collisionLineSegment});
+              &PlaneTest::collisionLineSegment,
+              &PlaneTest::collisionSphere,
+              &PlaneTest::collisionCylinder,
+              &PlaneTest::collisionCapsule,
+              &PlaneTest::collisionAxisAlignedBox,
+              &PlaneTest::collisionBox,
+              &PlaneTest::collisionPlane});
 }
 
 void PlaneTest::transformed() {
@@ -75,6 +92,139 @@ void PlaneTest::collisionLineSegment() {
     VERIFY_COLLIDES(plane, line);
     VERIFY_NOT_COLLIDES(plane, line2);
     VERIFY_NOT_COLLIDES(plane, line3);
+
+    /* Collision, the plane is moved past the nearer endpoint */
+    const Shapes::Collision3D collision = plane/line;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), line.a());
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.1f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(line/plane).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(plane/line2));
+}
+
+void PlaneTest::collisionSphere() {
+    Shapes::Plane plane(Vector3(), Vector3::yAxis());
+    Shapes::Sphere3D sphere({0.0f, 0.5f, 0.0f}, 1.0f);
+    Shapes::Sphere3D sphere2({0.0f, -1.5f, 0.0f}, 1.0f);
+
+    VERIFY_COLLIDES(plane, sphere);
+    VERIFY_NOT_COLLIDES(plane, sphere2);
+
+    /* Collision */
+    const Shapes::Collision3D collision = plane/sphere;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, -0.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(sphere/plane).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(plane/sphere2));
+}
+
+void PlaneTest::collisionCylinder() {
+    const Shapes::Plane plane({}, Vector3::yAxis());
+
+    /* Parallel with the plane */
+    VERIFY_COLLIDES(plane, Shapes::Cylinder3D({0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, 1.5f));
+    VERIFY_NOT_COLLIDES(plane, Shapes::Cylinder3D({0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, 0.5f));
+
+    /* Not parallel, crosses the plane */
+    VERIFY_COLLIDES(plane, Shapes::Cylinder3D({0.0f, 5.0f, 0.0f}, {1.0f, 6.0f, 0.0f}, 0.5f));
+}
+
+void PlaneTest::collisionCapsule() {
+    Shapes::Plane plane(Vector3(), Vector3::yAxis());
+    Shapes::Capsule3D capsule({-1.0f, 0.5f, 0.0f}, {1.0f, 1.0f, 0.0f}, 0.6f);
+    Shapes::Capsule3D capsule1({0.0f, -0.2f, 0.0f}, {0.0f, 2.0f, 0.0f}, 0.5f);
+    Shapes::Capsule3D capsule2({0.0f, 1.0f, 0.0f}, {1.0f, 2.0f, 0.0f}, 0.9f);
+
+    VERIFY_COLLIDES(plane, capsule);
+    VERIFY_COLLIDES(plane, capsule1);
+    VERIFY_NOT_COLLIDES(plane, capsule2);
+
+    /* Collision with the end cap */
+    const Shapes::Collision3D collision = plane/capsule;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(-1.0f, -0.1f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.1f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(capsule/plane).separationNormal());
+
+    /* Collision with the axis crossing the plane, the plane is moved past
+       the nearer end cap */
+    const Shapes::Collision3D collision1 = plane/capsule1;
+    CORRADE_VERIFY(collision1);
+    CORRADE_COMPARE(collision1.position(), Vector3(0.0f, -0.7f, 0.0f));
+    CORRADE_COMPARE(collision1.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision1.separationDistance(), 0.7f);
+
+    /* No collision */
+    CORRADE_VERIFY(!(plane/capsule2));
+}
+
+void PlaneTest::collisionAxisAlignedBox() {
+    Shapes::Plane plane(Vector3(), Vector3::yAxis());
+    Shapes::AxisAlignedBox3D box({-1.0f, -0.5f, -1.0f}, {1.0f, 1.5f, 1.0f});
+    Shapes::AxisAlignedBox3D box2({-1.0f, 0.1f, -1.0f}, {1.0f, 1.0f, 1.0f});
+
+    VERIFY_COLLIDES(plane, box);
+    VERIFY_NOT_COLLIDES(plane, box2);
+
+    /* Collision */
+    const Shapes::Collision3D collision = plane/box;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(1.0f, -0.5f, 1.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(box/plane).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(plane/box2));
+}
+
+void PlaneTest::collisionBox() {
+    Shapes::Plane plane(Vector3(), Vector3::yAxis());
+    Shapes::Box3D box(Matrix4::translation(Vector3::yAxis(1.0f))*Matrix4::rotationZ(Deg(45.0f)));
+    Shapes::Box3D box2(Matrix4::translation(Vector3::yAxis(1.5f))*Matrix4::rotationZ(Deg(45.0f)));
+
+    VERIFY_COLLIDES(plane, box);
+    VERIFY_NOT_COLLIDES(plane, box2);
+
+    /* Collision, contact position is on the lowest box edge */
+    const Shapes::Collision3D collision = plane/box;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.0f, 1.0f - Constants::sqrt2(), 1.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), Constants::sqrt2() - 1.0f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(box/plane).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(plane/box2));
+}
+
+void PlaneTest::collisionPlane() {
+    const Shapes::Plane plane({}, Vector3::yAxis());
+
+    /* Not parallel */
+    VERIFY_COLLIDES(plane, Shapes::Plane({0.0f, 1.0f, 0.0f}, Vector3::xAxis()));
+
+    /* Parallel, only the same plane collides */
+    VERIFY_NOT_COLLIDES(plane, Shapes::Plane({0.0f, 1.0f, 0.0f}, Vector3::yAxis()));
+    VERIFY_COLLIDES(plane, Shapes::Plane({5.0f, 0.0f, 3.0f}, -Vector3::yAxis()));
 }
 
 }}}
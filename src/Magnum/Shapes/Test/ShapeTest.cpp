@@ -23,9 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <memory>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
 #include "Magnum/Shapes/Composition.h"
+#include "Magnum/Shapes/Line.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Plane.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Shape.h"
 #include "Magnum/Shapes/ShapeGroup.h"
@@ -40,9 +47,16 @@ struct ShapeTest: TestSuite::Tester {
     explicit ShapeTest();
 
     void clean();
+    void cleanGeneration();
     void collides();
     void collision();
+    void collisionDispatch();
     void firstCollision();
+    void firstCollisionBroadPhase();
+    void collidingPairs();
+    void collidingPairsUnbounded();
+    void collidingPairsUnboundedNotImplemented();
+    void groupMembership();
     void shapeGroup();
 };
 
@@ -53,9 +67,16 @@ typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
 
 ShapeTest::ShapeTest() {
     addTests({&ShapeTest::clean,
+              &ShapeTest::cleanGeneration,
               &ShapeTest::collides,
               &ShapeTest::collision,
+              &ShapeTest::collisionDispatch,
               &ShapeTest::firstCollision,
+              &ShapeTest::firstCollisionBroadPhase,
+              &ShapeTest::collidingPairs,
+              &ShapeTest::collidingPairsUnbounded,
+              &ShapeTest::collidingPairsUnboundedNotImplemented,
+              &ShapeTest::groupMembership,
               &ShapeTest::shapeGroup});
 }
 
@@ -99,6 +120,31 @@ void ShapeTest::clean() {
     CORRADE_VERIFY(b.isDirty());
 }
 
+void ShapeTest::cleanGeneration() {
+    Scene3D scene;
+    scene.setDirtyTracking(SceneGraph::DirtyTracking::Generation);
+    ShapeGroup3D shapes;
+
+    Object3D parent(&scene);
+    Object3D a(&parent);
+    auto sphere = new Shapes::Shape<Shapes::Sphere3D>(a, {{}, 1.0f}, &shapes);
+
+    Object3D b(&scene);
+    b.translate(Vector3::xAxis(5.0f));
+    new Shapes::Shape<Shapes::Sphere3D>(b, {{}, 1.0f}, &shapes);
+
+    CORRADE_VERIFY(!shapes.firstCollision(*sphere));
+    CORRADE_VERIFY(!shapes.isDirty());
+
+    /* Moving the parent doesn't notify the group, but the shape should be
+       updated anyway */
+    parent.translate(Vector3::xAxis(4.5f));
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(shapes.firstCollision(*sphere));
+    CORRADE_COMPARE(sphere->transformedShape().position(), Vector3::xAxis(4.5f));
+    CORRADE_VERIFY(!a.isDirty());
+}
+
 void ShapeTest::collides() {
     Scene3D scene;
     ShapeGroup3D shapes;
@@ -181,6 +227,75 @@ void ShapeTest::collision() {
     }
 }
 
+void ShapeTest::collisionDispatch() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    Object3D a(&scene);
+    Shape<Shapes::Capsule3D> aShape(a, {{-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 2.0f}, &shapes);
+    Shape<Shapes::Point3D> bShape(a, {{0.5f, 1.5f, 0.0f}}, &shapes);
+    Shape<Shapes::AxisAlignedBox3D> cShape(a, {{1.0f, -1.0f, -1.0f}, {2.0f, 1.0f, 1.0f}}, &shapes);
+    Shape<Shapes::Plane> dShape(a, {{}, Vector3::yAxis()}, &shapes);
+    Shape<Shapes::Line3D> eShape(a, {{0.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}}, &shapes);
+    Shape<Shapes::LineSegment3D> fShape(a, {{0.0f, -0.1f, 0.0f}, {0.0f, 7.0f, 0.0f}}, &shapes);
+    Shape<Shapes::Composition3D> gShape(a, Shapes::Point3D{{5.0f, 0.0f, 0.0f}} || Shapes::Sphere3D{{0.0f, 2.0f, 0.0f}, 0.8f}, &shapes);
+    Shape<Shapes::InvertedSphere3D> hShape(a, {{}, 10.0f}, &shapes);
+    shapes.setClean();
+
+    /* Collision is computed from the point of view of the first shape in
+       both orders */
+    const Collision3D collision = aShape.collision(bShape);
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 1.5f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    const Collision3D flipped = bShape.collision(aShape);
+    CORRADE_VERIFY(flipped);
+    CORRADE_COMPARE(flipped.separationNormal(), Vector3::yAxis());
+    CORRADE_COMPARE(flipped.separationDistance(), 0.5f);
+
+    /* Capsule with axis-aligned box, the capsule axis touches the box */
+    CORRADE_VERIFY(aShape.collides(cShape));
+    CORRADE_VERIFY(cShape.collides(aShape));
+    const Collision3D boxCollision = cShape.collision(aShape);
+    CORRADE_VERIFY(boxCollision);
+    CORRADE_COMPARE(boxCollision.position(), Vector3(3.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(boxCollision.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(boxCollision.separationDistance(), 2.0f);
+
+    /* Plane with axis-aligned box */
+    CORRADE_VERIFY(dShape.collides(cShape));
+    CORRADE_VERIFY(cShape.collides(dShape));
+    CORRADE_COMPARE(dShape.collision(cShape).separationDistance(), 1.0f);
+
+    /* Composition tests its parts in both orders */
+    CORRADE_VERIFY(gShape.collides(bShape));
+    CORRADE_VERIFY(bShape.collides(gShape));
+    CORRADE_VERIFY(!gShape.collides(cShape));
+
+    /* One-dimensional shapes never collide with each other */
+    CORRADE_VERIFY(!bShape.collides(fShape));
+    CORRADE_VERIFY(!eShape.collides(fShape));
+    CORRADE_VERIFY(!eShape.collision(fShape));
+
+    /* Unbounded shapes always collide with inverted sphere, but have no
+       finite penetration */
+    CORRADE_VERIFY(hShape.collides(dShape));
+    CORRADE_VERIFY(dShape.collides(hShape));
+    CORRADE_VERIFY(!hShape.collision(dShape));
+
+    /* Occurence-only pair, plane with line has no finite penetration */
+    CORRADE_VERIFY(dShape.collides(eShape));
+    CORRADE_VERIFY(eShape.collides(dShape));
+    CORRADE_VERIFY(!dShape.collision(eShape));
+
+    /* Plane with line segment */
+    CORRADE_VERIFY(dShape.collides(fShape));
+    CORRADE_VERIFY(fShape.collides(dShape));
+    CORRADE_COMPARE(dShape.collision(fShape).separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(fShape.collision(dShape).separationNormal(), Vector3::yAxis());
+}
+
 void ShapeTest::firstCollision() {
     Scene3D scene;
     ShapeGroup3D shapes;
@@ -206,6 +321,145 @@ void ShapeTest::firstCollision() {
     CORRADE_VERIFY(!shapes.isDirty());
 }
 
+void ShapeTest::firstCollisionBroadPhase() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    /* Row of spheres, each touching only its neighbors */
+    std::vector<std::unique_ptr<Object2D>> objects;
+    std::vector<Shape<Shapes::Sphere2D>*> spheres;
+    for(Int i = 0; i != 50; ++i) {
+        objects.emplace_back(new Object2D{&scene});
+        objects.back()->translate({Float(i)*1.5f, Float(i % 3)*0.1f});
+        spheres.push_back(new Shape<Shapes::Sphere2D>{*objects.back(), {{}, 1.0f}, &shapes});
+    }
+
+    /* The first colliding one in the group order is returned */
+    CORRADE_VERIFY(shapes.firstCollision(*spheres[0]) == spheres[1]);
+    CORRADE_VERIFY(shapes.firstCollision(*spheres[25]) == spheres[24]);
+    CORRADE_VERIFY(shapes.firstCollision(*spheres[49]) == spheres[48]);
+
+    /* Point not in the group */
+    Object2D c{&scene};
+    Shape<Shapes::Point2D> point{c, {{30.7f, 0.05f}}};
+    c.setClean();
+    CORRADE_VERIFY(shapes.firstCollision(point) == spheres[20]);
+
+    /* Move the first sphere to the other end, the order gets updated */
+    objects[0]->translate(Vector2::xAxis(75.0f));
+    CORRADE_VERIFY(shapes.isDirty());
+    CORRADE_VERIFY(shapes.firstCollision(*spheres[0]) == spheres[49]);
+    CORRADE_VERIFY(shapes.firstCollision(*spheres[1]) == spheres[2]);
+
+    /* Large sphere covering everything */
+    Object2D d{&scene};
+    Shape<Shapes::Sphere2D> large{d, {{37.0f, 0.0f}, 100.0f}};
+    d.setClean();
+    CORRADE_VERIFY(shapes.firstCollision(large) == spheres[0]);
+}
+
+void ShapeTest::collidingPairs() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a{&scene}, b{&scene}, c{&scene}, d{&scene};
+    Shape<Shapes::Sphere2D> aShape{a, {{}, 1.0f}, &shapes};
+    Shape<Shapes::Point2D> bShape{b, {{0.5f, 0.5f}}, &shapes};
+    Shape<Shapes::Sphere2D> cShape{c, {{3.0f, 0.0f}, 1.0f}, &shapes};
+    Shape<Shapes::Sphere2D> dShape{d, {{1.5f, 0.0f}, 0.75f}, &shapes};
+
+    /* Bounds of the rotated box overlap with the sphere, but the narrow
+       phase doesn't report a collision */
+    Object2D e{&scene};
+    Shape<Shapes::Box2D> eShape{e, {Matrix3::translation({4.6f, 1.6f})*Matrix3::rotation(Deg(45.0f))}, &shapes};
+
+    typedef std::pair<AbstractShape2D*, AbstractShape2D*> Pair;
+    CORRADE_COMPARE(shapes.collidingPairs(), (std::vector<Pair>{
+        {&aShape, &bShape},
+        {&aShape, &dShape},
+        {&cShape, &dShape}}));
+    CORRADE_VERIFY(!shapes.isDirty());
+
+    /* Move the point out of the sphere and the sphere away, under the box */
+    b.translate(Vector2::yAxis(5.0f));
+    c.translate(Vector2::xAxis(1.0f));
+    CORRADE_COMPARE(shapes.collidingPairs(), (std::vector<Pair>{
+        {&aShape, &dShape},
+        {&cShape, &eShape}}));
+}
+
+void ShapeTest::collidingPairsUnbounded() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a{&scene}, b{&scene}, c{&scene}, d{&scene};
+    Shape<Shapes::Sphere3D> aShape{a, {{0.0f, 0.0f, 0.0f}, 1.0f}, &shapes};
+    Shape<Shapes::Line3D> bShape{b, {{-1.0f, 0.5f, 0.0f}, {1.0f, 0.5f, 0.0f}}, &shapes};
+    Shape<Shapes::Sphere3D> cShape{c, {{100.0f, 0.5f, 0.0f}, 1.0f}, &shapes};
+    Shape<Shapes::Sphere3D> dShape{d, {{50.0f, 50.0f, 0.0f}, 1.0f}, &shapes};
+
+    /* The infinite line collides with spheres far away */
+    typedef std::pair<AbstractShape3D*, AbstractShape3D*> Pair;
+    CORRADE_COMPARE(shapes.collidingPairs(), (std::vector<Pair>{
+        {&aShape, &bShape},
+        {&bShape, &cShape}}));
+
+    /* Line used as a query */
+    CORRADE_VERIFY(shapes.firstCollision(bShape) == &aShape);
+    CORRADE_VERIFY(shapes.firstCollision(cShape) == &bShape);
+    CORRADE_VERIFY(!shapes.firstCollision(dShape));
+}
+
+void ShapeTest::collidingPairsUnboundedNotImplemented() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    Shape<Shapes::Plane> aShape{a, {{}, Vector3::yAxis()}, &shapes};
+    Shape<Shapes::Point3D> bShape{b, {{0.0f, -1.0f, 0.0f}}, &shapes};
+    Shape<Shapes::Line3D> cShape{c, {{0.0f, -5.0f, 0.0f}, {1.0f, 5.0f, 0.0f}}, &shapes};
+
+    /* The unbounded plane is tested against everything, collision with a
+       point is not implemented and thus reported as not colliding */
+    typedef std::pair<AbstractShape3D*, AbstractShape3D*> Pair;
+    CORRADE_COMPARE(shapes.collidingPairs(), (std::vector<Pair>{
+        {&aShape, &cShape}}));
+
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == &cShape);
+    CORRADE_VERIFY(!shapes.firstCollision(bShape));
+}
+
+void ShapeTest::groupMembership() {
+    Scene2D scene;
+    ShapeGroup2D shapes, other;
+
+    Object2D a{&scene}, b{&scene}, c{&scene};
+    Shape<Shapes::Sphere2D> aShape{a, {{}, 1.0f}, &shapes};
+    Shape<Shapes::Point2D> bShape{b, {{2.0f, 0.0f}}, &shapes};
+    CORRADE_VERIFY(!shapes.firstCollision(aShape));
+
+    /* Added shape is taken into account even though nothing moved */
+    {
+        Shape<Shapes::Point2D> cShape{c, {{0.5f, 0.0f}}, &shapes};
+        CORRADE_VERIFY(shapes.firstCollision(aShape) == &cShape);
+    }
+
+    /* Destroyed shape is not */
+    CORRADE_VERIFY(!shapes.firstCollision(aShape));
+
+    /* Moving the shape into the sphere to the other group and back */
+    b.translate(Vector2::xAxis(-1.5f));
+    other.add(bShape);
+    CORRADE_VERIFY(!shapes.firstCollision(aShape));
+    CORRADE_VERIFY(other.firstCollision(aShape) == &bShape);
+    CORRADE_VERIFY(&shapes.add(bShape) == &shapes);
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == &bShape);
+    CORRADE_VERIFY(!other.firstCollision(aShape));
+
+    CORRADE_VERIFY(&shapes.remove(bShape) == &shapes);
+    CORRADE_VERIFY(!shapes.firstCollision(aShape));
+}
+
 void ShapeTest::shapeGroup() {
     Scene2D scene;
     ShapeGroup2D shapes;
@@ -26,6 +26,9 @@
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
 #include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Sphere.h"
@@ -44,6 +47,10 @@ struct SphereTest: TestSuite::Tester {
     void collisionLineSegment();
     void collisionSphere();
     void collisionSphereInverted();
+    void collisionLineSegmentInverted();
+    void collisionCapsuleInverted();
+    void collisionAxisAlignedBoxInverted();
+    void collisionBoxInverted();
 };
 
 SphereTest::SphereTest() {
@@ -53,7 +60,11 @@ SphereTest::SphereTest() {
               &SphereTest::collisionLine,
               &SphereTest::collisionLineSegment,
               &SphereTest::collisionSphere,
-              &SphereTest::collisionSphereInverted});
+              &SphereTest::collisionSphereInverted,
+              &SphereTest::collisionLineSegmentInverted,
+              &SphereTest::collisionCapsuleInverted,
+              &SphereTest::collisionAxisAlignedBoxInverted,
+              &SphereTest::collisionBoxInverted});
 }
 
 void SphereTest::transformed() {
@@ -116,6 +127,20 @@ void SphereTest::collisionLine() {
 
     VERIFY_COLLIDES(sphere, line);
     VERIFY_NOT_COLLIDES(sphere, line2);
+
+    /* Collision position is the point on the line closest to the center */
+    const Shapes::Line3D line3({-1.0f, 3.0f, 3.0f}, {3.0f, 3.0f, 3.0f});
+    const Shapes::Collision3D collision = sphere/line3;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(1.0f, 3.0f, 3.0f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::yAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 1.0f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(line3/sphere).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(sphere/line2));
 }
 
 void SphereTest::collisionLineSegment() {
@@ -125,6 +150,20 @@ void SphereTest::collisionLineSegment() {
 
     VERIFY_COLLIDES(sphere, line);
     VERIFY_NOT_COLLIDES(sphere, line2);
+
+    /* Collision position is the segment endpoint nearest to the center */
+    const Shapes::LineSegment3D line3({1.0f, 2.0f, 4.5f}, {1.0f, 2.0f, 7.0f});
+    const Shapes::Collision3D collision = sphere/line3;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(1.0f, 2.0f, 4.5f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::zAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(line3/sphere).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(sphere/line2));
 }
 
 void SphereTest::collisionSphere() {
@@ -172,6 +211,92 @@ void SphereTest::collisionSphereInverted() {
     CORRADE_VERIFY(!(sphere%sphere3) && !(sphere/sphere3));
 }
 
+void SphereTest::collisionLineSegmentInverted() {
+    Shapes::InvertedSphere3D sphere({}, 5.0f);
+    Shapes::LineSegment3D segment({}, {6.0f, 0.0f, 0.0f});
+    Shapes::LineSegment3D segment2({}, {4.0f, 0.0f, 0.0f});
+
+    VERIFY_COLLIDES(sphere, segment);
+    VERIFY_NOT_COLLIDES(sphere, segment2);
+
+    /* Collision, contact position is on the end outside of the sphere */
+    const Shapes::Collision3D collision = sphere/segment;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(6.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 1.0f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(segment/sphere).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(sphere/segment2));
+}
+
+void SphereTest::collisionCapsuleInverted() {
+    Shapes::InvertedSphere3D sphere({}, 5.0f);
+    Shapes::Capsule3D capsule({}, {4.0f, 0.0f, 0.0f}, 1.5f);
+    Shapes::Capsule3D capsule2({}, {4.0f, 0.0f, 0.0f}, 0.5f);
+
+    VERIFY_COLLIDES(sphere, capsule);
+    VERIFY_NOT_COLLIDES(sphere, capsule2);
+
+    /* Collision */
+    const Shapes::Collision3D collision = sphere/capsule;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector3(5.5f, 0.0f, 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(capsule/sphere).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(sphere/capsule2));
+}
+
+void SphereTest::collisionAxisAlignedBoxInverted() {
+    Shapes::InvertedSphere2D sphere({}, 5.0f);
+    Shapes::AxisAlignedBox2D box({-1.0f, -1.0f}, {3.6f, 4.8f});
+    Shapes::AxisAlignedBox2D box2({-1.0f, -1.0f}, {3.0f, 3.0f});
+
+    VERIFY_COLLIDES(sphere, box);
+    VERIFY_NOT_COLLIDES(sphere, box2);
+
+    /* Collision, contact position is on the furthest vertex */
+    const Shapes::Collision2D collision = sphere/box;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector2(3.6f, 4.8f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector2(0.6f, 0.8f));
+    CORRADE_COMPARE(collision.separationDistance(), 1.0f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(box/sphere).separationNormal());
+
+    /* No collision */
+    CORRADE_VERIFY(!(sphere/box2));
+}
+
+void SphereTest::collisionBoxInverted() {
+    /* Unit box rotated by 45 degrees, the furthest vertex is at
+       {2 + sqrt(2), 0} */
+    Shapes::InvertedSphere2D sphere({}, 3.0f);
+    Shapes::Box2D box(Matrix3::translation({2.0f, 0.0f})*Matrix3::rotation(Deg(45.0f)));
+
+    VERIFY_COLLIDES(sphere, box);
+    VERIFY_NOT_COLLIDES(Shapes::InvertedSphere2D({}, 4.0f), box);
+
+    /* Collision */
+    const Shapes::Collision2D collision = sphere/box;
+    CORRADE_VERIFY(collision);
+    CORRADE_COMPARE(collision.position(), Vector2(2.0f + Constants::sqrt2(), 0.0f));
+    CORRADE_COMPARE(collision.separationNormal(), Vector2::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), Constants::sqrt2() - 1.0f);
+
+    /* Collision, flipped */
+    CORRADE_COMPARE(collision.separationNormal(), -(box/sphere).separationNormal());
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::SphereTest)
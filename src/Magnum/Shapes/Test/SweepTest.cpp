@@ -0,0 +1,203 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Plane.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/Sweep.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct SweepTest: TestSuite::Tester {
+    explicit SweepTest();
+
+    void sphereSphere();
+    void sphereCapsule();
+    void sphereCapsuleCap();
+    void sphereAxisAlignedBox();
+    void sphereAxisAlignedBoxEdge();
+    void sphereAxisAlignedBoxCorner2D();
+    void sphereBox();
+    void sphereBox2D();
+    void spherePlane();
+    void capsulePlane();
+};
+
+SweepTest::SweepTest() {
+    addTests({&SweepTest::sphereSphere,
+              &SweepTest::sphereCapsule,
+              &SweepTest::sphereCapsuleCap,
+              &SweepTest::sphereAxisAlignedBox,
+              &SweepTest::sphereAxisAlignedBoxEdge,
+              &SweepTest::sphereAxisAlignedBoxCorner2D,
+              &SweepTest::sphereBox,
+              &SweepTest::sphereBox2D,
+              &SweepTest::spherePlane,
+              &SweepTest::capsulePlane});
+}
+
+void SweepTest::sphereSphere() {
+    const Shapes::Sphere3D sphere({}, 1.0f);
+    const Shapes::Sphere3D other({5.0f, 0.0f, 0.0f}, 1.0f);
+
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {10.0f, 0.0f, 0.0f}, other), 0.3f);
+
+    /* Passing by, not getting there, moving away */
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {10.0f, 6.0f, 0.0f}, other), Constants::inf());
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {2.0f, 0.0f, 0.0f}, other), Constants::inf());
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {-10.0f, 0.0f, 0.0f}, other), Constants::inf());
+
+    /* Already colliding */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{4.0f, 0.0f, 0.0f}, 1.5f}, {-10.0f, 0.0f, 0.0f}, other), 0.0f);
+}
+
+void SweepTest::sphereCapsule() {
+    /* Thin capsule, the sphere would tunnel through it */
+    const Shapes::Capsule3D capsule({5.0f, -1.0f, 0.0f}, {5.0f, 1.0f, 0.0f}, 0.1f);
+    const Shapes::Sphere3D sphere({}, 0.4f);
+    CORRADE_VERIFY(!(sphere % capsule));
+    CORRADE_VERIFY(!(Shapes::Sphere3D{{10.0f, 0.0f, 0.0f}, 0.4f} % capsule));
+
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {10.0f, 0.0f, 0.0f}, capsule), 0.45f);
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {10.0f, 6.0f, 0.0f}, capsule), Constants::inf());
+
+    /* Already colliding */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{5.0f, 0.0f, 0.0f}, 0.4f}, {10.0f, 0.0f, 0.0f}, capsule), 0.0f);
+}
+
+void SweepTest::sphereCapsuleCap() {
+    const Shapes::Capsule3D capsule({5.0f, -1.0f, 0.0f}, {5.0f, 1.0f, 0.0f}, 0.5f);
+
+    /* Moving along the axis, hitting the cap */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{5.0f, 5.0f, 0.0f}, 0.5f}, {0.0f, -10.0f, 0.0f}, capsule), 0.3f);
+
+    /* Starting inside the infinite cylinder but beyond the cap */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{5.2f, 5.0f, 0.0f}, 0.5f}, {0.0f, -10.0f, 0.0f}, capsule), 0.30202f);
+}
+
+void SweepTest::sphereAxisAlignedBox() {
+    /* Thin box, the sphere would tunnel through it */
+    const Shapes::AxisAlignedBox3D box({-0.05f, -1.0f, -1.0f}, {0.05f, 1.0f, 1.0f});
+    const Shapes::Sphere3D sphere({-5.0f, 0.0f, 0.0f}, 0.45f);
+    CORRADE_VERIFY(!(box % sphere));
+    CORRADE_VERIFY(!(box % Shapes::Sphere3D{{5.0f, 0.0f, 0.0f}, 0.45f}));
+
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {10.0f, 0.0f, 0.0f}, box), 0.45f);
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {-10.0f, 0.0f, 0.0f}, box), Constants::inf());
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {10.0f, 5.0f, 0.0f}, box), Constants::inf());
+
+    /* Not moving in one axis and outside of the slab */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{-5.0f, 3.0f, 0.0f}, 0.45f}, {10.0f, 0.0f, 0.0f}, box), Constants::inf());
+
+    /* Already colliding */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{0.0f, 0.0f, 0.0f}, 0.45f}, {10.0f, 0.0f, 0.0f}, box), 0.0f);
+}
+
+void SweepTest::sphereAxisAlignedBoxEdge() {
+    const Shapes::AxisAlignedBox3D box({-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f});
+
+    /* Diagonal movement towards the edge */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{-5.0f, -5.0f, 0.0f}, 1.0f}, {10.0f, 10.0f, 0.0f}, box), 0.4f - 0.1f/Constants::sqrt2());
+
+    /* Touching the rounded edge */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{-5.0f, -1.8f, 0.0f}, 1.0f}, {10.0f, 0.0f, 0.0f}, box), 0.34f);
+
+    /* In the corner region of the expanded box, but missing the rounded
+       corner */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{-5.0f, -1.8f, -1.8f}, 1.0f}, {10.0f, 0.0f, 0.0f}, box), Constants::inf());
+
+    /* Hitting the rounded corner */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{-5.0f, -1.5f, -1.5f}, 1.0f}, {10.0f, 0.0f, 0.0f}, box), 0.4f - 0.1f/Constants::sqrt2());
+}
+
+void SweepTest::sphereAxisAlignedBoxCorner2D() {
+    const Shapes::AxisAlignedBox2D box({-1.0f, -1.0f}, {1.0f, 1.0f});
+
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere2D{{-5.0f, -1.8f}, 1.0f}, {10.0f, 0.0f}, box), 0.34f);
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere2D{{-5.0f, -2.1f}, 1.0f}, {10.0f, 0.0f}, box), Constants::inf());
+}
+
+void SweepTest::sphereBox() {
+    /* Thin box rotated so its thin side is along Y, spanning from 4.95 to
+       5.05 on Y */
+    const Shapes::Box3D box(Matrix4::translation({0.0f, 5.0f, 0.0f})*Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling({0.05f, 1.0f, 1.0f}));
+    const Shapes::Sphere3D sphere({}, 0.45f);
+    CORRADE_VERIFY(!(box % sphere));
+    CORRADE_VERIFY(!(box % Shapes::Sphere3D{{0.0f, 10.0f, 0.0f}, 0.45f}));
+
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {0.0f, 10.0f, 0.0f}, box), 0.45f);
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {0.0f, -10.0f, 0.0f}, box), Constants::inf());
+    CORRADE_COMPARE(Shapes::timeOfImpact(sphere, {5.0f, 10.0f, 0.0f}, box), Constants::inf());
+
+    /* Already colliding */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{0.0f, 5.0f, 0.0f}, 0.45f}, {10.0f, 0.0f, 0.0f}, box), 0.0f);
+}
+
+void SweepTest::sphereBox2D() {
+    /* Unit box rotated by 45 degrees, vertices are at distance sqrt(2) from
+       the center, so the sphere hits the vertex */
+    const Shapes::Box2D box(Matrix3::rotation(Deg(45.0f)));
+
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere2D{{-5.0f, 0.0f}, 1.0f}, {10.0f, 0.0f}, box), 0.4f - 0.1f*Constants::sqrt2());
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere2D{{-5.0f, 2.5f}, 1.0f}, {10.0f, 0.0f}, box), Constants::inf());
+}
+
+void SweepTest::spherePlane() {
+    const Shapes::Plane plane({}, Vector3::yAxis());
+
+    /* Fast movement through the plane, from both sides */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{0.0f, 5.0f, 0.0f}, 1.0f}, {0.0f, -100.0f, 0.0f}, plane), 0.04f);
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{0.0f, -5.0f, 0.0f}, 1.0f}, {3.0f, 10.0f, 0.0f}, plane), 0.4f);
+
+    /* Parallel, moving away, not getting there */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{0.0f, 5.0f, 0.0f}, 1.0f}, {10.0f, 0.0f, 0.0f}, plane), Constants::inf());
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{0.0f, 5.0f, 0.0f}, 1.0f}, {0.0f, 10.0f, 0.0f}, plane), Constants::inf());
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{0.0f, 5.0f, 0.0f}, 1.0f}, {0.0f, -2.0f, 0.0f}, plane), Constants::inf());
+
+    /* Already colliding */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Sphere3D{{0.0f, 0.5f, 0.0f}, 1.0f}, {0.0f, 10.0f, 0.0f}, plane), 0.0f);
+}
+
+void SweepTest::capsulePlane() {
+    const Shapes::Plane plane({}, Vector3::yAxis());
+
+    /* The nearer endpoint touches first */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Capsule3D{{0.0f, 5.0f, 0.0f}, {1.0f, 3.0f, 0.0f}, 0.5f}, {0.0f, -10.0f, 0.0f}, plane), 0.25f);
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Capsule3D{{0.0f, 5.0f, 0.0f}, {1.0f, 3.0f, 0.0f}, 0.5f}, {0.0f, 10.0f, 0.0f}, plane), Constants::inf());
+
+    /* Crossing the plane already */
+    CORRADE_COMPARE(Shapes::timeOfImpact(Shapes::Capsule3D{{0.0f, 5.0f, 0.0f}, {0.0f, -3.0f, 0.0f}, 0.5f}, {0.0f, 10.0f, 0.0f}, plane), 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::SweepTest)
@@ -39,7 +39,8 @@ namespace Magnum { namespace Shapes { namespace Implementation {
     Adding new collision type:
 
     1.  Add the type into the 2D/3D enums below, pick new prime number and
-        preserve complexity ordering
+        preserve complexity ordering, update TypeIndex and TypeCount in
+        Implementation/CollisionDispatch.cpp
     2.  Update debug output operators for changed enums
     3.  Add TypeOf struct specialization (either for both 2D/3D or for only one
         of them)
@@ -48,8 +49,10 @@ namespace Magnum { namespace Shapes { namespace Implementation {
 
     Adding new collision detection implementation:
 
-    1.  Update Implementation/CollisionDispatch.cpp with newly implemented
-        2D/3D pair
+    1.  Add the newly implemented 2D/3D pair into DispatchTable in
+        Implementation/CollisionDispatch.cpp, either with add() if both
+        operator% and operator/ are implemented or with addCollides() if only
+        operator% is
 */
 
 /* Shape type for given dimension count */
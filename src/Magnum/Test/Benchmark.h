@@ -0,0 +1,51 @@
+#ifndef Magnum_Test_Benchmark_h
+#define Magnum_Test_Benchmark_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <string>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Test {
+
+/* Runs given function once and prints its wall clock duration, in
+   milliseconds or, if itemCount is nonzero, in nanoseconds per item. Used by
+   benchmarks, which are built only if BUILD_BENCHMARKS is enabled and are not
+   meant to be run as part of the regular test suite. */
+template<class F> void benchmark(const std::string& name, F f, const std::size_t itemCount = 0) {
+    const auto begin = std::chrono::high_resolution_clock::now();
+    f();
+    const std::chrono::duration<double, std::nano> duration = std::chrono::high_resolution_clock::now() - begin;
+
+    if(itemCount) Debug() << "   " << name << Float(duration.count()/itemCount) << "ns per item";
+    else Debug() << "   " << name << Float(duration.count()/1000000.0) << "ms";
+}
+
+}}
+
+#endif
@@ -124,7 +124,18 @@ void AbstractFont::fillGlyphCache(GlyphCache& cache, const std::string& characte
     CORRADE_ASSERT(!(features() & Feature::PreparedGlyphCache),
         "Text::AbstractFont::fillGlyphCache(): feature not supported", );
 
-    doFillGlyphCache(cache, Utility::Unicode::utf32(characters));
+    /* Skip characters whose glyphs are already in the cache, including the
+       ones that map to the always present "Not Found" glyph, and mark them
+       as used so they aren't evicted when adding the rest */
+    std::u32string missing;
+    for(const char32_t c: Utility::Unicode::utf32(characters)) {
+        const UnsignedInt glyph = doGlyphId(c);
+        if(cache.contains(glyph)) cache.use(glyph);
+        else missing += c;
+    }
+    if(missing.empty()) return;
+
+    doFillGlyphCache(cache, missing);
 }
 
 void AbstractFont::doFillGlyphCache(GlyphCache&, const std::u32string&) {
@@ -151,6 +162,28 @@ std::unique_ptr<AbstractLayouter> AbstractFont::layout(const GlyphCache& cache,
     return doLayout(cache, size, text);
 }
 
+UnsignedInt AbstractFont::layout(const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::ArrayView<GlyphQuad> glyphs) {
+    CORRADE_ASSERT(isOpened(), "Text::AbstractFont::layout(): no font opened", 0);
+
+    return doLayoutInto(cache, size, text, glyphs);
+}
+
+UnsignedInt AbstractFont::doLayoutInto(const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::ArrayView<GlyphQuad> glyphs) {
+    const std::unique_ptr<AbstractLayouter> layouter = doLayout(cache, size, text.empty() ? std::string{} : std::string{text.data(), text.size()});
+
+    /* Render each glyph with cursor at origin to get its relative position
+       and advance */
+    const UnsignedInt glyphCount = layouter->glyphCount();
+    for(UnsignedInt i = 0; i < glyphCount && i < glyphs.size(); ++i) {
+        Vector2 cursorPosition;
+        Range2D rectangle;
+        std::tie(glyphs[i].position, glyphs[i].textureCoordinates) = layouter->renderGlyph(i, cursorPosition, rectangle);
+        glyphs[i].advance = cursorPosition;
+    }
+
+    return glyphCount;
+}
+
 AbstractLayouter::AbstractLayouter(UnsignedInt glyphCount): _glyphCount(glyphCount) {}
 
 AbstractLayouter::~AbstractLayouter() {}
@@ -26,21 +26,39 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Text::AbstractFont, @ref Magnum::Text::AbstractLayouter
+ * @brief Class @ref Magnum::Text::AbstractFont, @ref Magnum::Text::AbstractLayouter, struct @ref Magnum::Text::GlyphQuad
  */
 
 #include <memory>
 #include <string>
 #include <tuple>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/PluginManager/AbstractPlugin.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Texture.h"
 #include "Magnum/Text/Text.h"
 #include "Magnum/Text/visibility.h"
 
 namespace Magnum { namespace Text {
 
+/**
+@brief Laid out glyph
+
+Output of @ref AbstractFont::layout(const GlyphCache&, Float, Containers::ArrayView<const char>, Containers::ArrayView<GlyphQuad>).
+*/
+struct GlyphQuad {
+    /** @brief Quad position relative to cursor position */
+    Range2D position;
+
+    /** @brief Texture coordinates */
+    Range2D textureCoordinates;
+
+    /** @brief Advance to next glyph */
+    Vector2 advance;
+};
+
 /**
 @brief Base for font plugins
 
@@ -197,7 +215,10 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          * @param cache         Glyph cache instance
          * @param characters    UTF-8 characters to render
          *
-         * Fills the cache with given characters. Fonts having
+         * Fills the cache with given characters. Can be called repeatedly on
+         * the same cache, characters whose glyphs are already in the cache
+         * are skipped and marked as used using @ref GlyphCache::use(), see
+         * @ref GlyphCache::reserve() for details. Fonts having
          * @ref Feature::PreparedGlyphCache do not support partial glyph cache
          * filling, use @ref createGlyphCache() instead.
          */
@@ -225,6 +246,21 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          */
         std::unique_ptr<AbstractLayouter> layout(const GlyphCache& cache, Float size, const std::string& text);
 
+        /**
+         * @brief Layout the text into preallocated memory
+         * @param cache     Glyph cache
+         * @param size      Font size
+         * @param text      Text to layout
+         * @param glyphs    Where to put the laid out glyphs
+         *
+         * Alternative to @ref layout(const GlyphCache&, Float, const std::string&)
+         * which doesn't allocate if the font implements it. Returns count of
+         * glyphs in laid out text. If it's larger than size of @p glyphs,
+         * only the first `glyphs.size()` glyphs are written. Similarly to
+         * the other overload, only single-line text is supported.
+         */
+        UnsignedInt layout(const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::ArrayView<GlyphQuad> glyphs);
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     protected:
     #else
@@ -276,7 +312,11 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          * @brief Implementation for @ref fillGlyphCache()
          *
          * The string is converted from UTF-8 to UTF-32, unique characters are
-         * *not* removed.
+         * *not* removed. Characters whose glyphs are already in the cache
+         * are removed and the function is not called at all if no
+         * characters are left. The implementation should upload only images
+         * of the newly reserved glyphs using @ref GlyphCache::setImage() in
+         * order to not overwrite the existing ones.
          */
         virtual void doFillGlyphCache(GlyphCache& cache, const std::u32string& characters);
 
@@ -286,6 +326,15 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
         /** @brief Implementation for @ref layout() */
         virtual std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache& cache, Float size, const std::string& text) = 0;
 
+        /**
+         * @brief Implementation for @ref layout(const GlyphCache&, Float, Containers::ArrayView<const char>, Containers::ArrayView<GlyphQuad>)
+         *
+         * Default implementation copies the text into a string, calls
+         * @ref doLayout() and renders all glyphs from returned layouter.
+         * Reimplement it to have allocation-free layout.
+         */
+        virtual UnsignedInt doLayoutInto(const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::ArrayView<GlyphQuad> glyphs);
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #endif
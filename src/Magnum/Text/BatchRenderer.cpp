@@ -0,0 +1,117 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "BatchRenderer.h"
+
+#include <algorithm>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/AbstractVector.h"
+#include "Magnum/Text/Renderer.h"
+#include "Magnum/Text/Implementation/renderIndices.h"
+
+namespace Magnum { namespace Text {
+
+template<UnsignedInt dimensions> Batch<dimensions>::Batch(AbstractFont& font, const GlyphCache& cache): _font(font), _cache(cache) {}
+
+template<UnsignedInt dimensions> std::pair<UnsignedInt, UnsignedInt> Batch<dimensions>::labelGlyphs(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _labels.size(),
+        "Text::Batch::labelGlyphs(): index" << id << "out of range for" << _labels.size() << "labels", {});
+    return {_labels[id].glyphOffset, _labels[id].glyphCount};
+}
+
+template<UnsignedInt dimensions> Range2D Batch<dimensions>::labelRectangle(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _labels.size(),
+        "Text::Batch::labelRectangle(): index" << id << "out of range for" << _labels.size() << "labels", {});
+    return _labels[id].rectangle;
+}
+
+template<UnsignedInt dimensions> UnsignedInt Batch<dimensions>::add(const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Float size, const Alignment alignment) {
+    /* Make the scratch memory large enough as when the text would be
+       ASCII-only, it grows only when a longer text than before comes */
+    if(_glyphs.size() < text.size()) {
+        _glyphs.resize(text.size());
+        _positions.resize(text.size()*4);
+        _textureCoordinates.resize(text.size()*4);
+    }
+
+    /* Layout the text in label's own coordinate system */
+    UnsignedInt glyphCount;
+    Range2D rectangle;
+    std::tie(glyphCount, rectangle) = AbstractRenderer::render(_font, _cache, size, {text.data(), text.size()},
+        {_glyphs.data(), _glyphs.size()},
+        {_positions.data(), _positions.size()},
+        {_textureCoordinates.data(), _textureCoordinates.size()}, alignment);
+
+    /* Transform the vertices and append them to the batch */
+    const UnsignedInt glyphOffset = _vertices.size()/4;
+    _vertices.reserve(_vertices.size() + glyphCount*4);
+    for(std::size_t i = 0; i != glyphCount*4; ++i)
+        _vertices.push_back({transformation.transformPoint(VectorTypeFor<dimensions, Float>::pad(_positions[i])), _textureCoordinates[i]});
+
+    _labels.push_back({glyphOffset, glyphCount, rectangle});
+    return _labels.size() - 1;
+}
+
+template<UnsignedInt dimensions> void Batch<dimensions>::clear() {
+    _labels.clear();
+    _vertices.clear();
+}
+
+template<UnsignedInt dimensions> BatchRenderer<dimensions>::BatchRenderer(): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, _capacity{0} {
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(0)
+        .addVertexBuffer(_vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position(),
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates());
+}
+
+template<UnsignedInt dimensions> void BatchRenderer<dimensions>::update(const Batch<dimensions>& batch, const BufferUsage usage) {
+    const UnsignedInt glyphCount = batch.glyphCount();
+
+    /* Index buffer depends only on glyph count, regenerate it only if it's
+       not large enough. Grow geometrically to avoid doing this too often. */
+    if(glyphCount > _capacity) {
+        _capacity = std::max(glyphCount, _capacity*2);
+
+        Containers::Array<char> indices;
+        Mesh::IndexType indexType;
+        std::tie(indices, indexType) = Implementation::renderIndices(_capacity);
+        _indexBuffer.setData(indices, BufferUsage::StaticDraw);
+        _mesh.setIndexBuffer(_indexBuffer, 0, indexType, 0, _capacity*4);
+    }
+
+    _vertexBuffer.setData(batch.vertices(), usage);
+    _mesh.setCount(glyphCount*6);
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_TEXT_EXPORT Batch<2>;
+template class MAGNUM_TEXT_EXPORT Batch<3>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<2>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<3>;
+#endif
+
+}}
@@ -0,0 +1,232 @@
+#ifndef Magnum_Text_Renderer_h
+#define Magnum_Text_Renderer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#ifndef Magnum_Text_BatchRenderer_h
+#define Magnum_Text_BatchRenderer_h
+
+/** @file
+ * @brief Class @ref Magnum::Text::Batch, @ref Magnum::Text::BatchRenderer, typedef @ref Magnum::Text::Batch2D, @ref Magnum::Text::Batch3D, @ref Magnum::Text::BatchRenderer2D, @ref Magnum::Text::BatchRenderer3D
+ */
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/Alignment.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Batch of text labels
+
+Lays out many strings, each with its own transformation, size and alignment,
+into one shared vertex array, so all of them can be drawn with a single draw
+call using @ref BatchRenderer. This class doesn't need any OpenGL
+functionality, the vertex data can be used directly.
+
+## Usage
+
+@code
+Text::Batch2D batch{*font, cache};
+for(const Label& label: labels)
+    batch.add(label.text, Matrix3::translation(label.position), 0.1f, Alignment::MiddleCenter);
+
+Text::BatchRenderer2D renderer;
+renderer.update(batch);
+
+shader.setVectorTexture(cache.texture());
+renderer.mesh().draw(shader);
+@endcode
+
+Glyphs of each label occupy a contiguous range, see @ref labelGlyphs(). Each
+glyph is a quad of four vertices, indexed the same way as in @ref Renderer,
+thus glyph range of a label directly maps to range of index buffer in
+@ref BatchRenderer.
+@see @ref Batch2D, @ref Batch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT Batch {
+    public:
+        /** @brief Vertex */
+        struct Vertex {
+            /** @brief Transformed vertex position */
+            VectorTypeFor<dimensions, Float> position;
+
+            /** @brief Texture coordinates */
+            Vector2 textureCoordinates;
+        };
+
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         */
+        explicit Batch(AbstractFont& font, const GlyphCache& cache);
+        Batch(AbstractFont&, GlyphCache&&) = delete; /**< @overload */
+
+        /** @brief Font */
+        AbstractFont& font() const { return _font; }
+
+        /** @brief Glyph cache */
+        const GlyphCache& cache() const { return _cache; }
+
+        /** @brief Count of labels in the batch */
+        UnsignedInt labelCount() const { return _labels.size(); }
+
+        /** @brief Count of glyphs in the batch */
+        UnsignedInt glyphCount() const { return _vertices.size()/4; }
+
+        /**
+         * @brief Vertex data
+         *
+         * Four vertices for each glyph, ordered the same way as in
+         * @ref AbstractRenderer::render(). Positions are transformed with
+         * the transformation of their label.
+         */
+        const std::vector<Vertex>& vertices() const { return _vertices; }
+
+        /**
+         * @brief Glyph range of given label
+         *
+         * Returns offset of first glyph of the label and count of its glyphs.
+         * Multiply by `4` to get vertex range, by `6` to get index range.
+         */
+        std::pair<UnsignedInt, UnsignedInt> labelGlyphs(UnsignedInt id) const;
+
+        /**
+         * @brief Rectangle spanning given label
+         *
+         * The rectangle is in label's own coordinate system, i.e. without the
+         * transformation applied.
+         */
+        Range2D labelRectangle(UnsignedInt id) const;
+
+        /**
+         * @brief Add a label
+         * @param text              Text to render
+         * @param transformation    Label transformation
+         * @param size              Font size
+         * @param alignment         Text alignment
+         *
+         * Lays out the text, transforms the vertices and appends them to the
+         * batch. Returns ID of the label.
+         */
+        UnsignedInt add(const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, Float size, Alignment alignment = Alignment::LineLeft);
+
+        /**
+         * @brief Clear the batch
+         *
+         * Removes all labels, but keeps the allocated memory.
+         */
+        void clear();
+
+    private:
+        struct Label {
+            UnsignedInt glyphOffset, glyphCount;
+            Range2D rectangle;
+        };
+
+        AbstractFont& _font;
+        const GlyphCache& _cache;
+        std::vector<Label> _labels;
+        std::vector<Vertex> _vertices;
+
+        /* Scratch memory for text layout */
+        std::vector<GlyphQuad> _glyphs;
+        std::vector<Vector2> _positions, _textureCoordinates;
+};
+
+/** @brief Two-dimensional batch of text labels */
+typedef Batch<2> Batch2D;
+
+/** @brief Three-dimensional batch of text labels */
+typedef Batch<3> Batch3D;
+
+/**
+@brief Batch text renderer
+
+Uploads contents of @ref Batch into single vertex and index buffer and
+provides a mesh drawing all labels in one call. The mesh is prepared for use
+with @ref Shaders::AbstractVector subclasses. Index buffer is filled only
+when the glyph count exceeds its capacity, so updating the batch each frame
+costs just the vertex upload.
+@see @ref BatchRenderer2D, @ref BatchRenderer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT BatchRenderer {
+    public:
+        /** @brief Constructor */
+        explicit BatchRenderer();
+
+        /** @brief Copying is not allowed */
+        BatchRenderer(const BatchRenderer<dimensions>&) = delete;
+
+        /** @brief Copying is not allowed */
+        BatchRenderer<dimensions>& operator=(const BatchRenderer<dimensions>&) = delete;
+
+        /**
+         * @brief Capacity for rendered glyphs
+         *
+         * Size of the index buffer, grows on demand in @ref update().
+         */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Vertex buffer */
+        Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Index buffer */
+        Buffer& indexBuffer() { return _indexBuffer; }
+
+        /** @brief Mesh */
+        Mesh& mesh() { return _mesh; }
+
+        /**
+         * @brief Upload batch contents
+         * @param batch     Batch to upload
+         * @param usage     Vertex buffer usage
+         *
+         * Replaces vertex buffer contents with vertices of all labels in the
+         * batch and updates index count of the mesh.
+         */
+        void update(const Batch<dimensions>& batch, BufferUsage usage = BufferUsage::DynamicDraw);
+
+    private:
+        Buffer _vertexBuffer, _indexBuffer;
+        Mesh _mesh;
+        UnsignedInt _capacity;
+};
+
+/** @brief Two-dimensional batch text renderer */
+typedef BatchRenderer<2> BatchRenderer2D;
+
+/** @brief Three-dimensional batch text renderer */
+typedef BatchRenderer<3> BatchRenderer3D;
+
+}}
+
+#endif
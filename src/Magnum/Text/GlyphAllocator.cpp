@@ -0,0 +1,247 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GlyphAllocator.h"
+
+#include <algorithm>
+#include <numeric>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace Text {
+
+namespace {
+    constexpr std::size_t NoSlot = ~std::size_t{};
+}
+
+GlyphAllocator::GlyphAllocator(const Vector2i& size, const Vector2i& padding): _size{size}, _padding{padding}, _shelvesHeight{}, _useCounter{} {}
+
+bool GlyphAllocator::allocate(const Vector2i& paddedSize, Vector2i& position) {
+    /* Find the lowest shelf the glyph fits into, prefer free slots with
+       smallest width, otherwise put it at the end of the shelf */
+    std::size_t best = _shelves.size();
+    std::size_t bestSlot = NoSlot;
+    for(std::size_t i = 0; i != _shelves.size(); ++i) {
+        const Shelf& shelf = _shelves[i];
+        if(shelf.height < paddedSize.y() || (best != _shelves.size() && shelf.height >= _shelves[best].height))
+            continue;
+
+        std::size_t slot = NoSlot;
+        for(std::size_t j = 0; j != shelf.free.size(); ++j)
+            if(shelf.free[j].second >= paddedSize.x() && (slot == NoSlot || shelf.free[j].second < shelf.free[slot].second))
+                slot = j;
+
+        if(slot != NoSlot || shelf.width + paddedSize.x() <= _size.x()) {
+            best = i;
+            bestSlot = slot;
+        }
+    }
+
+    /* If there's no such shelf or the best one is way too tall, try to split
+       an empty shelf or open a new one on top */
+    if(best == _shelves.size() || _shelves[best].height > 2*paddedSize.y()) {
+        std::size_t empty = _shelves.size();
+        for(std::size_t i = 0; i != _shelves.size(); ++i) {
+            if(!_shelves[i].width && _shelves[i].free.empty() && _shelves[i].height >= paddedSize.y()) {
+                empty = i;
+                break;
+            }
+        }
+
+        if(empty != _shelves.size()) {
+            Shelf& shelf = _shelves[empty];
+            if(shelf.height > paddedSize.y()) {
+                const Shelf rest{shelf.y + paddedSize.y(), shelf.height - paddedSize.y(), 0, {}};
+                shelf.height = paddedSize.y();
+                _shelves.insert(_shelves.begin() + empty + 1, rest);
+            }
+
+            best = empty;
+            bestSlot = NoSlot;
+
+        } else if(_shelvesHeight + paddedSize.y() <= _size.y() && paddedSize.x() <= _size.x()) {
+            _shelves.push_back(Shelf{_shelvesHeight, paddedSize.y(), 0, {}});
+            _shelvesHeight += paddedSize.y();
+
+            best = _shelves.size() - 1;
+            bestSlot = NoSlot;
+        }
+    }
+
+    if(best == _shelves.size()) return false;
+
+    Shelf& shelf = _shelves[best];
+    if(bestSlot != NoSlot) {
+        std::pair<Int, Int>& slot = shelf.free[bestSlot];
+        position = {slot.first, shelf.y};
+        slot.first += paddedSize.x();
+        slot.second -= paddedSize.x();
+        if(!slot.second) shelf.free.erase(shelf.free.begin() + bestSlot);
+    } else {
+        position = {shelf.width, shelf.y};
+        shelf.width += paddedSize.x();
+    }
+
+    return true;
+}
+
+void GlyphAllocator::free(const Range2Di& paddedRectangle) {
+    /* Shelves are sorted by their position */
+    auto found = std::lower_bound(_shelves.begin(), _shelves.end(), paddedRectangle.bottom(),
+        [](const Shelf& shelf, Int y) { return shelf.y < y; });
+    CORRADE_INTERNAL_ASSERT(found != _shelves.end() && found->y == paddedRectangle.bottom());
+    std::size_t i = found - _shelves.begin();
+    Shelf& shelf = *found;
+
+    /* Put the range into the free list, merge it with its neighbors */
+    auto slot = std::lower_bound(shelf.free.begin(), shelf.free.end(), std::make_pair(paddedRectangle.left(), 0));
+    slot = shelf.free.insert(slot, {paddedRectangle.left(), paddedRectangle.sizeX()});
+    if(slot + 1 != shelf.free.end() && slot->first + slot->second == (slot + 1)->first) {
+        slot->second += (slot + 1)->second;
+        shelf.free.erase(slot + 1);
+    }
+    if(slot != shelf.free.begin() && (slot - 1)->first + (slot - 1)->second == slot->first) {
+        (slot - 1)->second += slot->second;
+        shelf.free.erase(slot);
+    }
+
+    /* Free range at the end of the shelf just shrinks it */
+    if(!shelf.free.empty() && shelf.free.back().first + shelf.free.back().second == shelf.width) {
+        shelf.width = shelf.free.back().first;
+        shelf.free.pop_back();
+    }
+
+    /* If the shelf is empty, merge it with neighboring empty shelves so the
+       space can be reused for glyphs of different height */
+    const auto isEmpty = [](const Shelf& shelf) {
+        return !shelf.width && shelf.free.empty();
+    };
+    if(!isEmpty(_shelves[i])) return;
+    if(i + 1 != _shelves.size() && isEmpty(_shelves[i + 1])) {
+        _shelves[i].height += _shelves[i + 1].height;
+        _shelves.erase(_shelves.begin() + i + 1);
+    }
+    if(i != 0 && isEmpty(_shelves[i - 1])) {
+        _shelves[i - 1].height += _shelves[i].height;
+        _shelves.erase(_shelves.begin() + i);
+        --i;
+    }
+
+    /* Empty shelf on top gives the space back */
+    if(i + 1 == _shelves.size()) {
+        _shelvesHeight -= _shelves[i].height;
+        _shelves.pop_back();
+    }
+}
+
+std::vector<Range2Di> GlyphAllocator::reserve(const std::vector<Vector2i>& sizes, std::vector<UnsignedInt>& evicted) {
+    /* Tallest glyphs first, so the shelves are populated efficiently */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        return sizes[a].y() > sizes[b].y();
+    });
+
+    /* Glyphs sorted from least recently used, populated only when the first
+       eviction is needed */
+    std::vector<std::pair<std::uint64_t, UnsignedInt>> candidates;
+    std::size_t nextCandidate = 0;
+    bool candidatesPopulated = false;
+
+    std::vector<Range2Di> out(sizes.size());
+    std::vector<std::size_t> allocated;
+    allocated.reserve(sizes.size());
+    for(const std::size_t i: order) {
+        const Vector2i paddedSize = sizes[i] + 2*_padding;
+
+        /* Nothing to allocate */
+        if(!paddedSize.product()) {
+            out[i] = Range2Di::fromSize(_padding, sizes[i]);
+            continue;
+        }
+
+        Vector2i position;
+        bool fits = paddedSize.x() <= _size.x() && paddedSize.y() <= _size.y();
+        while(fits && !allocate(paddedSize, position)) {
+            if(!candidatesPopulated) {
+                candidates.reserve(_glyphs.size());
+                for(const auto& glyph: _glyphs)
+                    candidates.emplace_back(glyph.second.lastUse, glyph.first);
+                std::sort(candidates.begin(), candidates.end());
+                candidatesPopulated = true;
+            }
+
+            /* Nothing left to evict */
+            if(nextCandidate == candidates.size()) {
+                fits = false;
+                break;
+            }
+
+            const UnsignedInt glyph = candidates[nextCandidate++].second;
+            remove(glyph);
+            evicted.push_back(glyph);
+        }
+
+        /* Doesn't fit, give back the space allocated so far */
+        if(!fits) {
+            for(const std::size_t j: allocated) free(out[j].padded(_padding));
+            return {};
+        }
+
+        out[i] = Range2Di::fromSize(position + _padding, sizes[i]);
+        allocated.push_back(i);
+    }
+
+    return out;
+}
+
+void GlyphAllocator::insert(const UnsignedInt glyph, const Range2Di& rectangle) {
+    CORRADE_ASSERT(_glyphs.find(glyph) == _glyphs.end(),
+        "Text::GlyphAllocator::insert(): glyph" << glyph << "is already in the atlas", );
+    _glyphs.emplace(glyph, Glyph{rectangle, ++_useCounter});
+}
+
+void GlyphAllocator::remove(const UnsignedInt glyph) {
+    const auto found = _glyphs.find(glyph);
+    if(found == _glyphs.end()) return;
+
+    const Range2Di paddedRectangle = found->second.rectangle.padded(_padding);
+    if(paddedRectangle.size().product()) free(paddedRectangle);
+    _glyphs.erase(found);
+}
+
+void GlyphAllocator::clear() {
+    _shelves.clear();
+    _shelvesHeight = 0;
+    _glyphs.clear();
+}
+
+UnsignedInt GlyphAllocator::leastRecentlyUsed() const {
+    CORRADE_ASSERT(!_glyphs.empty(), "Text::GlyphAllocator::leastRecentlyUsed(): the atlas is empty", {});
+    return std::min_element(_glyphs.begin(), _glyphs.end(), [](const std::pair<const UnsignedInt, Glyph>& a, const std::pair<const UnsignedInt, Glyph>& b) {
+        return a.second.lastUse < b.second.lastUse;
+    })->first;
+}
+
+}}
@@ -0,0 +1,159 @@
+#ifndef Magnum_Text_GlyphAllocator_h
+#define Magnum_Text_GlyphAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::GlyphAllocator
+ */
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Glyph atlas allocator with least-recently-used eviction
+
+Manages space in a fixed-size glyph atlas, independently of any GPU resources.
+Used by @ref GlyphCache if eviction is enabled using
+@ref GlyphCache::setEvictionEnabled(), but can be used standalone as well.
+
+The atlas is divided into horizontal shelves, each glyph is placed into the
+shelf with the closest height. Space of removed glyphs is kept in per-shelf
+free lists and reused for new glyphs. If there's no space left for a new
+glyph, glyphs that were least recently marked as used with @ref use() are
+evicted until it fits.
+
+Glyph sizes and regions are without padding, padding is accounted for
+internally.
+*/
+class MAGNUM_TEXT_EXPORT GlyphAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around every glyph
+         */
+        explicit GlyphAllocator(const Vector2i& size, const Vector2i& padding = Vector2i());
+
+        /** @brief Atlas size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Glyph padding */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Count of glyphs in the atlas */
+        std::size_t glyphCount() const { return _glyphs.size(); }
+
+        /** @brief Whether given glyph is in the atlas */
+        bool contains(UnsignedInt glyph) const {
+            return _glyphs.find(glyph) != _glyphs.end();
+        }
+
+        /**
+         * @brief Reserve space for glyphs
+         * @param[in] sizes     Glyph sizes
+         * @param[out] evicted  IDs of glyphs that were evicted to make space
+         *
+         * Returns non-overlapping regions in the atlas, in the same order as
+         * @p sizes. If there's not enough free space, least recently used
+         * glyphs are evicted and their IDs are appended to @p evicted. If
+         * the glyphs can't fit even after evicting everything, empty vector
+         * is returned. The glyphs evicted in the process are not restored.
+         *
+         * Use @ref insert() to associate the regions with glyph IDs, space
+         * which is not associated with any glyph stays reserved until
+         * @ref clear() is called.
+         */
+        std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes, std::vector<UnsignedInt>& evicted);
+
+        /**
+         * @brief Associate reserved region with glyph
+         *
+         * The @p rectangle is expected to be one of the regions returned from
+         * @ref reserve() and the @p glyph is expected to not be in the atlas
+         * yet. The glyph is marked as most recently used.
+         */
+        void insert(UnsignedInt glyph, const Range2Di& rectangle);
+
+        /**
+         * @brief Mark glyph as used
+         *
+         * Does nothing if the glyph is not in the atlas.
+         */
+        void use(UnsignedInt glyph) {
+            const auto found = _glyphs.find(glyph);
+            if(found != _glyphs.end()) found->second.lastUse = ++_useCounter;
+        }
+
+        /**
+         * @brief Remove glyph from the atlas
+         *
+         * Its space is made available for new glyphs. Does nothing if the
+         * glyph is not in the atlas.
+         */
+        void remove(UnsignedInt glyph);
+
+        /** @brief Remove all glyphs and reserved space from the atlas */
+        void clear();
+
+        /**
+         * @brief Glyph that would be evicted first
+         *
+         * Expects that there is at least one glyph in the atlas.
+         */
+        UnsignedInt leastRecentlyUsed() const;
+
+    private:
+        struct Glyph {
+            Range2Di rectangle;
+            std::uint64_t lastUse;
+        };
+
+        struct Shelf {
+            Int y, height, width;
+            /* Free ranges as pairs of x offset and width, sorted by offset */
+            std::vector<std::pair<Int, Int>> free;
+        };
+
+        bool MAGNUM_LOCAL allocate(const Vector2i& paddedSize, Vector2i& position);
+        void MAGNUM_LOCAL free(const Range2Di& paddedRectangle);
+
+        Vector2i _size, _padding;
+        Int _shelvesHeight;
+        std::vector<Shelf> _shelves;
+        std::unordered_map<UnsignedInt, Glyph> _glyphs;
+        std::uint64_t _useCounter;
+};
+
+}}
+
+#endif
@@ -29,19 +29,18 @@
 #include "Magnum/Extensions.h"
 #include "Magnum/Image.h"
 #include "Magnum/TextureFormat.h"
-#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
 GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache{internalFormat, size, size, padding} {}
 
-GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _atlas{originalSize, padding} {
     initialize(internalFormat, size);
 }
 
 GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): GlyphCache{size, size, padding} {}
 
-GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _atlas{originalSize, padding} {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
     #endif
@@ -72,24 +71,63 @@ void GlyphCache::initialize(const TextureFormat internalFormat, const Vector2i&
         .setStorage(1, internalFormat, size);
 
     /* Default "Not Found" glyph */
-    glyphs.insert({0, {}});
+    _denseGlyphs.push_back(DenseGlyph{{}, true});
+    _glyphCount = 1;
+}
+
+GlyphCache& GlyphCache::setEvictionEnabled(const bool enabled) {
+    CORRADE_ASSERT(_glyphCount == 1,
+        "Text::GlyphCache::setEvictionEnabled(): the cache is not empty", *this);
+
+    if(enabled) _allocator.reset(new GlyphAllocator{_size, _padding});
+    else _allocator.reset();
+    _evicted.clear();
+    return *this;
 }
 
 std::vector<Range2Di> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT((glyphs.size() == 1 && glyphs.at(0) == std::pair<Vector2i, Range2Di>()),
-        "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
-    glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+    if(sizes.empty()) return {};
+
+    std::vector<Range2Di> out;
+    if(_allocator) {
+        _evicted.clear();
+        out = _allocator->reserve(sizes, _evicted);
+        for(const UnsignedInt glyph: _evicted) erase(glyph);
+    } else out = _atlas.add(sizes);
+
+    if(out.empty())
+        Error() << "Text::GlyphCache::reserve(): cache of size" << _size << "is too small to fit" << sizes.size() << "more glyphs";
+    return out;
 }
 
 void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) {
     const std::pair<Vector2i, Range2Di> glyphData = {position-_padding, rectangle.padded(_padding)};
 
     /* Overwriting "Not Found" glyph */
-    if(glyph == 0) glyphs[0] = glyphData;
+    if(glyph == 0) {
+        _denseGlyphs[0].data = glyphData;
+        return;
+    }
 
     /* Inserting new glyph */
-    else CORRADE_INTERNAL_ASSERT_OUTPUT(glyphs.insert({glyph, glyphData}).second);
+    if(glyph < DenseGlyphLimit) {
+        if(glyph >= _denseGlyphs.size()) _denseGlyphs.resize(glyph + 1, DenseGlyph{{}, false});
+        CORRADE_INTERNAL_ASSERT(!_denseGlyphs[glyph].present);
+        _denseGlyphs[glyph] = DenseGlyph{glyphData, true};
+    } else CORRADE_INTERNAL_ASSERT_OUTPUT(_sparseGlyphs.insert({glyph, glyphData}).second);
+    ++_glyphCount;
+
+    /* Track it for eviction */
+    if(_allocator) _allocator->insert(glyph, rectangle);
+}
+
+void GlyphCache::erase(const UnsignedInt glyph) {
+    if(glyph < _denseGlyphs.size()) {
+        if(!_denseGlyphs[glyph].present) return;
+        _denseGlyphs[glyph].present = false;
+    } else if(!_sparseGlyphs.erase(glyph)) return;
+
+    --_glyphCount;
 }
 
 void GlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
@@ -29,12 +29,16 @@
  * @brief Class @ref Magnum::Text::GlyphCache
  */
 
+#include <iterator>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
 #include "Magnum/Math/Range.h"
 #include "Magnum/Texture.h"
+#include "Magnum/Text/GlyphAllocator.h"
 #include "Magnum/Text/visibility.h"
+#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
@@ -55,6 +59,23 @@ font->createGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
                               "0123456789?!:;,. ");
 @endcode
 
+The cache keeps track of free space in the texture, so it's possible to fill
+it incrementally by calling @ref AbstractFont::fillGlyphCache() again with
+characters that were not rendered yet.
+
+## Glyph eviction
+
+For unbounded character sets it's possible to enable eviction of least
+recently used glyphs using @ref setEvictionEnabled(). Glyph usage is tracked
+explicitly using @ref use(), glyph lookup using @ref operator[]() doesn't
+change any state. @ref AbstractFont::fillGlyphCache() marks all glyphs for
+given characters as used, so calling it with the text before rendering it is
+enough to keep the glyphs of visible text in the cache. When there is no space
+left in the texture, @ref reserve() evicts the glyphs that were not used for
+the longest time. Text that was rendered using the evicted glyphs needs to be
+rendered again, see @ref evictedGlyphs(). The bookkeeping is done by
+@ref GlyphAllocator, which doesn't need any GPU resources.
+
 See @ref Renderer for information about text rendering.
 @todo Some way for Font to negotiate or check internal texture format
 @todo Default glyph 0 with rect 0 0 0 0 will result in negative dimensions when
@@ -112,7 +133,15 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         Vector2i padding() const { return _padding; }
 
         /** @brief Count of glyphs in the cache */
-        std::size_t glyphCount() const { return glyphs.size(); }
+        std::size_t glyphCount() const { return _glyphCount; }
+
+        /**
+         * @brief Whether given glyph is in the cache
+         *
+         * The "Not Found" glyph `0` is always present.
+         * @see @ref operator[]()
+         */
+        bool contains(UnsignedInt glyph) const { return !!find(glyph); }
 
         /** @brief Cache texture */
         Texture2D& texture() { return _texture; }
@@ -128,37 +157,88 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          *
          * If no glyph is found, glyph `0` is returned, which is by default on
          * zero position and has zero region in texture atlas. You can reset it
-         * to some meaningful value in @ref insert().
-         * @see @ref padding()
+         * to some meaningful value in @ref insert(). The lookup doesn't
+         * affect glyph eviction, use @ref use() for that.
+         * @see @ref padding(), @ref contains()
          */
         std::pair<Vector2i, Range2Di> operator[](UnsignedInt glyph) const {
-            auto it = glyphs.find(glyph);
-            return it == glyphs.end() ? glyphs.at(0) : it->second;
+            const std::pair<Vector2i, Range2Di>* const found = find(glyph);
+            return found ? *found : _denseGlyphs[0].data;
         }
 
-        /** @brief Iterator access to cache data */
-        std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>>::const_iterator begin() const {
-            return glyphs.begin();
+        /**
+         * @brief Mark glyph as used
+         * @return Reference to self (for method chaining)
+         *
+         * If eviction is enabled, the glyph is marked as most recently used
+         * so @ref reserve() evicts it only after all glyphs that were used
+         * earlier. Does nothing if eviction is not enabled or the glyph is
+         * not in the cache.
+         * @see @ref setEvictionEnabled()
+         */
+        GlyphCache& use(UnsignedInt glyph) {
+            if(_allocator) _allocator->use(glyph);
+            return *this;
         }
 
+        class ConstIterator;
+
+        /**
+         * @brief Iterator access to cache data
+         *
+         * Dereferencing the iterator gives a pair of glyph ID and glyph
+         * parameters as returned by @ref operator[](). The iteration order is
+         * unspecified.
+         */
+        ConstIterator begin() const;
+
         /** @brief Iterator access to cache data */
-        std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>>::const_iterator end() const {
-            return glyphs.end();
-        }
+        ConstIterator end() const;
+
+        /** @brief Whether glyph eviction is enabled */
+        bool isEvictionEnabled() const { return !!_allocator; }
+
+        /**
+         * @brief Enable or disable glyph eviction
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, @ref reserve() evicts least recently used glyphs
+         * instead of failing when there is no space left. Expects that
+         * there are no glyphs in the cache yet except for glyph `0`, which
+         * is never evicted. Disabled by default.
+         * @see @ref evictedGlyphs(), @ref GlyphAllocator
+         */
+        GlyphCache& setEvictionEnabled(bool enabled);
+
+        /**
+         * @brief Glyphs evicted in last call to @ref reserve()
+         *
+         * Text rendered using any of these glyphs needs to be rendered again.
+         * Empty if eviction is not enabled.
+         * @see @ref setEvictionEnabled()
+         */
+        const std::vector<UnsignedInt>& evictedGlyphs() const { return _evicted; }
 
         /**
          * @brief Layout glyphs with given sizes to the cache
          *
-         * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to @ref reserve() if no
-         * glyph was stored there, use @ref insert() to store actual glyph on
-         * given position and @ref setImage() to upload glyph image.
+         * Returns non-overlapping regions in cache texture to store glyphs,
+         * use @ref insert() to store actual glyph on given position and
+         * @ref setImage() to upload glyph image. The regions don't overlap
+         * with regions returned from previous calls to this function, so
+         * the cache can be filled incrementally. Reserved space stays
+         * reserved even if no glyph is stored there.
          *
-         * Glyph @p sizes are expected to be without padding.
+         * Glyph @p sizes are expected to be without padding. If the glyphs
+         * don't fit into remaining space in the cache, a message is printed
+         * to error output and empty vector is returned. If eviction is
+         * enabled, least recently used glyphs are removed from the cache
+         * to make space, see @ref evictedGlyphs().
          *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
-         * @see @ref padding()
+         * @attention Only space reserved by this function is taken into
+         *      account, glyphs that were added via @ref insert() on regions
+         *      not returned from @ref reserve() may get overlapped.
+         * @see @ref padding(), @ref TextureTools::AtlasPacker
          */
         std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
 
@@ -188,14 +268,104 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         virtual void setImage(const Vector2i& offset, const ImageView2D& image);
 
     private:
+        /* Glyph IDs below this limit are stored in a flat array indexed
+           directly by the ID, as they are usually dense small integers. The
+           rest goes into a hash map. */
+        enum: UnsignedInt { DenseGlyphLimit = 65536 };
+
+        struct DenseGlyph {
+            std::pair<Vector2i, Range2Di> data;
+            bool present;
+        };
+
+        const std::pair<Vector2i, Range2Di>* find(UnsignedInt glyph) const {
+            if(glyph < _denseGlyphs.size())
+                return _denseGlyphs[glyph].present ? &_denseGlyphs[glyph].data : nullptr;
+            if(glyph < DenseGlyphLimit || _sparseGlyphs.empty()) return nullptr;
+            const auto found = _sparseGlyphs.find(glyph);
+            return found == _sparseGlyphs.end() ? nullptr : &found->second;
+        }
+
         void MAGNUM_LOCAL initialize(TextureFormat internalFormat, const Vector2i& size);
+        void MAGNUM_LOCAL erase(UnsignedInt glyph);
 
         Vector2i _size, _padding;
+        TextureTools::AtlasPacker _atlas;
+        std::unique_ptr<GlyphAllocator> _allocator;
+        std::vector<UnsignedInt> _evicted;
         Texture2D _texture;
 
-        std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> glyphs;
+        std::vector<DenseGlyph> _denseGlyphs;
+        std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> _sparseGlyphs;
+        std::size_t _glyphCount;
+};
+
+/**
+@brief Glyph cache iterator
+
+@see @ref GlyphCache::begin(), @ref GlyphCache::end()
+*/
+class GlyphCache::ConstIterator {
+    public:
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+        #endif
+
+        /** @brief Glyph ID and its parameters */
+        std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>> operator*() const {
+            if(_dense != _cache->_denseGlyphs.size())
+                return {UnsignedInt(_dense), _cache->_denseGlyphs[_dense].data};
+            return *_sparse;
+        }
+
+        /** @brief Move to next glyph */
+        ConstIterator& operator++() {
+            if(_dense != _cache->_denseGlyphs.size()) {
+                ++_dense;
+                skipMissing();
+            } else ++_sparse;
+            return *this;
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const ConstIterator& other) const {
+            return _dense == other._dense && _sparse == other._sparse;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    private:
+        friend GlyphCache;
+
+        explicit ConstIterator(const GlyphCache& cache, std::size_t dense, std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>>::const_iterator sparse): _cache{&cache}, _dense{dense}, _sparse{sparse} {
+            skipMissing();
+        }
+
+        void skipMissing() {
+            while(_dense != _cache->_denseGlyphs.size() && !_cache->_denseGlyphs[_dense].present)
+                ++_dense;
+        }
+
+        const GlyphCache* _cache;
+        std::size_t _dense;
+        std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>>::const_iterator _sparse;
 };
 
+inline GlyphCache::ConstIterator GlyphCache::begin() const {
+    return ConstIterator{*this, 0, _sparseGlyphs.begin()};
+}
+
+inline GlyphCache::ConstIterator GlyphCache::end() const {
+    return ConstIterator{*this, _denseGlyphs.size(), _sparseGlyphs.end()};
+}
+
 }}
 
 #endif
@@ -31,6 +31,7 @@
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Shaders/AbstractVector.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/Implementation/renderIndices.h"
 
 namespace Magnum { namespace Text {
 
@@ -60,54 +61,57 @@ struct Vertex {
     Vector2 position, textureCoordinates;
 };
 
-std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
-    /* Output data, reserve memory as when the text would be ASCII-only. In
-       reality the actual vertex count will be smaller, but allocating more at
-       once is better than reallocating many times later. */
-    std::vector<Vertex> vertices;
-    vertices.reserve(text.size()*4);
+/* Renders the text into given arrays. Returns total glyph count, glyph count
+   of the longest line and rectangle spanning the rendered text. If there is
+   not enough space in the arrays, only the glyphs that fit are written. */
+std::tuple<UnsignedInt, UnsignedInt, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Alignment alignment, const Containers::ArrayView<GlyphQuad> glyphs, const Containers::ArrayView<Vector2> positions, const Containers::ArrayView<Vector2> textureCoordinates) {
+    const std::size_t vertexCapacity = Math::min(positions.size(), textureCoordinates.size())/4*4;
 
-    /* Total rendered bounds, intial line position, line increment, last+1
+    /* Total rendered bounds, intial line position, line increment, total
+       glyph count, glyph count of longest line, written vertex count, last+1
        vertex on previous line */
     Range2D rectangle;
     Vector2 linePosition;
     const Vector2 lineAdvance = Vector2::yAxis(font.lineHeight()*size/font.size());
+    UnsignedInt glyphCount = 0;
+    UnsignedInt maxLineGlyphCount = 0;
+    std::size_t vertexCount = 0;
     std::size_t lastLineLastVertex = 0;
 
-    /* Temp buffer so we don't allocate for each new line */
-    /**
-     * @todo C++1z: use std::string_view to avoid the one allocation and all
-     *      the copying altogether
-     */
-    std::string line;
-    line.reserve(text.size());
-
     /* Render each line separately and align it horizontally */
     std::size_t pos, prevPos = 0;
     do {
-        /* Empty line, nothing to do (the rest is done below in while expression) */
-        if((pos = text.find('\n', prevPos)) == prevPos) continue;
+        /* Find end of the line */
+        for(pos = prevPos; pos != text.size() && text[pos] != '\n'; ++pos);
 
-        /* Copy the line into the temp buffer */
-        line.assign(text, prevPos, pos-prevPos);
-
-        /* Layout the line */
-        const auto layouter = font.layout(cache, size, line);
+        /* Empty line, nothing to do (the rest is done below in while expression) */
+        if(pos == prevPos) continue;
 
-        /* Verify that we don't reallocate anything. The only problem might
-           arise when the layouter decides to compose one character from more
-           than one glyph (i.e. accents). Will remove the assert when this
-           issue arises. */
-        CORRADE_INTERNAL_ASSERT(vertices.size() + layouter->glyphCount()*4 <= vertices.capacity());
+        /* Layout the line, no copies needed */
+        const UnsignedInt lineGlyphCount = font.layout(cache, size, {text.data() + prevPos, pos - prevPos}, glyphs);
+        glyphCount += lineGlyphCount;
+        maxLineGlyphCount = Math::max(maxLineGlyphCount, lineGlyphCount);
 
         /* Bounds of rendered line */
         Range2D lineRectangle;
 
-        /* Render all glyphs */
+        /* Render all glyphs that fit */
         Vector2 cursorPosition(linePosition);
-        for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
-            Range2D quadPosition, textureCoordinates;
-            std::tie(quadPosition, textureCoordinates) = layouter->renderGlyph(i, cursorPosition, lineRectangle);
+        for(UnsignedInt i = 0; i < lineGlyphCount && i < glyphs.size() && vertexCount != vertexCapacity; ++i) {
+            /* Move the quad to cursor */
+            const GlyphQuad& glyph = glyphs[i];
+            const Range2D quadPosition = glyph.position.translated(cursorPosition);
+            const Range2D& quadTextureCoordinates = glyph.textureCoordinates;
+
+            /* Extend line bounds with current quad bounds, similarly to
+               AbstractLayouter::renderGlyph(). If zero size, replace it. */
+            if(!lineRectangle.size().isZero()) {
+                lineRectangle.bottomLeft() = Math::min(lineRectangle.bottomLeft(), quadPosition.bottomLeft());
+                lineRectangle.topRight() = Math::max(lineRectangle.topRight(), quadPosition.topRight());
+            } else lineRectangle = quadPosition;
+
+            /* Advance cursor position to next character */
+            cursorPosition += glyph.advance;
 
             /* 0---2
                |   |
@@ -115,12 +119,15 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
                |   |
                1---3 */
 
-            vertices.insert(vertices.end(), {
-                {quadPosition.topLeft(), textureCoordinates.topLeft()},
-                {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()},
-                {quadPosition.topRight(), textureCoordinates.topRight()},
-                {quadPosition.bottomRight(), textureCoordinates.bottomRight()}
-            });
+            positions[vertexCount] = quadPosition.topLeft();
+            positions[vertexCount + 1] = quadPosition.bottomLeft();
+            positions[vertexCount + 2] = quadPosition.topRight();
+            positions[vertexCount + 3] = quadPosition.bottomRight();
+            textureCoordinates[vertexCount] = quadTextureCoordinates.topLeft();
+            textureCoordinates[vertexCount + 1] = quadTextureCoordinates.bottomLeft();
+            textureCoordinates[vertexCount + 2] = quadTextureCoordinates.topRight();
+            textureCoordinates[vertexCount + 3] = quadTextureCoordinates.bottomRight();
+            vertexCount += 4;
         }
 
         /** @todo What about top-down text? */
@@ -138,8 +145,8 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
 
         /* Align positions and bounds on current line */
         lineRectangle = lineRectangle.translated(Vector2::xAxis(alignmentOffsetX));
-        for(auto it = vertices.begin()+lastLineLastVertex; it != vertices.end(); ++it)
-            it->position.x() += alignmentOffsetX;
+        for(std::size_t i = lastLineLastVertex; i != vertexCount; ++i)
+            positions[i].x() += alignmentOffsetX;
 
         /* Add final line bounds to total bounds, similarly to AbstractFont::renderGlyph() */
         if(!rectangle.size().isZero()) {
@@ -150,8 +157,8 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
     /* Move to next line */
     } while(prevPos = pos+1,
             linePosition -= lineAdvance,
-            lastLineLastVertex = vertices.size(),
-            pos != std::string::npos);
+            lastLineLastVertex = vertexCount,
+            pos != text.size());
 
     /* Vertically align the rendered text */
     Float alignmentOffsetY = 0.0f;
@@ -166,39 +173,42 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
 
     /* Align positions and bounds */
     rectangle = rectangle.translated(Vector2::yAxis(alignmentOffsetY));
-    for(auto& v: vertices) v.position.y() += alignmentOffsetY;
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        positions[i].y() += alignmentOffsetY;
 
-    return std::make_tuple(std::move(vertices), rectangle);
+    return std::make_tuple(glyphCount, maxLineGlyphCount, rectangle);
 }
 
-std::pair<Containers::Array<char>, Mesh::IndexType> renderIndicesInternal(const UnsignedInt glyphCount) {
-    const UnsignedInt vertexCount = glyphCount*4;
-    const UnsignedInt indexCount = glyphCount*6;
+std::tuple<std::vector<Vector2>, std::vector<Vector2>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
+    /* Output data, allocate memory as when the text would be ASCII-only. In
+       reality the actual vertex count will be smaller, but allocating more at
+       once is better than reallocating many times later. */
+    Containers::Array<GlyphQuad> glyphs(text.size());
+    std::vector<Vector2> positions(text.size()*4), textureCoordinates(text.size()*4);
 
-    Containers::Array<char> indices;
-    Mesh::IndexType indexType;
-    if(vertexCount <= 256) {
-        indexType = Mesh::IndexType::UnsignedByte;
-        indices = Containers::Array<char>(indexCount*sizeof(UnsignedByte));
-        createIndices<UnsignedByte>(indices, glyphCount);
-    } else if(vertexCount <= 65536) {
-        indexType = Mesh::IndexType::UnsignedShort;
-        indices = Containers::Array<char>(indexCount*sizeof(UnsignedShort));
-        createIndices<UnsignedShort>(indices, glyphCount);
-    } else {
-        indexType = Mesh::IndexType::UnsignedInt;
-        indices = Containers::Array<char>(indexCount*sizeof(UnsignedInt));
-        createIndices<UnsignedInt>(indices, glyphCount);
-    }
+    UnsignedInt glyphCount, maxLineGlyphCount;
+    Range2D rectangle;
+    std::tie(glyphCount, maxLineGlyphCount, rectangle) = renderVerticesInternal(font, cache, size, {text.data(), text.size()}, alignment, glyphs, {positions.data(), positions.size()}, {textureCoordinates.data(), textureCoordinates.size()});
 
-    return {std::move(indices), indexType};
+    /* Verify that everything fit. The only problem might arise when the
+       layouter decides to compose one character from more than one glyph
+       (i.e. accents). Will remove the assert when this issue arises. */
+    CORRADE_INTERNAL_ASSERT(glyphCount <= text.size());
+
+    positions.resize(glyphCount*4);
+    textureCoordinates.resize(glyphCount*4);
+    return std::make_tuple(std::move(positions), std::move(textureCoordinates), rectangle);
 }
 
+
 std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
-    /* Render vertices and upload them */
-    std::vector<Vertex> vertices;
+    /* Render vertices, interleave and upload them */
+    std::vector<Vector2> positions, textureCoordinates;
     Range2D rectangle;
-    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+    std::tie(positions, textureCoordinates, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+    std::vector<Vertex> vertices(positions.size());
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i] = {positions[i], textureCoordinates[i]};
     vertexBuffer.setData(vertices, usage);
 
     const UnsignedInt glyphCount = vertices.size()/4;
@@ -207,7 +217,7 @@ std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& c
     /* Render indices and upload them */
     Containers::Array<char> indices;
     Mesh::IndexType indexType;
-    std::tie(indices, indexType) = renderIndicesInternal(glyphCount);
+    std::tie(indices, indexType) = Implementation::renderIndices(glyphCount);
     indexBuffer.setData(indices, usage);
 
     /* Configure mesh except for vertex buffer (depends on dimension count, done
@@ -222,29 +232,56 @@ std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& c
 
 }
 
+std::pair<Containers::Array<char>, Mesh::IndexType> Implementation::renderIndices(const UnsignedInt glyphCount) {
+    const UnsignedInt vertexCount = glyphCount*4;
+    const UnsignedInt indexCount = glyphCount*6;
+
+    Containers::Array<char> indices;
+    Mesh::IndexType indexType;
+    if(vertexCount <= 256) {
+        indexType = Mesh::IndexType::UnsignedByte;
+        indices = Containers::Array<char>(indexCount*sizeof(UnsignedByte));
+        createIndices<UnsignedByte>(indices, glyphCount);
+    } else if(vertexCount <= 65536) {
+        indexType = Mesh::IndexType::UnsignedShort;
+        indices = Containers::Array<char>(indexCount*sizeof(UnsignedShort));
+        createIndices<UnsignedShort>(indices, glyphCount);
+    } else {
+        indexType = Mesh::IndexType::UnsignedInt;
+        indices = Containers::Array<char>(indexCount*sizeof(UnsignedInt));
+        createIndices<UnsignedInt>(indices, glyphCount);
+    }
+
+    return {std::move(indices), indexType};
+}
+
 std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment) {
     /* Render vertices */
-    std::vector<Vertex> vertices;
-    Range2D rectangle;
-    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
-
-    /* Deinterleave the vertices */
     std::vector<Vector2> positions, textureCoordinates;
-    positions.reserve(vertices.size());
-    positions.reserve(textureCoordinates.size());
-    for(const auto& v: vertices) {
-        positions.push_back(v.position);
-        textureCoordinates.push_back(v.textureCoordinates);
-    }
+    Range2D rectangle;
+    std::tie(positions, textureCoordinates, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
 
     /* Render indices */
-    const UnsignedInt glyphCount = vertices.size()/4;
+    const UnsignedInt glyphCount = positions.size()/4;
     std::vector<UnsignedInt> indices(glyphCount*6);
     createIndices<UnsignedInt>(indices.data(), glyphCount);
 
     return std::make_tuple(std::move(positions), std::move(textureCoordinates), std::move(indices), rectangle);
 }
 
+std::pair<UnsignedInt, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::ArrayView<GlyphQuad> glyphs, const Containers::ArrayView<Vector2> positions, const Containers::ArrayView<Vector2> textureCoordinates, const Alignment alignment) {
+    UnsignedInt glyphCount, maxLineGlyphCount;
+    Range2D rectangle;
+    std::tie(glyphCount, maxLineGlyphCount, rectangle) = renderVerticesInternal(font, cache, size, text, alignment, glyphs, positions, textureCoordinates);
+
+    CORRADE_ASSERT(maxLineGlyphCount <= glyphs.size(),
+        "Text::AbstractRenderer::render(): glyph array of size" << glyphs.size() << "too small to layout" << maxLineGlyphCount << "glyphs", {});
+    CORRADE_ASSERT(glyphCount*4 <= positions.size() && glyphCount*4 <= textureCoordinates.size(),
+        "Text::AbstractRenderer::render(): expected at least" << glyphCount*4 << "vertices but got" << positions.size() << "positions and" << textureCoordinates.size() << "texture coordinates", {});
+
+    return {glyphCount, rectangle};
+}
+
 template<UnsignedInt dimensions> std::tuple<Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
     /* Finalize mesh configuration and return the result */
     auto r = renderInternal(font, cache, size, text, vertexBuffer, indexBuffer, usage, alignment);
@@ -351,10 +388,15 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const BufferUsage vert
     #endif
     _mesh.setCount(0);
 
+    /* Allocate scratch memory for rendering */
+    _glyphs = Containers::Array<GlyphQuad>(glyphCount);
+    _positions = Containers::Array<Vector2>(vertexCount);
+    _textureCoordinates = Containers::Array<Vector2>(vertexCount);
+
     /* Render indices */
     Containers::Array<char> indexData;
     Mesh::IndexType indexType;
-    std::tie(indexData, indexType) = renderIndicesInternal(glyphCount);
+    std::tie(indexData, indexType) = Implementation::renderIndices(glyphCount);
 
     /* Allocate index buffer, reset index count and reconfigure buffer binding */
     _indexBuffer.setData({nullptr, indexData.size()}, indexBufferUsage);
@@ -373,12 +415,11 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const BufferUsage vert
 }
 
 void AbstractRenderer::render(const std::string& text) {
-    /* Render vertex data */
-    std::vector<Vertex> vertexData;
-    _rectangle = {};
-    std::tie(vertexData, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment);
+    /* Render vertex data into preallocated memory. Glyph scratch array has the
+       same capacity as vertex data, so checking vertex count is enough. */
+    UnsignedInt glyphCount;
+    std::tie(glyphCount, std::ignore, _rectangle) = renderVerticesInternal(font, cache, size, {text.data(), text.size()}, _alignment, _glyphs, _positions, _textureCoordinates);
 
-    const UnsignedInt glyphCount = vertexData.size()/4;
     const UnsignedInt vertexCount = glyphCount*4;
     const UnsignedInt indexCount = glyphCount*6;
 
@@ -389,7 +430,8 @@ void AbstractRenderer::render(const std::string& text) {
     Containers::ArrayView<Vertex> vertices(static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer,
         vertexCount*sizeof(Vertex))), vertexCount);
     CORRADE_INTERNAL_ASSERT_OUTPUT(vertices);
-    std::copy(vertexData.begin(), vertexData.end(), vertices.begin());
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        vertices[i] = {_positions[i], _textureCoordinates[i]};
     bufferUnmapImplementation(_vertexBuffer);
 
     /* Update index count */
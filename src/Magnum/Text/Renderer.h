@@ -32,6 +32,7 @@
 #include <string>
 #include <tuple>
 #include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Math/Range.h"
 #include "Magnum/Buffer.h"
@@ -64,6 +65,31 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          */
         static std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment = Alignment::LineLeft);
 
+        /**
+         * @brief Render text into preallocated memory
+         * @param font                  Font
+         * @param cache                 Glyph cache
+         * @param size                  Font size
+         * @param text                  Text to render
+         * @param glyphs                Scratch memory for laying out the
+         *      glyphs, needs to be large enough for the longest line
+         * @param positions             Where to put vertex positions
+         * @param textureCoordinates    Where to put texture coordinates
+         * @param alignment             Text alignment
+         *
+         * Variant of @ref render(AbstractFont&, const GlyphCache&, Float, const std::string&, Alignment)
+         * which doesn't allocate any memory, provided that the font
+         * implements allocation-free layout, see
+         * @ref AbstractFont::layout(const GlyphCache&, Float, Containers::ArrayView<const char>, Containers::ArrayView<GlyphQuad>).
+         * Four vertices are written for each glyph, expects that
+         * @p positions and @p textureCoordinates are large enough. Returns
+         * count of rendered glyphs and rectangle spanning the rendered text.
+         * Indices are not generated, the vertices are in the same order as
+         * with the other overloads, so the index buffer filled by
+         * @ref reserve() can be reused.
+         */
+        static std::pair<UnsignedInt, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::ArrayView<GlyphQuad> glyphs, Containers::ArrayView<Vector2> positions, Containers::ArrayView<Vector2> textureCoordinates, Alignment alignment = Alignment::LineLeft);
+
         /**
          * @brief Capacity for rendered glyphs
          *
@@ -102,7 +128,10 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          *
          * Renders the text to vertex buffer, reusing index buffer already
          * filled with @ref reserve(). Rectangle spanning the rendered text is
-         * available through @ref rectangle().
+         * available through @ref rectangle(). The vertices are rendered into
+         * memory preallocated in @ref reserve(), so this function doesn't
+         * allocate if the font supports allocation-free layout, see
+         * @ref AbstractFont::layout(const GlyphCache&, Float, Containers::ArrayView<const char>, Containers::ArrayView<GlyphQuad>).
          *
          * Initially no text is rendered.
          * @attention The capacity must be large enough to contain all glyphs,
@@ -132,6 +161,8 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         Alignment _alignment;
         UnsignedInt _capacity;
         Range2D _rectangle;
+        Containers::Array<GlyphQuad> _glyphs;
+        Containers::Array<Vector2> _positions, _textureCoordinates;
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
         typedef void*(*BufferMapImplementation)(Buffer&, GLsizeiptr);
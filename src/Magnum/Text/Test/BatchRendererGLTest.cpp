@@ -0,0 +1,113 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/BatchRenderer.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct BatchRendererGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit BatchRendererGLTest();
+
+    void update();
+};
+
+BatchRendererGLTest::BatchRendererGLTest() {
+    addTests({&BatchRendererGLTest::update});
+}
+
+namespace {
+
+class TestLayouter: public Text::AbstractLayouter {
+    public:
+        explicit TestLayouter(std::size_t glyphCount): AbstractLayouter(glyphCount) {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
+            return std::make_tuple(
+                Range2D({}, Vector2(1.0f)),
+                Range2D::fromSize({i*0.1f, 0.0f}, Vector2(0.1f)),
+                Vector2::xAxis(1.0f));
+        }
+};
+
+class TestFont: public Text::AbstractFont {
+    Features doFeatures() const override { return Feature::OpenData; }
+
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    UnsignedInt doGlyphId(char32_t) override { return 0; }
+    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+    std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string& text) override {
+        return std::unique_ptr<AbstractLayouter>(new TestLayouter(text.size()));
+    }
+};
+
+/* *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer grumpy */
+char glyphCacheData;
+GlyphCache& nullGlyphCache = *reinterpret_cast<GlyphCache*>(&glyphCacheData);
+
+}
+
+void BatchRendererGLTest::update() {
+    TestFont font;
+    Batch2D batch{font, nullGlyphCache};
+    batch.add("abc", Matrix3::translation({0.0f, 1.0f}), 1.0f);
+    batch.add("defgh", Matrix3::translation({0.0f, 2.0f}), 1.0f);
+
+    BatchRenderer2D renderer;
+    CORRADE_COMPARE(renderer.capacity(), 0);
+    CORRADE_COMPARE(renderer.mesh().count(), 0);
+
+    /* All labels in one mesh */
+    renderer.update(batch);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 8);
+    CORRADE_COMPARE(renderer.mesh().count(), 48);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(renderer.vertexBuffer().size(), Int(32*sizeof(Batch2D::Vertex)));
+    #endif
+
+    /* Less glyphs, index buffer is kept */
+    batch.clear();
+    batch.add("ab", Matrix3{}, 1.0f);
+    renderer.update(batch);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 8);
+    CORRADE_COMPARE(renderer.mesh().count(), 12);
+
+    /* More glyphs, index buffer grows geometrically */
+    batch.add("cdefghij", Matrix3{}, 1.0f);
+    renderer.update(batch);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 16);
+    CORRADE_COMPARE(renderer.mesh().count(), 60);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::BatchRendererGLTest)
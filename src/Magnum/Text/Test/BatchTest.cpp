@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Text/BatchRenderer.h"
+#include "Magnum/Text/Renderer.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct BatchTest: TestSuite::Tester {
+    explicit BatchTest();
+
+    void add2D();
+    void add3D();
+    void clear();
+    void invalidLabel();
+};
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::add2D,
+              &BatchTest::add3D,
+              &BatchTest::clear,
+              &BatchTest::invalidLabel});
+}
+
+namespace {
+
+class TestLayouter: public Text::AbstractLayouter {
+    public:
+        explicit TestLayouter(Float size, std::size_t glyphCount): AbstractLayouter(glyphCount), _size(size) {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
+            return std::make_tuple(
+                Range2D({}, Vector2(3.0f, 2.0f)*((i+1)*_size)),
+                Range2D::fromSize({i*6.0f, 0.0f}, {6.0f, 10.0f}),
+                (Vector2::xAxis((i+1)*3.0f)+Vector2(1.0f, -1.0f))*_size
+            );
+        }
+
+        Float _size;
+};
+
+class TestFont: public Text::AbstractFont {
+    Features doFeatures() const override { return Feature::OpenData; }
+
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    UnsignedInt doGlyphId(char32_t) override { return 0; }
+    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+    std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, const Float size, const std::string& text) override {
+        return std::unique_ptr<AbstractLayouter>(new TestLayouter(size, text.size()));
+    }
+};
+
+/* The batch doesn't need any GL functionality and the test font doesn't
+   touch the cache. *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer
+   grumpy. */
+char glyphCacheData;
+GlyphCache& nullGlyphCache = *reinterpret_cast<GlyphCache*>(&glyphCacheData);
+
+}
+
+void BatchTest::add2D() {
+    TestFont font;
+    Batch2D batch{font, nullGlyphCache};
+    CORRADE_COMPARE(batch.labelCount(), 0);
+    CORRADE_COMPARE(batch.glyphCount(), 0);
+
+    CORRADE_COMPARE(batch.add("abc", Matrix3::translation({10.0f, 20.0f}), 0.25f, Alignment::MiddleRightIntegral), 0);
+    CORRADE_COMPARE(batch.add("ab", Matrix3::scaling(Vector2(2.0f)), 0.5f), 1);
+    CORRADE_COMPARE(batch.labelCount(), 2);
+    CORRADE_COMPARE(batch.glyphCount(), 5);
+    CORRADE_COMPARE(batch.vertices().size(), 20);
+    CORRADE_COMPARE(batch.labelGlyphs(0).first, 0);
+    CORRADE_COMPARE(batch.labelGlyphs(0).second, 3);
+    CORRADE_COMPARE(batch.labelGlyphs(1).first, 3);
+    CORRADE_COMPARE(batch.labelGlyphs(1).second, 2);
+
+    /* Same as what the renderer produces, just transformed */
+    std::vector<Vector2> positions, textureCoordinates;
+    Range2D rectangle;
+    std::tie(positions, textureCoordinates, std::ignore, rectangle) = AbstractRenderer::render(font, nullGlyphCache, 0.25f, "abc", Alignment::MiddleRightIntegral);
+    CORRADE_COMPARE(batch.labelRectangle(0), rectangle);
+    for(std::size_t i = 0; i != 12; ++i) {
+        CORRADE_COMPARE(batch.vertices()[i].position, positions[i] + Vector2{10.0f, 20.0f});
+        CORRADE_COMPARE(batch.vertices()[i].textureCoordinates, textureCoordinates[i]);
+    }
+
+    std::tie(positions, textureCoordinates, std::ignore, rectangle) = AbstractRenderer::render(font, nullGlyphCache, 0.5f, "ab");
+    CORRADE_COMPARE(batch.labelRectangle(1), rectangle);
+    for(std::size_t i = 0; i != 8; ++i) {
+        CORRADE_COMPARE(batch.vertices()[12 + i].position, positions[i]*2.0f);
+        CORRADE_COMPARE(batch.vertices()[12 + i].textureCoordinates, textureCoordinates[i]);
+    }
+}
+
+void BatchTest::add3D() {
+    TestFont font;
+    Batch3D batch{font, nullGlyphCache};
+    batch.add("ab", Matrix4::translation({1.0f, 2.0f, 3.0f}), 0.5f);
+    CORRADE_COMPARE(batch.glyphCount(), 2);
+
+    std::vector<Vector2> positions;
+    std::tie(positions, std::ignore, std::ignore, std::ignore) = AbstractRenderer::render(font, nullGlyphCache, 0.5f, "ab");
+    for(std::size_t i = 0; i != 8; ++i)
+        CORRADE_COMPARE(batch.vertices()[i].position, Vector3(positions[i], 0.0f) + Vector3{1.0f, 2.0f, 3.0f});
+}
+
+void BatchTest::clear() {
+    TestFont font;
+    Batch2D batch{font, nullGlyphCache};
+    batch.add("abc", Matrix3{}, 0.25f);
+    batch.clear();
+    CORRADE_COMPARE(batch.labelCount(), 0);
+    CORRADE_COMPARE(batch.glyphCount(), 0);
+
+    /* IDs start from zero again */
+    CORRADE_COMPARE(batch.add("ab", Matrix3{}, 0.25f), 0);
+    CORRADE_COMPARE(batch.labelGlyphs(0).first, 0);
+    CORRADE_COMPARE(batch.labelGlyphs(0).second, 2);
+}
+
+void BatchTest::invalidLabel() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    TestFont font;
+    Batch2D batch{font, nullGlyphCache};
+    batch.add("abc", Matrix3{}, 0.25f);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batch.labelGlyphs(1);
+    batch.labelRectangle(1);
+    CORRADE_COMPARE(out.str(),
+        "Text::Batch::labelGlyphs(): index 1 out of range for 1 labels\n"
+        "Text::Batch::labelRectangle(): index 1 out of range for 1 labels\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::BatchTest)
@@ -0,0 +1,188 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Text/GlyphAllocator.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct GlyphAllocatorTest: TestSuite::Tester {
+    explicit GlyphAllocatorTest();
+
+    void reserve();
+    void reservePadding();
+    void reserveTooLarge();
+
+    void evict();
+    void evictUsed();
+    void evictAll();
+
+    void remove();
+    void clear();
+};
+
+GlyphAllocatorTest::GlyphAllocatorTest() {
+    addTests({&GlyphAllocatorTest::reserve,
+              &GlyphAllocatorTest::reservePadding,
+              &GlyphAllocatorTest::reserveTooLarge,
+
+              &GlyphAllocatorTest::evict,
+              &GlyphAllocatorTest::evictUsed,
+              &GlyphAllocatorTest::evictAll,
+
+              &GlyphAllocatorTest::remove,
+              &GlyphAllocatorTest::clear});
+}
+
+void GlyphAllocatorTest::reserve() {
+    GlyphAllocator allocator{Vector2i{32}};
+    std::vector<UnsignedInt> evicted;
+
+    /* Tallest first, the shorter glyphs are put into the same shelf as
+       it's not too tall for them */
+    CORRADE_COMPARE(allocator.reserve({{8, 8}, {16, 16}, {8, 8}}, evicted), (std::vector<Range2Di>{
+        Range2Di::fromSize({16, 0}, {8, 8}),
+        Range2Di::fromSize({0, 0}, {16, 16}),
+        Range2Di::fromSize({24, 0}, {8, 8})}));
+
+    /* Much shorter glyph opens a new shelf */
+    CORRADE_COMPARE(allocator.reserve({{4, 4}}, evicted), (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 16}, {4, 4})}));
+    CORRADE_VERIFY(evicted.empty());
+    CORRADE_COMPARE(allocator.glyphCount(), 0);
+}
+
+void GlyphAllocatorTest::reservePadding() {
+    GlyphAllocator allocator{Vector2i{32}, Vector2i{1}};
+    std::vector<UnsignedInt> evicted;
+
+    CORRADE_COMPARE(allocator.reserve({{6, 6}, {6, 6}}, evicted), (std::vector<Range2Di>{
+        Range2Di::fromSize({1, 1}, {6, 6}),
+        Range2Di::fromSize({9, 1}, {6, 6})}));
+}
+
+void GlyphAllocatorTest::reserveTooLarge() {
+    GlyphAllocator allocator{Vector2i{32}};
+    std::vector<UnsignedInt> evicted;
+
+    const std::vector<Range2Di> glyphs = allocator.reserve({{16, 16}}, evicted);
+    CORRADE_COMPARE(glyphs.size(), 1);
+    allocator.insert(1, glyphs[0]);
+
+    /* Nothing is evicted if the glyph can't ever fit */
+    CORRADE_VERIFY(allocator.reserve({{33, 16}}, evicted).empty());
+    CORRADE_VERIFY(evicted.empty());
+    CORRADE_VERIFY(allocator.contains(1));
+}
+
+void GlyphAllocatorTest::evict() {
+    GlyphAllocator allocator{Vector2i{32}};
+    std::vector<UnsignedInt> evicted;
+
+    const std::vector<Range2Di> glyphs = allocator.reserve({{16, 16}, {16, 16}, {16, 16}, {16, 16}}, evicted);
+    CORRADE_COMPARE(glyphs.size(), 4);
+    for(UnsignedInt i = 0; i != 4; ++i) allocator.insert(i + 1, glyphs[i]);
+    CORRADE_COMPARE(allocator.glyphCount(), 4);
+    CORRADE_COMPARE(allocator.leastRecentlyUsed(), 1);
+
+    /* The cache is full, least recently inserted glyph is evicted and its
+       space reused */
+    CORRADE_COMPARE(allocator.reserve({{16, 16}}, evicted), (std::vector<Range2Di>{glyphs[0]}));
+    CORRADE_COMPARE(evicted, (std::vector<UnsignedInt>{1}));
+    CORRADE_VERIFY(!allocator.contains(1));
+    CORRADE_COMPARE(allocator.glyphCount(), 3);
+}
+
+void GlyphAllocatorTest::evictUsed() {
+    GlyphAllocator allocator{Vector2i{32}};
+    std::vector<UnsignedInt> evicted;
+
+    const std::vector<Range2Di> glyphs = allocator.reserve({{16, 16}, {16, 16}, {16, 16}, {16, 16}}, evicted);
+    for(UnsignedInt i = 0; i != 4; ++i) allocator.insert(i + 1, glyphs[i]);
+
+    /* Using the glyphs changes the eviction order */
+    allocator.use(1);
+    allocator.use(3);
+    allocator.use(2);
+    CORRADE_COMPARE(allocator.leastRecentlyUsed(), 4);
+
+    CORRADE_COMPARE(allocator.reserve({{16, 16}, {16, 16}}, evicted).size(), 2);
+    CORRADE_COMPARE(evicted, (std::vector<UnsignedInt>{4, 1}));
+}
+
+void GlyphAllocatorTest::evictAll() {
+    GlyphAllocator allocator{Vector2i{32}};
+    std::vector<UnsignedInt> evicted;
+
+    const std::vector<Range2Di> glyphs = allocator.reserve({{8, 8}, {8, 16}, {8, 4}}, evicted);
+    for(UnsignedInt i = 0; i != 3; ++i) allocator.insert(i + 1, glyphs[i]);
+
+    /* Shelves of all evicted glyphs are merged to make space for the large
+       one */
+    CORRADE_COMPARE(allocator.reserve({{32, 32}}, evicted), (std::vector<Range2Di>{
+        Range2Di::fromSize({}, {32, 32})}));
+    CORRADE_COMPARE(evicted.size(), 3);
+    CORRADE_COMPARE(allocator.glyphCount(), 0);
+}
+
+void GlyphAllocatorTest::remove() {
+    GlyphAllocator allocator{Vector2i{32}};
+    std::vector<UnsignedInt> evicted;
+
+    const std::vector<Range2Di> glyphs = allocator.reserve({{8, 8}, {8, 8}, {8, 8}}, evicted);
+    for(UnsignedInt i = 0; i != 3; ++i) allocator.insert(i + 1, glyphs[i]);
+
+    /* Space of removed glyph is reused */
+    allocator.remove(2);
+    CORRADE_VERIFY(!allocator.contains(2));
+    CORRADE_COMPARE(allocator.reserve({{6, 8}}, evicted), (std::vector<Range2Di>{
+        Range2Di::fromSize(glyphs[1].bottomLeft(), {6, 8})}));
+    CORRADE_VERIFY(evicted.empty());
+
+    /* Removing unknown glyph does nothing */
+    allocator.remove(2);
+    CORRADE_COMPARE(allocator.glyphCount(), 2);
+}
+
+void GlyphAllocatorTest::clear() {
+    GlyphAllocator allocator{Vector2i{32}};
+    std::vector<UnsignedInt> evicted;
+
+    allocator.insert(1, allocator.reserve({{32, 32}}, evicted)[0]);
+    CORRADE_VERIFY(allocator.reserve({{32, 32}}, evicted).size());
+    CORRADE_COMPARE(evicted, (std::vector<UnsignedInt>{1}));
+
+    /* Reserved space is freed as well */
+    allocator.clear();
+    evicted.clear();
+    CORRADE_COMPARE(allocator.glyphCount(), 0);
+    CORRADE_COMPARE(allocator.reserve({{32, 32}}, evicted).size(), 1);
+    CORRADE_VERIFY(evicted.empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphAllocatorTest)
@@ -0,0 +1,144 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <random>
+#include <unordered_map>
+
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Test/Benchmark.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/Renderer.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+/* Measures per-glyph lookup cost in the glyph cache and in the renderer */
+struct GlyphCacheGLBenchmark: Magnum::Test::AbstractOpenGLTester {
+    explicit GlyphCacheGLBenchmark();
+
+    void lookup();
+    void render();
+};
+
+GlyphCacheGLBenchmark::GlyphCacheGLBenchmark() {
+    addTests({&GlyphCacheGLBenchmark::lookup,
+              &GlyphCacheGLBenchmark::render});
+}
+
+namespace {
+
+enum: std::size_t {
+    GlyphCount = 2048,
+    LookupCount = 1 << 22,
+    TextSize = 1 << 16
+};
+
+class CacheLayouter: public AbstractLayouter {
+    public:
+        explicit CacheLayouter(const GlyphCache& cache, const std::string& text): AbstractLayouter(text.size()), _cache(cache), _text(text) {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(const UnsignedInt i) override {
+            Vector2i position;
+            Range2Di rectangle;
+            std::tie(position, rectangle) = _cache[UnsignedByte(_text[i])*(GlyphCount/256)];
+            return std::make_tuple(
+                Range2D::fromSize(Vector2(position), Vector2(rectangle.size())),
+                Range2D(rectangle),
+                Vector2::xAxis(Float(rectangle.sizeX())));
+        }
+
+        const GlyphCache& _cache;
+        const std::string _text;
+};
+
+class CacheFont: public AbstractFont {
+    Features doFeatures() const override { return Feature::OpenData; }
+
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    UnsignedInt doGlyphId(char32_t) override { return 0; }
+    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+    std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache& cache, Float, const std::string& text) override {
+        return std::unique_ptr<AbstractLayouter>(new CacheLayouter(cache, text));
+    }
+};
+
+}
+
+void GlyphCacheGLBenchmark::lookup() {
+    GlyphCache cache(Vector2i(1024));
+    std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> map;
+    for(UnsignedInt i = 1; i != GlyphCount; ++i) {
+        const Range2Di rectangle = Range2Di::fromSize({Int(i%64)*16, Int(i/64)*16}, Vector2i(16));
+        cache.insert(i, {}, rectangle);
+        map.emplace(i, std::make_pair(Vector2i{}, rectangle));
+    }
+
+    std::mt19937 rng;
+    std::uniform_int_distribution<UnsignedInt> distribution(0, GlyphCount - 1);
+    std::vector<UnsignedInt> glyphs(LookupCount);
+    for(UnsignedInt& glyph: glyphs) glyph = distribution(rng);
+
+    Int sumCache = 0, sumMap = 0;
+    Magnum::Test::benchmark("GlyphCache::operator[]():", [&]() {
+        for(const UnsignedInt glyph: glyphs)
+            sumCache += cache[glyph].second.left();
+    }, LookupCount);
+    Magnum::Test::benchmark("std::unordered_map::find():", [&]() {
+        for(const UnsignedInt glyph: glyphs) {
+            const auto found = map.find(glyph);
+            if(found != map.end()) sumMap += found->second.second.left();
+        }
+    }, LookupCount);
+
+    CORRADE_COMPARE(sumCache, sumMap);
+}
+
+void GlyphCacheGLBenchmark::render() {
+    GlyphCache cache(Vector2i(1024));
+    for(UnsignedInt i = 1; i != GlyphCount; ++i)
+        cache.insert(i, {}, Range2Di::fromSize({Int(i%64)*16, Int(i/64)*16}, Vector2i(16)));
+
+    std::string text(TextSize, ' ');
+    for(std::size_t i = 0; i != text.size(); ++i)
+        text[i] = 'a' + i%26;
+
+    CacheFont font;
+    std::vector<Vector2> positions;
+    std::vector<Vector2> textureCoordinates;
+    std::vector<UnsignedInt> indices;
+    Range2D bounds;
+    Magnum::Test::benchmark("AbstractRenderer::render():", [&]() {
+        std::tie(positions, textureCoordinates, indices, bounds) = AbstractRenderer::render(font, cache, 1.0f, text);
+    }, TextSize);
+
+    CORRADE_COMPARE(positions.size(), TextSize*4);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::GlyphCacheGLBenchmark)
@@ -23,9 +23,11 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <tuple>
 
 #include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/GlyphCache.h"
 
 namespace Magnum { namespace Text { namespace Test {
@@ -35,13 +37,27 @@ struct GlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
 
     void initialize();
     void access();
+    void accessSparse();
+    void iterate();
     void reserve();
+    void reserveIncremental();
+    void reserveTooLarge();
+    void fillIncremental();
+    void eviction();
+    void evictionFill();
 };
 
 GlyphCacheGLTest::GlyphCacheGLTest() {
     addTests({&GlyphCacheGLTest::initialize,
               &GlyphCacheGLTest::access,
-              &GlyphCacheGLTest::reserve});
+              &GlyphCacheGLTest::accessSparse,
+              &GlyphCacheGLTest::iterate,
+              &GlyphCacheGLTest::reserve,
+              &GlyphCacheGLTest::reserveIncremental,
+              &GlyphCacheGLTest::reserveTooLarge,
+              &GlyphCacheGLTest::fillIncremental,
+              &GlyphCacheGLTest::eviction,
+              &GlyphCacheGLTest::evictionFill});
 }
 
 void GlyphCacheGLTest::initialize() {
@@ -60,6 +76,7 @@ void GlyphCacheGLTest::access() {
 
     /* Default "Not Found" glyph */
     CORRADE_COMPARE(cache.glyphCount(), 1);
+    CORRADE_VERIFY(cache.contains(0));
     std::tie(position, rectangle) = cache[0];
     CORRADE_COMPARE(position, Vector2i(0, 0));
     CORRADE_COMPARE(rectangle, Range2Di({0, 0}, {0, 0}));
@@ -74,6 +91,8 @@ void GlyphCacheGLTest::access() {
     /* Querying available glyph */
     cache.insert(25, {3, 4}, {{15, 30}, {45, 35}});
     CORRADE_COMPARE(cache.glyphCount(), 2);
+    CORRADE_VERIFY(cache.contains(25));
+    CORRADE_VERIFY(!cache.contains(42));
     std::tie(position, rectangle) = cache[25];
     CORRADE_COMPARE(position, Vector2i(3, 4));
     CORRADE_COMPARE(rectangle, Range2Di({15, 30}, {45, 35}));
@@ -84,6 +103,46 @@ void GlyphCacheGLTest::access() {
     CORRADE_COMPARE(rectangle, Range2Di({10, 10}, {23, 45}));
 }
 
+void GlyphCacheGLTest::accessSparse() {
+    Text::GlyphCache cache(Vector2i(236));
+    Vector2i position;
+    Range2Di rectangle;
+
+    /* Glyph IDs outside of the flat lookup table */
+    cache.insert(0, {3, 5}, {{10, 10}, {23, 45}});
+    cache.insert(1000000, {3, 4}, {{15, 30}, {45, 35}});
+    CORRADE_COMPARE(cache.glyphCount(), 2);
+    std::tie(position, rectangle) = cache[1000000];
+    CORRADE_COMPARE(position, Vector2i(3, 4));
+    CORRADE_COMPARE(rectangle, Range2Di({15, 30}, {45, 35}));
+
+    /* Not available glyph falls back to "Not Found" */
+    std::tie(position, rectangle) = cache[1000001];
+    CORRADE_COMPARE(position, Vector2i(3, 5));
+    CORRADE_COMPARE(rectangle, Range2Di({10, 10}, {23, 45}));
+}
+
+void GlyphCacheGLTest::iterate() {
+    Text::GlyphCache cache(Vector2i(236));
+    cache.insert(25, {3, 4}, {{15, 30}, {45, 35}});
+    cache.insert(3, {1, 2}, {{5, 5}, {10, 10}});
+    cache.insert(1000000, {7, 8}, {{50, 50}, {60, 60}});
+
+    std::vector<std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>>> glyphs;
+    for(const std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>>& glyph: cache)
+        glyphs.push_back(glyph);
+
+    /* Flat table is iterated in order, skipping the holes */
+    CORRADE_COMPARE(glyphs.size(), 4);
+    CORRADE_COMPARE(glyphs[0].first, 0);
+    CORRADE_COMPARE(glyphs[1].first, 3);
+    CORRADE_COMPARE(glyphs[1].second.first, Vector2i(1, 2));
+    CORRADE_COMPARE(glyphs[2].first, 25);
+    CORRADE_COMPARE(glyphs[2].second.second, Range2Di({15, 30}, {45, 35}));
+    CORRADE_COMPARE(glyphs[3].first, 1000000);
+    CORRADE_COMPARE(glyphs[3].second.first, Vector2i(7, 8));
+}
+
 void GlyphCacheGLTest::reserve() {
     Text::GlyphCache cache(Vector2i(236));
 
@@ -91,6 +150,128 @@ void GlyphCacheGLTest::reserve() {
     CORRADE_VERIFY(!cache.reserve({{5, 3}}).empty());
 }
 
+void GlyphCacheGLTest::reserveIncremental() {
+    Text::GlyphCache cache(Vector2i(64), Vector2i(64), Vector2i(1));
+
+    const std::vector<Range2Di> first = cache.reserve({{30, 20}, {20, 30}});
+    CORRADE_COMPARE(first.size(), 2);
+    cache.insert(1, {}, first[0]);
+    cache.insert(2, {}, first[1]);
+
+    /* Reserving in non-empty cache gives regions not overlapping the
+       previous ones */
+    const std::vector<Range2Di> second = cache.reserve({{25, 25}});
+    CORRADE_COMPARE(second.size(), 1);
+    for(const Range2Di& previous: first) {
+        const Range2Di a = previous.padded(Vector2i(1));
+        const Range2Di b = second[0].padded(Vector2i(1));
+        CORRADE_VERIFY(a.right() <= b.left() || b.right() <= a.left() ||
+                       a.top() <= b.bottom() || b.top() <= a.bottom());
+    }
+}
+
+void GlyphCacheGLTest::reserveTooLarge() {
+    Text::GlyphCache cache(Vector2i(64));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(cache.reserve({{48, 48}, {32, 32}}).empty());
+    CORRADE_COMPARE(out.str(), "Text::GlyphCache::reserve(): cache of size Vector(64, 64) is too small to fit 2 more glyphs\n");
+}
+
+namespace {
+
+/* Maps lowercase letters to glyphs 1-26, the rest to "Not Found" glyph */
+class TestFont: public Text::AbstractFont {
+    public:
+        std::u32string filled;
+
+    private:
+        Features doFeatures() const override { return Feature::OpenData; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(const char32_t character) override {
+            return character >= U'a' && character <= U'z' ? character - U'a' + 1 : 0;
+        }
+
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        void doFillGlyphCache(GlyphCache& cache, const std::u32string& characters) override {
+            filled += characters;
+
+            const std::vector<Range2Di> ranges = cache.reserve(std::vector<Vector2i>(characters.size(), Vector2i{4}));
+            for(std::size_t i = 0; i != characters.size(); ++i)
+                cache.insert(doGlyphId(characters[i]), {}, ranges[i]);
+        }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+};
+
+}
+
+void GlyphCacheGLTest::fillIncremental() {
+    Text::GlyphCache cache(Vector2i(64));
+    TestFont font;
+
+    font.fillGlyphCache(cache, "ab");
+    CORRADE_VERIFY(font.filled == U"ab");
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+
+    /* Only characters that are not in the cache yet get filled, the ones
+       mapping to "Not Found" glyph are skipped as well */
+    font.filled.clear();
+    font.fillGlyphCache(cache, "ba?c");
+    CORRADE_VERIFY(font.filled == U"c");
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+
+    /* Nothing left to fill, the implementation is not called at all */
+    font.filled.clear();
+    font.fillGlyphCache(cache, "cab");
+    CORRADE_VERIFY(font.filled.empty());
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+}
+
+void GlyphCacheGLTest::eviction() {
+    Text::GlyphCache cache(Vector2i(32));
+    cache.setEvictionEnabled(true);
+    CORRADE_VERIFY(cache.isEvictionEnabled());
+
+    const std::vector<Range2Di> glyphs = cache.reserve({{16, 32}, {16, 32}});
+    CORRADE_COMPARE(glyphs.size(), 2);
+    cache.insert(1, {}, glyphs[0]);
+    cache.insert(2, {}, glyphs[1]);
+    CORRADE_VERIFY(cache.evictedGlyphs().empty());
+
+    /* Looking up the glyph doesn't affect eviction, marking it does */
+    CORRADE_COMPARE(cache[2].second, glyphs[1]);
+    cache.use(1);
+
+    /* Least recently used glyph gets evicted */
+    CORRADE_COMPARE(cache.reserve({{16, 32}}), (std::vector<Range2Di>{glyphs[1]}));
+    CORRADE_COMPARE(cache.evictedGlyphs(), (std::vector<UnsignedInt>{2}));
+    CORRADE_COMPARE(cache.glyphCount(), 2);
+    CORRADE_COMPARE(cache[2].second, Range2Di{});
+}
+
+void GlyphCacheGLTest::evictionFill() {
+    Text::GlyphCache cache(Vector2i(8));
+    cache.setEvictionEnabled(true);
+    TestFont font;
+
+    font.fillGlyphCache(cache, "abcd");
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+
+    /* Filling already present glyphs marks them as used, so the least
+       recently used one gets evicted to make space for the new one */
+    font.fillGlyphCache(cache, "bcde");
+    CORRADE_COMPARE(cache.evictedGlyphs(), (std::vector<UnsignedInt>{1}));
+    CORRADE_VERIFY(!cache.contains(1));
+    CORRADE_VERIFY(cache.contains(5));
+}
+
 }}}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::GlyphCacheGLTest)
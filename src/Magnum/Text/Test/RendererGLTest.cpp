@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+
 #include "Magnum/Test/AbstractOpenGLTester.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/Renderer.h"
@@ -33,6 +35,8 @@ struct RendererGLTest: Magnum::Test::AbstractOpenGLTester {
     explicit RendererGLTest();
 
     void renderData();
+    void renderDataPreallocated();
+    void renderDataPreallocatedTooSmall();
     void renderMesh();
     void renderMeshIndexType();
     void mutableText();
@@ -42,6 +46,8 @@ struct RendererGLTest: Magnum::Test::AbstractOpenGLTester {
 
 RendererGLTest::RendererGLTest() {
     addTests({&RendererGLTest::renderData,
+              &RendererGLTest::renderDataPreallocated,
+              &RendererGLTest::renderDataPreallocatedTooSmall,
               &RendererGLTest::renderMesh,
               &RendererGLTest::renderMeshIndexType,
               &RendererGLTest::mutableText,
@@ -170,6 +176,47 @@ void RendererGLTest::renderData() {
     }));
 }
 
+void RendererGLTest::renderDataPreallocated() {
+    TestFont font;
+    std::vector<Vector2> expectedPositions;
+    std::vector<Vector2> expectedTextureCoordinates;
+    Range2D expectedBounds;
+    std::tie(expectedPositions, expectedTextureCoordinates, std::ignore, expectedBounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "abc\nab", Alignment::MiddleRightIntegral);
+
+    /* Output larger than needed, the rest is left untouched */
+    GlyphQuad glyphs[3];
+    Vector2 positions[24];
+    Vector2 textureCoordinates[24];
+    UnsignedInt glyphCount;
+    Range2D bounds;
+    std::tie(glyphCount, bounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, {"abc\nab", 6}, glyphs, positions, textureCoordinates, Alignment::MiddleRightIntegral);
+
+    CORRADE_COMPARE(glyphCount, 5);
+    CORRADE_COMPARE(bounds, expectedBounds);
+    CORRADE_COMPARE(std::vector<Vector2>(positions, positions + glyphCount*4), expectedPositions);
+    CORRADE_COMPARE(std::vector<Vector2>(textureCoordinates, textureCoordinates + glyphCount*4), expectedTextureCoordinates);
+    CORRADE_COMPARE(positions[20], Vector2());
+}
+
+void RendererGLTest::renderDataPreallocatedTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    TestFont font;
+    GlyphQuad glyphs[3];
+    Vector2 positions[12];
+    Vector2 textureCoordinates[12];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, {"abcd", 4}, glyphs, positions, textureCoordinates);
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, {"abc\nab", 6}, glyphs, positions, textureCoordinates);
+    CORRADE_COMPARE(out.str(),
+        "Text::AbstractRenderer::render(): glyph array of size 3 too small to layout 4 glyphs\n"
+        "Text::AbstractRenderer::render(): expected at least 20 vertices but got 12 positions and 12 texture coordinates\n");
+}
+
 void RendererGLTest::renderMesh() {
     TestFont font;
     Mesh mesh{NoCreate};
@@ -39,10 +39,19 @@ class AbstractFont;
 class AbstractFontConverter;
 class AbstractLayouter;
 class DistanceFieldGlyphCache;
+class GlyphAllocator;
 class GlyphCache;
+struct GlyphQuad;
 
 enum class Alignment: UnsignedByte;
 
+template<UnsignedInt> class Batch;
+typedef Batch<2> Batch2D;
+typedef Batch<3> Batch3D;
+template<UnsignedInt> class BatchRenderer;
+typedef BatchRenderer<2> BatchRenderer2D;
+typedef BatchRenderer<3> BatchRenderer3D;
+
 class AbstractRenderer;
 template<UnsignedInt> class Renderer;
 typedef Renderer<2> Renderer2D;
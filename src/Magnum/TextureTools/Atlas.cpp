@@ -25,37 +25,150 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+AtlasPacker::AtlasPacker(const Vector2i& size, const Vector2i& padding): _size{size}, _padding{padding} {
+    clear();
+}
+
+Float AtlasPacker::occupancy() const {
+    return _size.product() ? Float(Double(_occupiedArea)/_size.product()) : 0.0f;
+}
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
+void AtlasPacker::clear() {
+    /* Initially the whole atlas is free */
+    _skyline.assign(1, SkylineSegment{0, 0, _size.x()});
+    _occupiedArea = 0;
+}
 
-    std::vector<Range2Di> atlas;
+Int AtlasPacker::fit(const std::size_t segment, const Vector2i& size) const {
+    if(_skyline[segment].x + size.x() > _size.x()) return -1;
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
-        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
-                << "textures. Generated atlas will be empty.";
-        return atlas;
+    Int y = _skyline[segment].y;
+    Int widthLeft = size.x();
+    for(std::size_t i = segment; widthLeft > 0; ++i) {
+        CORRADE_INTERNAL_ASSERT(i < _skyline.size());
+        y = Math::max(y, _skyline[i].y);
+        if(y + size.y() > _size.y()) return -1;
+        widthLeft -= _skyline[i].width;
+    }
+
+    return y;
+}
+
+void AtlasPacker::place(const std::size_t segment, const Vector2i& position, const Vector2i& size) {
+    _skyline.insert(_skyline.begin() + segment, SkylineSegment{position.x(), position.y() + size.y(), size.x()});
+
+    /* Shrink or remove the segments that are now covered by the new one */
+    for(std::size_t i = segment + 1; i < _skyline.size(); ) {
+        const SkylineSegment& previous = _skyline[i - 1];
+        const Int shrink = previous.x + previous.width - _skyline[i].x;
+        if(shrink <= 0) break;
+
+        if(_skyline[i].width <= shrink) {
+            _skyline.erase(_skyline.begin() + i);
+            continue;
+        }
+
+        _skyline[i].x += shrink;
+        _skyline[i].width -= shrink;
+        break;
+    }
+
+    /* Merge neighboring segments on the same height */
+    for(std::size_t i = 1; i < _skyline.size(); ) {
+        if(_skyline[i - 1].y == _skyline[i].y) {
+            _skyline[i - 1].width += _skyline[i].width;
+            _skyline.erase(_skyline.begin() + i);
+        } else ++i;
+    }
+
+    _occupiedArea += size.product();
+}
+
+std::vector<Range2Di> AtlasPacker::add(const std::vector<Vector2i>& sizes, const AtlasFlags flags) {
+    CORRADE_ASSERT(!sizes.empty(),
+        "TextureTools::AtlasPacker::add(): no textures to add", {});
+
+    /* Packing order, optionally the tallest textures first */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    if(flags & AtlasFlag::SortByHeight) std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        return sizes[a].y() > sizes[b].y() || (sizes[a].y() == sizes[b].y() && sizes[a].x() > sizes[b].x());
+    });
+
+    /* Save the state so it can be restored if the textures don't fit */
+    const std::vector<SkylineSegment> previousSkyline = _skyline;
+    const std::size_t previousOccupiedArea = _occupiedArea;
+
+    std::vector<Range2Di> atlas(sizes.size());
+    for(const std::size_t i: order) {
+        /* Padding stays in atlas space, only the texture itself is rotated */
+        const Vector2i paddedSize = sizes[i] + 2*_padding;
+        const Vector2i rotatedPaddedSize = Vector2i{sizes[i].y(), sizes[i].x()} + 2*_padding;
+
+        /* Nothing to place, don't pollute the skyline with empty segments */
+        if(!paddedSize.product()) {
+            atlas[i] = Range2Di::fromSize(_padding, sizes[i]);
+            continue;
+        }
+
+        /* Find position where the top edge of the texture is lowest */
+        std::size_t bestSegment = _skyline.size();
+        Int bestY{}, bestTop{};
+        bool bestRotated = false;
+        for(std::size_t segment = 0; segment != _skyline.size(); ++segment) {
+            for(const bool rotated: {false, true}) {
+                if(rotated && !(flags & AtlasFlag::AllowRotation)) break;
+
+                const Vector2i size = rotated ? rotatedPaddedSize : paddedSize;
+                const Int y = fit(segment, size);
+                if(y == -1) continue;
+
+                if(bestSegment == _skyline.size() || y + size.y() < bestTop) {
+                    bestSegment = segment;
+                    bestY = y;
+                    bestTop = y + size.y();
+                    bestRotated = rotated;
+                }
+            }
+        }
+
+        /* Doesn't fit, revert everything added so far */
+        if(bestSegment == _skyline.size()) {
+            _skyline = previousSkyline;
+            _occupiedArea = previousOccupiedArea;
+            return {};
+        }
+
+        const Vector2i position{_skyline[bestSegment].x, bestY};
+        place(bestSegment, position, bestRotated ? rotatedPaddedSize : paddedSize);
+
+        atlas[i] = Range2Di::fromSize(position + _padding, bestRotated ? Vector2i{sizes[i].y(), sizes[i].x()} : sizes[i]);
     }
 
-    /** @todo actual magic implementation, not this joke */
+    return atlas;
+}
 
-    atlas.reserve(sizes.size());
-    for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Range2Di::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
+std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, const AtlasFlags flags, Float* const occupancy) {
+    if(occupancy) *occupancy = 0.0f;
+    if(sizes.empty()) return {};
+
+    AtlasPacker packer{atlasSize, padding};
+    std::vector<Range2Di> atlas = packer.add(sizes, flags);
+    if(atlas.empty()) {
+        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
+                << "is too small to fit" << sizes.size() << "textures. Generated atlas will be empty.";
+        return atlas;
+    }
 
+    if(occupancy) *occupancy = packer.occupancy();
     return atlas;
 }
 
@@ -26,10 +26,11 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::atlas()
+ * @brief Class @ref Magnum::TextureTools::AtlasPacker, function @ref Magnum::TextureTools::atlas(), enum @ref Magnum::TextureTools::AtlasFlag, enum set @ref Magnum::TextureTools::AtlasFlags
  */
 
 #include <vector>
+#include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Vector2.h"
@@ -37,20 +38,129 @@
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Atlas packing flag
+
+@see @ref AtlasFlags, @ref atlas()
+*/
+enum class AtlasFlag: UnsignedByte {
+    /**
+     * Sort the textures by height before packing them. Textures of similar
+     * height are then placed next to each other, which usually results in
+     * considerably tighter packing. Enabled by default.
+     */
+    SortByHeight = 1 << 0,
+
+    /**
+     * Allow rotating the textures by 90° if it results in better packing.
+     * Rotated textures have the returned range size flipped compared to
+     * the original size. Note that the texture contents need to be rotated
+     * accordingly when copying them into the atlas.
+     */
+    AllowRotation = 1 << 1
+};
+
+/**
+@brief Atlas packing flags
+
+@see @ref atlas()
+*/
+typedef Containers::EnumSet<AtlasFlag> AtlasFlags;
+
+CORRADE_ENUMSET_OPERATORS(AtlasFlags)
+
+/**
+@brief Incremental texture atlas packer
+
+Keeps track of free space in the atlas between calls to @ref add(), so more
+textures can be added to an already populated atlas later. Uses the same
+skyline bottom-left packing as @ref atlas(), see its documentation for more
+information.
+@code
+TextureTools::AtlasPacker packer{Vector2i{512}, Vector2i{1}};
+std::vector<Range2Di> first = packer.add(sizes);
+// ...
+std::vector<Range2Di> second = packer.add(moreSizes);
+@endcode
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each texture
+         */
+        explicit AtlasPacker(const Vector2i& size, const Vector2i& padding = Vector2i());
+
+        /** @brief Atlas size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Padding around each texture */
+        Vector2i padding() const { return _padding; }
+
+        /**
+         * @brief Fraction of atlas area that is occupied
+         *
+         * Includes padding around the textures.
+         */
+        Float occupancy() const;
+
+        /**
+         * @brief Add textures to the atlas
+         * @param sizes     Sizes of the textures to add
+         * @param flags     Packing flags
+         *
+         * Returns non-overlapping ranges that don't overlap with any textures
+         * added previously either, in the same order as @p sizes and without
+         * padding. Either all textures are added or, if they don't fit, an
+         * empty vector is returned and the packer state is not changed.
+         * Expects that @p sizes is not empty, so an empty return value always
+         * means the textures didn't fit.
+         */
+        std::vector<Range2Di> add(const std::vector<Vector2i>& sizes, AtlasFlags flags = AtlasFlag::SortByHeight);
+
+        /** @brief Remove all textures from the atlas */
+        void clear();
+
+    private:
+        /* One horizontal segment of the skyline -- [x, x + width) range of
+           columns that are all occupied up to y */
+        struct SkylineSegment {
+            Int x, y, width;
+        };
+
+        Int MAGNUM_LOCAL fit(std::size_t segment, const Vector2i& size) const;
+        void MAGNUM_LOCAL place(std::size_t segment, const Vector2i& position, const Vector2i& size);
+
+        Vector2i _size, _padding;
+        std::vector<SkylineSegment> _skyline;
+        std::size_t _occupiedArea;
+};
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
 @param sizes        Sizes of all textures in the atlas
 @param padding      Padding around each texture
+@param flags        Packing flags
+@param occupancy    If not `nullptr`, fraction of atlas area covered by the
+    packed textures (including padding) is saved there
 
 Packs many small textures into one larger. If the textures cannot be packed
 into required size, empty vector is returned.
 
+The textures are packed using the skyline bottom-left heuristic --- the
+atlas keeps track of the topmost occupied position in each column and each
+texture is placed where its top edge ends up lowest. Compared to laying the
+textures out in a uniform grid this wastes considerably less space for
+textures of varying sizes, such as glyphs.
+
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
-padding.
+padding, returned ranges are in the same order as @p sizes.
+@see @ref AtlasPacker
 */
-std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
+std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i(), AtlasFlags flags = AtlasFlag::SortByHeight, Float* occupancy = nullptr);
 
 }}
 
@@ -36,15 +36,31 @@ struct AtlasTest: TestSuite::Tester {
 
     void create();
     void createPadding();
+    void createOccupancy();
+    void createNoSorting();
+    void createRotation();
+    void createRotationPadding();
     void createEmpty();
     void createTooSmall();
+
+    void packerIncremental();
+    void packerTooSmall();
+    void packerClear();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
+              &AtlasTest::createOccupancy,
+              &AtlasTest::createNoSorting,
+              &AtlasTest::createRotation,
+              &AtlasTest::createRotationPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+
+              &AtlasTest::packerIncremental,
+              &AtlasTest::packerTooSmall,
+              &AtlasTest::packerClear});
 }
 
 void AtlasTest::create() {
@@ -56,9 +72,9 @@ void AtlasTest::create() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({0, 0}, {12, 18}),
-        Range2Di::fromSize({32, 0}, {32, 15}),
-        Range2Di::fromSize({0, 25}, {23, 25})}));
+        Range2Di::fromSize({23, 0}, {12, 18}),
+        Range2Di::fromSize({23, 18}, {32, 15}),
+        Range2Di::fromSize({0, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -70,9 +86,49 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({2, 1}, {8, 16}),
-        Range2Di::fromSize({34, 1}, {28, 13}),
-        Range2Di::fromSize({2, 26}, {19, 23})}));
+        Range2Di::fromSize({25, 1}, {8, 16}),
+        Range2Di::fromSize({25, 19}, {28, 13}),
+        Range2Di::fromSize({2, 1}, {19, 23})}));
+}
+
+void AtlasTest::createOccupancy() {
+    Float occupancy;
+    std::vector<Range2Di> atlas = TextureTools::atlas({64, 64}, {
+        {8, 16},
+        {28, 13},
+        {19, 23}
+    }, {2, 1}, AtlasFlag::SortByHeight, &occupancy);
+
+    CORRADE_COMPARE(atlas.size(), 3);
+    CORRADE_COMPARE(occupancy, (12*18 + 32*15 + 23*25)/4096.0f);
+}
+
+void AtlasTest::createNoSorting() {
+    std::vector<Range2Di> atlas = TextureTools::atlas({64, 64}, {
+        {12, 18},
+        {32, 15},
+        {23, 25}
+    }, {}, {});
+
+    CORRADE_COMPARE(atlas.size(), 3);
+    CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 0}, {12, 18}),
+        Range2Di::fromSize({12, 0}, {32, 15}),
+        Range2Di::fromSize({12, 15}, {23, 25})}));
+}
+
+void AtlasTest::createRotation() {
+    /* Fits only if rotated */
+    std::vector<Range2Di> atlas = TextureTools::atlas({32, 8}, {{8, 32}}, {}, AtlasFlag::AllowRotation);
+    CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 0}, {32, 8})}));
+}
+
+void AtlasTest::createRotationPadding() {
+    /* Fits only if rotated, padding is not rotated with the texture */
+    std::vector<Range2Di> atlas = TextureTools::atlas({36, 10}, {{8, 32}}, {2, 1}, AtlasFlag::AllowRotation);
+    CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
+        Range2Di::fromSize({2, 1}, {32, 8})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -84,13 +140,53 @@ void AtlasTest::createTooSmall() {
     std::ostringstream o;
     Error redirectError{&o};
 
-    std::vector<Range2Di> atlas = TextureTools::atlas({64, 32}, {
+    std::vector<Range2Di> atlas = TextureTools::atlas({32, 32}, {
         {8, 16},
         {21, 13},
         {19, 29}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(32, 32) is too small to fit 3 textures. Generated atlas will be empty.\n");
+}
+
+void AtlasTest::packerIncremental() {
+    AtlasPacker packer{Vector2i{64}};
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+
+    CORRADE_COMPARE(packer.add({{12, 18}, {32, 15}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 0}, {12, 18}),
+        Range2Di::fromSize({12, 0}, {32, 15})}));
+    CORRADE_COMPARE(packer.occupancy(), (12*18 + 32*15)/4096.0f);
+
+    /* Second batch is placed around the first one */
+    CORRADE_COMPARE(packer.add({{23, 25}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({12, 15}, {23, 25})}));
+    CORRADE_COMPARE(packer.occupancy(), (12*18 + 32*15 + 23*25)/4096.0f);
+}
+
+void AtlasTest::packerTooSmall() {
+    AtlasPacker packer{Vector2i{32}};
+    CORRADE_COMPARE(packer.add({{32, 16}}).size(), 1);
+
+    /* Nothing is added if the whole batch doesn't fit */
+    CORRADE_VERIFY(packer.add({{32, 8}, {16, 16}}).empty());
+    CORRADE_COMPARE(packer.occupancy(), 0.5f);
+
+    /* The state is preserved */
+    CORRADE_COMPARE(packer.add({{32, 16}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 16}, {32, 16})}));
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+}
+
+void AtlasTest::packerClear() {
+    AtlasPacker packer{Vector2i{32}, Vector2i{1}};
+    CORRADE_COMPARE(packer.add({{30, 30}}).size(), 1);
+    CORRADE_VERIFY(packer.add({{30, 30}}).empty());
+
+    packer.clear();
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+    CORRADE_COMPARE(packer.add({{30, 30}}), (std::vector<Range2Di>{
+        Range2Di::fromSize({1, 1}, {30, 30})}));
 }
 
 }}}
@@ -39,11 +39,41 @@ namespace Magnum { namespace Text {
 struct MagnumFont::Data {
     Utility::Configuration conf;
     Trade::ImageData2D image;
+    /* Characters from the Basic Multilingual Plane are looked up directly,
+       the rest is in a hash map. Glyph 0 is the "Not Found" glyph, so zero
+       entries in the flat array mean the character has no glyph. */
+    std::vector<UnsignedInt> glyphIdBmp;
     std::unordered_map<char32_t, UnsignedInt> glyphId;
     std::vector<Vector2> glyphAdvance;
+
+    UnsignedInt findGlyphId(const char32_t character) const {
+        if(character < glyphIdBmp.size()) return glyphIdBmp[character];
+        if(character < 0x10000 || glyphId.empty()) return 0;
+        const auto it = glyphId.find(character);
+        return it != glyphId.end() ? it->second : 0;
+    }
 };
 
 namespace {
+    std::tuple<Range2D, Range2D, Vector2> renderGlyph(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float scale, const UnsignedInt glyph) {
+        /* Position of the texture in the resulting glyph, texture coordinates */
+        Vector2i position;
+        Range2Di rectangle;
+        std::tie(position, rectangle) = cache[glyph];
+
+        /* Normalized texture coordinates */
+        const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(cache.textureSize()));
+
+        /* Quad rectangle, computed from texture rectangle, denormalized to
+           requested text size */
+        const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(scale));
+
+        /* Advance for given glyph, denormalized to requested text size */
+        const Vector2 advance = glyphAdvance[glyph]*scale;
+
+        return std::make_tuple(quadRectangle, textureCoordinates, advance);
+    }
+
     class MagnumFontLayouter: public AbstractLayouter {
         public:
             explicit MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, std::vector<UnsignedInt>&& glyphs);
@@ -145,7 +175,7 @@ std::pair<Float, Float> MagnumFont::doOpenFile(const std::string& filename, Floa
 
 std::pair<Float, Float> MagnumFont::openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image) {
     /* Everything okay, save the data internally */
-    _opened = new Data{std::move(conf), std::move(image), std::unordered_map<char32_t, UnsignedInt>{}, {}};
+    _opened = new Data{std::move(conf), std::move(image), {}, {}, {}};
 
     /* Glyph advances */
     const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
@@ -158,7 +188,13 @@ std::pair<Float, Float> MagnumFont::openInternal(Utility::Configuration&& conf,
     for(const Utility::ConfigurationGroup* const c: chars) {
         const UnsignedInt glyphId = c->value<UnsignedInt>("glyph");
         CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphAdvance.size());
-        _opened->glyphId.emplace(c->value<char32_t>("unicode"), glyphId);
+        const char32_t character = c->value<char32_t>("unicode");
+        if(character < 0x10000) {
+            if(character >= _opened->glyphIdBmp.size())
+                _opened->glyphIdBmp.resize(character + 1, 0);
+            if(!_opened->glyphIdBmp[character])
+                _opened->glyphIdBmp[character] = glyphId;
+        } else _opened->glyphId.emplace(character, glyphId);
     }
 
     return {_opened->conf.value<Float>("fontSize"), _opened->conf.value<Float>("lineHeight")};
@@ -170,8 +206,7 @@ void MagnumFont::doClose() {
 }
 
 UnsignedInt MagnumFont::doGlyphId(const char32_t character) {
-    auto it = _opened->glyphId.find(character);
-    return it != _opened->glyphId.end() ? it->second : 0;
+    return _opened->findGlyphId(character);
 }
 
 Vector2 MagnumFont::doGlyphAdvance(const UnsignedInt glyph) {
@@ -201,34 +236,33 @@ std::unique_ptr<AbstractLayouter> MagnumFont::doLayout(const GlyphCache& cache,
     for(std::size_t i = 0; i != text.size(); ) {
         UnsignedInt codepoint;
         std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
-        const auto it = _opened->glyphId.find(codepoint);
-        glyphs.push_back(it == _opened->glyphId.end() ? 0 : it->second);
+        glyphs.push_back(_opened->findGlyphId(codepoint));
     }
 
     return std::unique_ptr<MagnumFontLayouter>(new MagnumFontLayouter(_opened->glyphAdvance, cache, this->size(), size, std::move(glyphs)));
 }
 
-namespace {
-
-MagnumFontLayouter::MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
+UnsignedInt MagnumFont::doLayoutInto(const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::ArrayView<GlyphQuad> glyphs) {
+    /* Render the glyphs directly, without going through a layouter */
+    UnsignedInt glyphCount = 0;
+    for(std::size_t i = 0; i != text.size(); ++glyphCount) {
+        char32_t codepoint;
+        std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
+        if(glyphCount >= glyphs.size()) continue;
 
-std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const UnsignedInt i) {
-    /* Position of the texture in the resulting glyph, texture coordinates */
-    Vector2i position;
-    Range2Di rectangle;
-    std::tie(position, rectangle) = cache[glyphs[i]];
+        GlyphQuad& glyph = glyphs[glyphCount];
+        std::tie(glyph.position, glyph.textureCoordinates, glyph.advance) = renderGlyph(_opened->glyphAdvance, cache, size/this->size(), _opened->findGlyphId(codepoint));
+    }
 
-    /* Normalized texture coordinates */
-    const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(cache.textureSize()));
+    return glyphCount;
+}
 
-    /* Quad rectangle, computed from texture rectangle, denormalized to
-       requested text size */
-    const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(textSize/fontSize));
+namespace {
 
-    /* Advance for given glyph, denormalized to requested text size */
-    const Vector2 advance = glyphAdvance[glyphs[i]]*(textSize/fontSize);
+MagnumFontLayouter::MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
 
-    return std::make_tuple(quadRectangle, textureCoordinates, advance);
+std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const UnsignedInt i) {
+    return renderGlyph(glyphAdvance, cache, textSize/fontSize, glyphs[i]);
 }
 
 }
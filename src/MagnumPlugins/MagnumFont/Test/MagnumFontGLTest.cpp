@@ -39,12 +39,14 @@ class MagnumFontGLTest: public Magnum::Test::AbstractOpenGLTester {
 
         void properties();
         void layout();
+        void layoutInto();
         void createGlyphCache();
 };
 
 MagnumFontGLTest::MagnumFontGLTest() {
     addTests({&MagnumFontGLTest::properties,
               &MagnumFontGLTest::layout,
+              &MagnumFontGLTest::layoutInto,
               &MagnumFontGLTest::createGlyphCache});
 }
 
@@ -99,6 +101,39 @@ void MagnumFontGLTest::layout() {
     CORRADE_COMPARE(cursorPosition, Vector2(0.375f, 0.0f));
 }
 
+void MagnumFontGLTest::layoutInto() {
+    MagnumFont font;
+    CORRADE_VERIFY(font.openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
+
+    GlyphCache cache(Vector2i(256));
+    cache.insert(font.glyphId(U'W'), {25, 34}, {{0, 8}, {16, 128}});
+    cache.insert(font.glyphId(U'e'), {25, 12}, {{16, 4}, {64, 32}});
+
+    /* Same as above, except that 'a' is a two-byte character */
+    GlyphQuad glyphs[4];
+    CORRADE_COMPARE(font.layout(cache, 0.5f, {"W\xc3\xa1ve", 5}, glyphs), 4);
+
+    /* 'W' */
+    CORRADE_COMPARE(glyphs[0].position, Range2D({0.78125f, 1.0625f}, {1.28125f, 4.8125f}));
+    CORRADE_COMPARE(glyphs[0].textureCoordinates, Range2D({0, 0.03125f}, {0.0625f, 0.5f}));
+    CORRADE_COMPARE(glyphs[0].advance, Vector2(0.71875f, 0.0f));
+
+    /* 'a' with acute (not found) */
+    CORRADE_COMPARE(glyphs[1].position, Range2D());
+    CORRADE_COMPARE(glyphs[1].textureCoordinates, Range2D());
+    CORRADE_COMPARE(glyphs[1].advance, Vector2(0.25f, 0.0f));
+
+    /* 'e' */
+    CORRADE_COMPARE(glyphs[3].position, Range2D({0.78125f, 0.375f}, {2.28125f, 1.25f}));
+    CORRADE_COMPARE(glyphs[3].textureCoordinates, Range2D({0.0625f, 0.015625f}, {0.25f, 0.125f}));
+    CORRADE_COMPARE(glyphs[3].advance, Vector2(0.375f, 0.0f));
+
+    /* Too small output, only the glyph count is returned for the rest */
+    GlyphQuad small[2];
+    CORRADE_COMPARE(font.layout(cache, 0.5f, {"Wave", 4}, small), 4);
+    CORRADE_COMPARE(small[0].advance, Vector2(0.71875f, 0.0f));
+}
+
 void MagnumFontGLTest::createGlyphCache() {
     MagnumFont font;
     CORRADE_VERIFY(font.openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
@@ -25,11 +25,15 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
-#include <limits>
-#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
-#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/String.h>
 
 #include "Magnum/Mesh.h"
@@ -38,61 +42,192 @@
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/MeshData3D.h"
 
-#if defined(CORRADE_TARGET_NACL_NEWLIB) || defined(CORRADE_TARGET_ANDROID)
-#include <sstream>
+#ifdef CORRADE_TARGET_UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 namespace Magnum { namespace Trade {
 
 struct ObjImporter::File {
+    ~File();
+
     std::unordered_map<std::string, UnsignedInt> meshesForName;
     std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    std::unique_ptr<std::istream> in;
+    std::vector<std::tuple<std::size_t, std::size_t, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
+
+    /* View on the whole file contents, pointing either to the owned copy or
+       to the memory-mapped file */
+    Containers::ArrayView<const char> data;
+    Containers::Array<char> storage;
+    #ifdef CORRADE_TARGET_UNIX
+    void* mapped{};
+    std::size_t mappedSize{};
+    #endif
 };
 
+ObjImporter::File::~File() {
+    #ifdef CORRADE_TARGET_UNIX
+    if(mapped) munmap(mapped, mappedSize);
+    #endif
+}
+
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+inline bool isWhitespace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
 }
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(std::string str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
-        throw 0;
+inline bool isDigit(const char c) {
+    return c >= '0' && c <= '9';
+}
+
+/* Returns pointer to the end of current line (i.e., to the newline character
+   or to the end of the data) */
+inline const char* lineEnd(const char* const begin, const char* const end) {
+    const char* const found = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    return found ? found : end;
+}
+
+inline const char* skipWhitespace(const char* it, const char* const end) {
+    while(it != end && isWhitespace(*it)) ++it;
+    return it;
+}
+
+inline const char* tokenEnd(const char* it, const char* const end) {
+    while(it != end && !isWhitespace(*it)) ++it;
+    return it;
+}
+
+inline const char* trimEnd(const char* const begin, const char* end) {
+    while(end != begin && isWhitespace(*(end - 1))) --end;
+    return end;
+}
+
+template<std::size_t size> inline bool equals(const char* const begin, const char* const end, const char(&string)[size]) {
+    return std::size_t(end - begin) == size - 1 && std::memcmp(begin, string, size - 1) == 0;
+}
+
+/* Parses unsigned integer spanning the whole [begin, end) range, fails on
+   overflow */
+bool parseUnsigned(const char* it, const char* const end, UnsignedInt& out) {
+    if(it == end) return false;
+
+    UnsignedInt value = 0;
+    for(; it != end; ++it) {
+        if(!isDigit(*it)) return false;
+
+        /* Reject values that don't fit */
+        const UnsignedInt digit = *it - '0';
+        if(value > (~UnsignedInt{} - digit)/10) return false;
+        value = value*10 + digit;
     }
 
-    Math::Vector<size, Float> output;
+    out = value;
+    return true;
+}
 
-    #if defined(CORRADE_TARGET_NACL_NEWLIB) || defined(CORRADE_TARGET_ANDROID)
-    std::istringstream in;
-    #endif
+/* Parses decimal floating-point number spanning the whole [begin, end)
+   range. Mantissa is accumulated in a 64-bit integer and scaled by an exactly
+   representable power of ten where possible, which gives correctly rounded
+   results for all values commonly found in OBJ files. */
+bool parseFloat(const char* it, const char* const end, Float& out) {
+    constexpr Double Powers[]{1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5,
+        1.0e6, 1.0e7, 1.0e8, 1.0e9, 1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14,
+        1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+    constexpr std::uint64_t MantissaLimit = 100000000000000000ull;
+
+    bool negative = false;
+    if(it != end && (*it == '-' || *it == '+')) {
+        negative = *it == '-';
+        ++it;
+    }
+
+    /* Integral part, digits that don't fit into mantissa only scale it */
+    std::uint64_t mantissa = 0;
+    Int exponent = 0;
+    bool hasDigits = false;
+    for(; it != end && isDigit(*it); ++it) {
+        hasDigits = true;
+        if(mantissa < MantissaLimit) mantissa = mantissa*10 + (*it - '0');
+        else ++exponent;
+    }
+
+    /* Fractional part, superfluous digits are ignored */
+    if(it != end && *it == '.') for(++it; it != end && isDigit(*it); ++it) {
+        hasDigits = true;
+        if(mantissa < MantissaLimit) {
+            mantissa = mantissa*10 + (*it - '0');
+            --exponent;
+        }
+    }
+
+    if(!hasDigits) return false;
+
+    /* Exponent */
+    if(it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        bool negativeExponent = false;
+        if(it != end && (*it == '-' || *it == '+')) {
+            negativeExponent = *it == '-';
+            ++it;
+        }
+
+        if(it == end || !isDigit(*it)) return false;
+        Int explicitExponent = 0;
+        for(; it != end && isDigit(*it); ++it)
+            if(explicitExponent < 10000) explicitExponent = explicitExponent*10 + (*it - '0');
+
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    /* Garbage after the number */
+    if(it != end) return false;
+
+    Double value = Double(mantissa);
+    if(exponent < 0) {
+        if(exponent >= -22) value /= Powers[-exponent];
+        else value *= std::pow(10.0, exponent);
+    } else if(exponent > 0) {
+        if(exponent <= 22) value *= Powers[exponent];
+        else value *= std::pow(10.0, exponent);
+    }
+
+    out = Float(negative ? -value : value);
+    return true;
+}
+
+/* Extracts whitespace-separated float data from the [begin, end) range */
+template<std::size_t size> bool extractFloatData(const char* it, const char* const end, Math::Vector<size, Float>& output, Float* extra = nullptr) {
+    /* Find the tokens first, so the count is checked before conversion */
+    const char* tokens[size + 1][2];
+    std::size_t count = 0;
+    for(it = skipWhitespace(it, end); it != end; it = skipWhitespace(it, end)) {
+        if(count == size + (extra ? 1 : 0)) {
+            Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
+            return false;
+        }
+
+        tokens[count][0] = it;
+        it = tokenEnd(it, end);
+        tokens[count++][1] = it;
+    }
 
-    for(std::size_t i = 0; i != size; ++i) {
-        #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-        output[i] = std::stof(data[i]);
-        #else
-        in.str(data[i]);
-        in >> output[i];
-        #endif
+    if(count < size) {
+        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
+        return false;
     }
 
-    if(data.size() == size+1) {
-        /* This should be obvious from the first if, but add this just to make
-           Clang Analyzer happy */
-        CORRADE_INTERNAL_ASSERT(extra);
-
-        #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-        *extra = std::stof(data.back());
-        #else
-        in.str(data.back());
-        in >> *extra;
-        #endif
+    for(std::size_t i = 0; i != count; ++i) {
+        if(!parseFloat(tokens[i][0], tokens[i][1], i == size ? *extra : output[i])) {
+            Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+            return false;
+        }
     }
 
-    return output;
+    return true;
 }
 
 template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
@@ -120,20 +255,48 @@ void ObjImporter::doClose() { _file.reset(); }
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
 void ObjImporter::doOpenFile(const std::string& filename) {
-    std::unique_ptr<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
+    /* Memory-map the file where possible to avoid copying potentially huge
+       files around, fall back to reading it whole elsewhere */
+    #ifdef CORRADE_TARGET_UNIX
+    const int fd = ::open(filename.data(), O_RDONLY);
+    struct stat st;
+    if(fd == -1 || fstat(fd, &st) == -1) {
+        if(fd != -1) ::close(fd);
         Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
         return;
     }
 
-    _file.reset(new File);
-    _file->in = std::move(in);
+    std::unique_ptr<File> file{new File};
+
+    /* Mapping an empty file fails, nothing to map in that case anyway */
+    if(st.st_size) {
+        void* const mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED) {
+            ::close(fd);
+            Error() << "Trade::ObjImporter::openFile(): cannot map file" << filename;
+            return;
+        }
+
+        file->mapped = mapped;
+        file->mappedSize = st.st_size;
+        file->data = {static_cast<const char*>(mapped), file->mappedSize};
+    }
+
+    /* The mapping stays valid after closing the descriptor */
+    ::close(fd);
+
+    _file = std::move(file);
     parseMeshNames();
+    #else
+    AbstractImporter::doOpenFile(filename);
+    #endif
 }
 
 void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
     _file.reset(new File);
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+    _file->storage = Containers::Array<char>{data.size()};
+    std::copy(data.begin(), data.end(), _file->storage.begin());
+    _file->data = _file->storage;
 
     parseMeshNames();
 }
@@ -144,32 +307,31 @@ void ObjImporter::parseMeshNames() {
     UnsignedInt positionIndexOffset = 1;
     UnsignedInt normalIndexOffset = 1;
     UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
+    _file->meshes.emplace_back(0, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
 
     /* The first mesh doesn't have name by default but we might find it later,
        so we need to track whether there are any data before first name */
     bool thisIsFirstMeshAndItHasNoData = true;
     _file->meshNames.emplace_back();
 
-    while(_file->in->good()) {
+    const char* const begin = _file->data.begin();
+    const char* const end = _file->data.end();
+    for(const char* line = begin; line != end; ) {
         /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+        const std::size_t lineBegin = line - begin;
+        const char* const eol = lineEnd(line, end);
+        const char* const next = eol == end ? end : eol + 1;
 
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
+        /* Parse the keyword, ignore empty and comment lines */
+        const char* const keywordBegin = skipWhitespace(line, eol);
+        const char* const keywordEnd = tokenEnd(keywordBegin, eol);
+        line = next;
+        if(keywordBegin == keywordEnd || *keywordBegin == '#') continue;
 
         /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+        if(equals(keywordBegin, keywordEnd, "o")) {
+            const char* const nameBegin = skipWhitespace(keywordEnd, eol);
+            std::string name{nameBegin, trimEnd(nameBegin, eol)};
 
             /* This is the name of first mesh */
             if(thisIsFirstMeshAndItHasNoData) {
@@ -181,54 +343,46 @@ void ObjImporter::parseMeshNames() {
                 _file->meshNames.back() = std::move(name);
 
                 /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+                std::get<0>(_file->meshes.back()) = next - begin;
 
             /* Otherwise this is a name of new mesh */
             } else {
                 /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+                std::get<1>(_file->meshes.back()) = lineBegin;
 
                 /* Save name and offset of the new one. The end offset will be
                    updated later. */
                 if(!name.empty())
                     _file->meshesForName.emplace(name, _file->meshes.size());
                 _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+                _file->meshes.emplace_back(next - begin, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
             }
 
-            continue;
-
         /* If there are any data/indices before the first name, it means that
            the first object is unnamed. We need to check for them. */
 
         /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
+        } else if(equals(keywordBegin, keywordEnd, "v")) {
             ++positionIndexOffset;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
+        } else if(equals(keywordBegin, keywordEnd, "vt")) {
             ++textureCoordinateIndexOffset;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
+        } else if(equals(keywordBegin, keywordEnd, "vn")) {
             ++normalIndexOffset;
             thisIsFirstMeshAndItHasNoData = false;
 
         /* Index data, just mark that we found something for first unnamed
            object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string& data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
+        } else if(equals(keywordBegin, keywordEnd, "p") ||
+                  equals(keywordBegin, keywordEnd, "l") ||
+                  equals(keywordBegin, keywordEnd, "f")) {
+            thisIsFirstMeshAndItHasNoData = false;
         }
-
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    std::get<1>(_file->meshes.back()) = _file->data.size();
 }
 
 UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
@@ -243,11 +397,62 @@ std::string ObjImporter::doMesh3DName(UnsignedInt id) {
 }
 
 std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
+    return parseMesh(id);
+}
+
+std::vector<std::optional<MeshData3D>> ObjImporter::meshes3D(const std::vector<UnsignedInt>& ids, UnsignedInt threadCount) {
+    CORRADE_ASSERT(isOpened(), "Trade::ObjImporter::meshes3D(): no file opened", {});
+
+    /* Import all meshes if nothing is specified */
+    std::vector<UnsignedInt> allIds;
+    if(ids.empty()) {
+        allIds.resize(_file->meshes.size());
+        std::iota(allIds.begin(), allIds.end(), 0);
+    }
+    const std::vector<UnsignedInt>& meshIds = ids.empty() ? allIds : ids;
+
+    #ifndef CORRADE_NO_ASSERT
+    for(UnsignedInt id: meshIds)
+        CORRADE_ASSERT(id < _file->meshes.size(), "Trade::ObjImporter::meshes3D(): index" << id << "out of range for" << _file->meshes.size() << "meshes", {});
+    #endif
+
+    std::vector<std::optional<MeshData3D>> out(meshIds.size());
+
+    /* The parsing doesn't modify any shared state, so each worker just takes
+       the next unprocessed mesh until there's none left. Meshes can differ
+       in size a lot, so distributing them dynamically balances the load
+       better than splitting the list into fixed chunks. */
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() {
+        for(std::size_t i; (i = next++) < meshIds.size(); )
+            out[i] = parseMesh(meshIds[i]);
+    };
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = std::min(threadCount, UnsignedInt(meshIds.size()));
+
+    /* The calling thread is one of the workers */
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount ? threadCount - 1 : 0);
+    for(UnsignedInt i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for(std::thread& thread: threads) thread.join();
+    #else
+    /* No threads on Emscripten, do everything serially */
+    static_cast<void>(threadCount);
+    worker();
+    #endif
+
+    return out;
+}
+
+std::optional<MeshData3D> ObjImporter::parseMesh(const UnsignedInt id) const {
+    /* Get the mesh range, set mesh parsing parameters */
+    std::size_t begin, end;
     UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
     std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
 
     std::optional<MeshPrimitive> primitive;
     std::vector<Vector3> positions;
@@ -257,31 +462,26 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
     std::vector<UnsignedInt> textureCoordinateIndices;
     std::vector<UnsignedInt> normalIndices;
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
+    const char* const dataEnd = _file->data.begin() + end;
+    for(const char* line = _file->data.begin() + begin; line != dataEnd; ) {
+        const char* const eol = lineEnd(line, dataEnd);
 
         /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+        const char* const keywordBegin = skipWhitespace(line, eol);
+        const char* const keywordEnd = tokenEnd(keywordBegin, eol);
+        const char* const contentsBegin = skipWhitespace(keywordEnd, eol);
+        const char* const contentsEnd = trimEnd(contentsBegin, eol);
+        line = eol == dataEnd ? dataEnd : eol + 1;
+
+        /* Ignore empty lines and comments */
+        if(keywordBegin == keywordEnd || *keywordBegin == '#') continue;
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(equals(keywordBegin, keywordEnd, "v")) {
+            Vector3 data;
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            if(!extractFloatData(contentsBegin, contentsEnd, data, &extra))
+                return std::nullopt;
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
                 Error() << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
                 return std::nullopt;
@@ -290,9 +490,11 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
             positions.push_back(data);
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(equals(keywordBegin, keywordEnd, "vt")) {
+            Vector2 data;
             Float extra{0.0f};
-            const auto data = extractFloatData<2>(contents, &extra);
+            if(!extractFloatData(contentsBegin, contentsEnd, data, &extra))
+                return std::nullopt;
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
                 Error() << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
                 return std::nullopt;
@@ -302,16 +504,25 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
             textureCoordinates.front().push_back(data);
 
         /* Normal */
-        } else if(keyword == "vn") {
+        } else if(equals(keywordBegin, keywordEnd, "vn")) {
+            Vector3 data;
+            if(!extractFloatData(contentsBegin, contentsEnd, data))
+                return std::nullopt;
+
             if(normals.empty()) normals.push_back({});
-            normals.front().push_back(extractFloatData<3>(contents));
+            normals.front().push_back(data);
 
         /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+        } else if(equals(keywordBegin, keywordEnd, "p") ||
+                  equals(keywordBegin, keywordEnd, "l") ||
+                  equals(keywordBegin, keywordEnd, "f")) {
+            /* Count the index tuples first */
+            std::size_t indexTupleCount = 0;
+            for(const char* it = contentsBegin; it != contentsEnd; it = skipWhitespace(tokenEnd(it, contentsEnd), contentsEnd))
+                ++indexTupleCount;
 
             /* Points */
-            if(keyword == "p") {
+            if(*keywordBegin == 'p') {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Points) {
                     Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
@@ -319,7 +530,7 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
+                if(indexTupleCount != 1) {
                     Error() << "Trade::ObjImporter::mesh3D(): wrong index count for point";
                     return std::nullopt;
                 }
@@ -327,7 +538,7 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 primitive = MeshPrimitive::Points;
 
             /* Lines */
-            } else if(keyword == "l") {
+            } else if(*keywordBegin == 'l') {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Lines) {
                     Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
@@ -335,7 +546,7 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
+                if(indexTupleCount != 2) {
                     Error() << "Trade::ObjImporter::mesh3D(): wrong index count for line";
                     return std::nullopt;
                 }
@@ -343,7 +554,7 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 primitive = MeshPrimitive::Lines;
 
             /* Faces */
-            } else if(keyword == "f") {
+            } else if(*keywordBegin == 'f') {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Triangles) {
                     Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
@@ -351,10 +562,10 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
+                if(indexTupleCount < 3) {
                     Error() << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
                     return std::nullopt;
-                } else if(indexTuples.size() != 3) {
+                } else if(indexTupleCount != 3) {
                     Error() << "Trade::ObjImporter::mesh3D(): polygons are not supported";
                     return std::nullopt;
                 }
@@ -363,63 +574,64 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
 
             } else CORRADE_ASSERT_UNREACHABLE();
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
-                if(indices.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
-                    return std::nullopt;
+            for(const char* it = contentsBegin; it != contentsEnd; it = skipWhitespace(it, contentsEnd)) {
+                const char* const indexTupleEnd = tokenEnd(it, contentsEnd);
+
+                /* Split the tuple on slashes */
+                const char* indices[3][2];
+                std::size_t indexCount = 0;
+                for(const char* indexBegin = it; ; ) {
+                    if(indexCount == 3) {
+                        Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
+                        return std::nullopt;
+                    }
+
+                    const char* indexEnd = indexBegin;
+                    while(indexEnd != indexTupleEnd && *indexEnd != '/') ++indexEnd;
+                    indices[indexCount][0] = indexBegin;
+                    indices[indexCount++][1] = indexEnd;
+
+                    if(indexEnd == indexTupleEnd) break;
+                    indexBegin = indexEnd + 1;
                 }
 
+                it = indexTupleEnd;
+
                 /* Position indices */
-                #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                positionIndices.push_back(std::stoul(indices[0]) - positionIndexOffset);
-                #else
-                std::istringstream in(indices[0]);
                 UnsignedInt index;
-                in >> index;
+                if(!parseUnsigned(indices[0][0], indices[0][1], index)) {
+                    Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+                    return std::nullopt;
+                }
                 positionIndices.push_back(index - positionIndexOffset);
-                #endif
 
                 /* Texture coordinates */
-                if(indices.size() == 2 || (indices.size() == 3 && !indices[1].empty())) {
-                    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                    textureCoordinateIndices.push_back(std::stoul(indices[1]) - textureCoordinateIndexOffset);
-                    #else
-                    in.str(indices[1]);
-                    in >> index;
+                if(indexCount == 2 || (indexCount == 3 && indices[1][0] != indices[1][1])) {
+                    if(!parseUnsigned(indices[1][0], indices[1][1], index)) {
+                        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+                        return std::nullopt;
+                    }
                     textureCoordinateIndices.push_back(index - textureCoordinateIndexOffset);
-                    #endif
                 }
 
                 /* Normal indices */
-                if(indices.size() == 3) {
-                    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                    normalIndices.push_back(std::stoul(indices[2]) - normalIndexOffset);
-                    #else
-                    in.str(indices[2]);
-                    in >> index;
+                if(indexCount == 3) {
+                    if(!parseUnsigned(indices[2][0], indices[2][1], index)) {
+                        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+                        return std::nullopt;
+                    }
                     normalIndices.push_back(index - normalIndexOffset);
-                    #endif
                 }
             }
 
         /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
-            return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << keyword;
+        } else if(!equals(keywordBegin, keywordEnd, "mtllib") &&
+                  !equals(keywordBegin, keywordEnd, "usemtl") &&
+                  !equals(keywordBegin, keywordEnd, "g") &&
+                  !equals(keywordBegin, keywordEnd, "s")) {
+            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << std::string{keywordBegin, keywordEnd};
             return std::nullopt;
         }
-
-    }} catch(std::exception) {
-        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
-        return std::nullopt;
-    } catch(...) {
-        /* Error message already printed */
-        return std::nullopt;
     }
 
     /* There should be at least indexed position data */
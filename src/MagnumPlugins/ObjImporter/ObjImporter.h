@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Trade::ObjImporter
  */
 
+#include <vector>
+
 #include "Magnum/Trade/AbstractImporter.h"
 
 namespace Magnum { namespace Trade {
@@ -44,6 +46,14 @@ Supported features:
 Polygons (quads etc.), automatic normal generation and material properties are
 currently not supported.
 
+All meshes in the file (or a subset of them) can be imported in parallel using
+@ref meshes3D(). The object offset table is built already when opening the
+file, so each mesh is parsed independently of the others.
+
+The file is parsed directly from memory without any per-line allocations. On
+Unix the file passed to @ref openFile() is memory-mapped instead of being
+copied into memory first, data passed to @ref openData() are copied.
+
 This plugin is built if `WITH_OBJIMPORTER` is enabled when building Magnum. To
 use dynamic plugin, you need to load `ObjImporter` plugin from
 `MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a dependency
@@ -61,6 +71,22 @@ class ObjImporter: public AbstractImporter {
 
         ~ObjImporter();
 
+        /**
+         * @brief Import multiple meshes in parallel
+         * @param ids           IDs of meshes to import. If empty, all meshes
+         *      in the file are imported.
+         * @param threadCount   Count of worker threads. If `0`, the value of
+         *      `std::thread::hardware_concurrency()` is used.
+         *
+         * Equivalent to calling @ref mesh3D() for all @p ids, but the meshes
+         * are distributed across @p threadCount worker threads. Returned
+         * vector has the same order as @p ids, meshes that failed to import
+         * are @ref std::nullopt. Expects that a file is opened and all IDs are
+         * in range. Messages about import errors from different threads may
+         * be interleaved.
+         */
+        std::vector<std::optional<MeshData3D>> meshes3D(const std::vector<UnsignedInt>& ids = {}, UnsignedInt threadCount = 0);
+
     private:
         struct File;
 
@@ -77,6 +103,7 @@ class ObjImporter: public AbstractImporter {
         std::optional<MeshData3D> doMesh3D(UnsignedInt id) override;
 
         void parseMeshNames();
+        std::optional<MeshData3D> parseMesh(UnsignedInt id) const;
 
         std::unique_ptr<File> _file;
 };
@@ -50,14 +50,20 @@ class ObjImporterTest: public TestSuite::Tester {
         void normals();
         void textureCoordinatesNormals();
 
+        void openData();
+        void floatNotation();
+
         void emptyFile();
         void unnamedMesh();
         void namedMesh();
         void moreMeshes();
+        void moreMeshesParallel();
+        void moreMeshesParallelSubset();
         void unnamedFirstMesh();
 
         void wrongFloat();
         void wrongInteger();
+        void integerOverflow();
         void unmergedIndexOutOfRange();
         void mergedIndexOutOfRange();
         void zeroIndex();
@@ -102,14 +108,20 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::normals,
               &ObjImporterTest::textureCoordinatesNormals,
 
+              &ObjImporterTest::openData,
+              &ObjImporterTest::floatNotation,
+
               &ObjImporterTest::emptyFile,
               &ObjImporterTest::unnamedMesh,
               &ObjImporterTest::namedMesh,
               &ObjImporterTest::moreMeshes,
+              &ObjImporterTest::moreMeshesParallel,
+              &ObjImporterTest::moreMeshesParallelSubset,
               &ObjImporterTest::unnamedFirstMesh,
 
               &ObjImporterTest::wrongFloat,
               &ObjImporterTest::wrongInteger,
+              &ObjImporterTest::integerOverflow,
               &ObjImporterTest::unmergedIndexOutOfRange,
               &ObjImporterTest::mergedIndexOutOfRange,
               &ObjImporterTest::zeroIndex,
@@ -316,6 +328,46 @@ void ObjImporterTest::textureCoordinatesNormals() {
     }));
 }
 
+void ObjImporterTest::openData() {
+    const char data[] = "o Mesh\n"
+                        "v 0.5 2 3\n"
+                        "\tv 0 1.5 1 \r\n"
+                        "# comment\n"
+                        "\n"
+                        "l 1 2";
+
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openData({data, sizeof(data) - 1}));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+    CORRADE_COMPARE(importer.mesh3DName(0), "Mesh");
+
+    const std::optional<MeshData3D> meshData = importer.mesh3D(0);
+    CORRADE_VERIFY(meshData);
+    CORRADE_COMPARE(meshData->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(meshData->positions(0), (std::vector<Vector3>{
+        {0.5f, 2.0f, 3.0f},
+        {0.0f, 1.5f, 1.0f}
+    }));
+    CORRADE_COMPARE(meshData->indices(), (std::vector<UnsignedInt>{0, 1}));
+}
+
+void ObjImporterTest::floatNotation() {
+    const char data[] = "v -1.25e-3 +7. 2.5E+2\n"
+                        "v .5 -.5 000123.4500\n"
+                        "p 1\n"
+                        "p 2\n";
+
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openData({data, sizeof(data) - 1}));
+
+    const std::optional<MeshData3D> meshData = importer.mesh3D(0);
+    CORRADE_VERIFY(meshData);
+    CORRADE_COMPARE(meshData->positions(0), (std::vector<Vector3>{
+        {-0.00125f, 7.0f, 250.0f},
+        {0.5f, -0.5f, 123.45f}
+    }));
+}
+
 void ObjImporterTest::emptyFile() {
     ObjImporter importer;
     CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "emptyFile.obj")));
@@ -387,6 +439,42 @@ void ObjImporterTest::moreMeshes() {
     }));
 }
 
+void ObjImporterTest::moreMeshesParallel() {
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+
+    const std::vector<std::optional<MeshData3D>> data = importer.meshes3D({}, 3);
+    CORRADE_COMPARE(data.size(), 3);
+
+    /* Should give the same results as importing serially */
+    for(UnsignedInt i = 0; i != 3; ++i) {
+        const std::optional<MeshData3D> expected = importer.mesh3D(i);
+        CORRADE_VERIFY(expected);
+        CORRADE_VERIFY(data[i]);
+        CORRADE_COMPARE(data[i]->primitive(), expected->primitive());
+        CORRADE_COMPARE(data[i]->positions(0), expected->positions(0));
+        CORRADE_COMPARE(data[i]->indices(), expected->indices());
+    }
+}
+
+void ObjImporterTest::moreMeshesParallelSubset() {
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+
+    const std::vector<std::optional<MeshData3D>> data = importer.meshes3D({2, 0});
+    CORRADE_COMPARE(data.size(), 2);
+    CORRADE_VERIFY(data[0]);
+    CORRADE_COMPARE(data[0]->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data[0]->indices(), (std::vector<UnsignedInt>{
+        0, 1, 2, 2, 1, 0
+    }));
+    CORRADE_VERIFY(data[1]);
+    CORRADE_COMPARE(data[1]->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(data[1]->indices(), (std::vector<UnsignedInt>{
+        0, 1
+    }));
+}
+
 void ObjImporterTest::unnamedFirstMesh() {
     ObjImporter importer;
     CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "unnamedFirstMesh.obj")));
@@ -423,6 +511,18 @@ void ObjImporterTest::wrongInteger() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): error while converting numeric data\n");
 }
 
+void ObjImporterTest::integerOverflow() {
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
+    const Int id = importer.mesh3DForName("IntegerOverflow");
+    CORRADE_VERIFY(id > -1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.mesh3D(id));
+    CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): error while converting numeric data\n");
+}
+
 void ObjImporterTest::unmergedIndexOutOfRange() {
     ObjImporter importer;
     CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));